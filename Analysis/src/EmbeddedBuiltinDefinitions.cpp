@@ -2,6 +2,9 @@
 #include "Luau/BuiltinDefinitions.h"
 
 LUAU_FASTFLAG(LuauIntegerLibrary)
+LUAU_FASTFLAG(LuauBufferBulkOperations)
+LUAU_FASTFLAG(LuauBufferTableArrays)
+LUAU_FASTFLAG(LuauJsonLibrary)
 LUAU_FASTFLAG(LuauIntegerType2)
 LUAU_FASTFLAG(LuauAllowGlobalDeclarationToBeCalledClass)
 LUAU_FASTFLAG(DebugLuauUserDefinedClasses)
@@ -272,8 +275,6 @@ declare buffer: {
     writebits: @checked (b: buffer, bitOffset: number, bitCount: number, value: number) -> (),
     readinteger: @checked (b: buffer, offset: number) -> integer,
     writeinteger: @checked (b: buffer, offset: number, value: integer) -> (),
-}
-
 )BUILTIN_SRC";
 
 static constexpr const char* kBuiltinDefinitionBufferSrc_NOINTEGER = R"BUILTIN_SRC(
@@ -304,7 +305,33 @@ declare buffer: {
     readstring: @checked (b: buffer, offset: number, count: number) -> string,
     writestring: @checked (b: buffer, offset: number, value: string, count: number?) -> (),
     readbits: @checked (b: buffer, bitOffset: number, bitCount: number) -> number,
-    writebits: @checked (b: buffer, bitOffset: number, bitCount: number, value: number) -> ()
+    writebits: @checked (b: buffer, bitOffset: number, bitCount: number, value: number) -> (),
+)BUILTIN_SRC";
+
+static constexpr const char* kBuiltinDefinitionBufferBulkSrc = R"BUILTIN_SRC(
+    find: @checked (b: buffer, offset: number, needle: string | buffer, count: number?) -> number?,
+    compare: @checked (a: buffer, aOffset: number, b: buffer, bOffset: number?, count: number?) -> number,
+    equal: @checked (a: buffer, aOffset: number, b: buffer, bOffset: number?, count: number?) -> boolean,
+    hash: @checked (b: buffer, offset: number?, count: number?) -> number,
+    convert: @checked (target: buffer, targetOffset: number, targetType: string, source: buffer, sourceOffset: number, sourceType: string, count: number, targetStride: number?, sourceStride: number?) -> (),
+)BUILTIN_SRC";
+
+static constexpr const char* kBuiltinDefinitionBufferArraySrc = R"BUILTIN_SRC(
+    readarray: @checked (b: buffer, offset: number, type: string, count: number, stride: number?) -> {number},
+    writearray: @checked (b: buffer, offset: number, type: string, values: {number} | {integer} | {number | integer}, stride: number?) -> (),
+)BUILTIN_SRC";
+
+static constexpr const char* kBuiltinDefinitionBufferArraySrc_NOINTEGER = R"BUILTIN_SRC(
+    readarray: @checked (b: buffer, offset: number, type: string, count: number, stride: number?) -> {number},
+    writearray: @checked (b: buffer, offset: number, type: string, values: {number}, stride: number?) -> (),
+)BUILTIN_SRC";
+
+static constexpr const char* kBuiltinDefinitionJsonSrc = R"BUILTIN_SRC(
+--- JSON API
+declare json: {
+    encode: @checked (value: any, options: { sparse: ("null" | "object" | "error")?, nan: ("error" | "null" | "literal")? }?) -> string,
+    encodebuffer: @checked (value: any, options: { sparse: ("null" | "object" | "error")?, nan: ("error" | "null" | "literal")? }?) -> buffer,
+    decode: @checked (input: string | buffer, options: { nan: ("error" | "null" | "literal")? }?) -> any,
 }
 
 )BUILTIN_SRC";
@@ -411,8 +438,25 @@ std::string getBuiltinDefinitionSource()
     else
         result += kBuiltinDefinitionBufferSrc_NOINTEGER;
 
+    if (FFlag::LuauBufferBulkOperations)
+        result += kBuiltinDefinitionBufferBulkSrc;
+
+    if (FFlag::LuauBufferTableArrays)
+    {
+        if (FFlag::LuauIntegerType2 && FFlag::LuauIntegerLibrary)
+            result += kBuiltinDefinitionBufferArraySrc;
+        else
+            result += kBuiltinDefinitionBufferArraySrc_NOINTEGER;
+    }
+
+    // buffer declaration is left open above so that functions behind flags can be added to it
+    result += "}\n\n";
+
     result += kBuiltinDefinitionVectorSrc;
 
+    if (FFlag::LuauJsonLibrary)
+        result += kBuiltinDefinitionJsonSrc;
+
     if (FFlag::LuauIntegerType2 && FFlag::LuauIntegerLibrary)
     {
         result += kBuiltinDefinitionIntegerSrc;
@@ -61,6 +61,10 @@ public:
     uint32_t beginFunction(uint8_t numparams, bool isvararg = false);
     void endFunction(uint8_t maxstacksize, uint8_t numupvalues, uint8_t flags = 0, uint64_t cost = 0);
 
+    // removes all functions built so far, together with the strings and shared numbers they added
+    // this is used for functions that are only compiled to collect information about them
+    void discardFunctions();
+
     void setMainFunction(uint32_t fid);
 
     int32_t addConstantNil();
@@ -92,6 +96,8 @@ public:
 
     void patchAux(size_t targetAux, int32_t newValue);
 
+    void foldMoves();
+    void fuseMoves();
     void foldJumps();
     std::vector<uint32_t> expandJumps();
 
@@ -111,6 +117,7 @@ public:
     size_t getInstructionCount() const;
     size_t getTotalInstructionCount() const;
     uint32_t getDebugPC() const;
+    size_t getConstantCount() const;
 
     void addDebugRemark(const char* format, ...) LUAU_PRINTF_ATTR(2, 3);
 
@@ -135,6 +142,10 @@ public:
 
     void setDumpSource(const std::string& source);
 
+    // Compact encoding produces smaller bytecode at a small decoding cost; it has to be selected before the first function is built
+    // Bytecode versions from 14 are always compact, so flags that require a later version select it as well
+    void setCompactEncoding(bool enabled);
+
     bool needsDebugRemarks() const
     {
         return (dumpFlags & Dump_Remarks) != 0;
@@ -178,6 +189,9 @@ public:
     static uint8_t getVersion();
     static uint8_t getTypeEncodingVersion();
 
+    uint8_t getEncodedVersion() const;
+    bool isCompactEncoding() const;
+
 protected:
     struct Constant
     {
@@ -227,6 +241,7 @@ protected:
     struct Function
     {
         std::string data;
+        std::string compactData;
 
         uint8_t maxstacksize = 0;
         uint8_t numparams = 0;
@@ -338,6 +353,11 @@ protected:
     BytecodeEncoder* encoder = nullptr;
     std::string bytecode;
 
+    // number constants are shared between all functions in compact encoding
+    bool compactEncoding = false;
+    std::vector<double> sharedNumbers;
+    DenseHashMap<ConstantKey, uint32_t, ConstantKeyHash> sharedNumberMap;
+
     uint32_t dumpFlags = 0;
     std::vector<std::string> dumpSource;
     std::vector<std::pair<int, std::string>> dumpRemarks;
@@ -358,11 +378,14 @@ protected:
     virtual void dumpConstant(std::string& result, int k, bool detailed) const;
     void dumpInstruction(const uint32_t* opcode, std::string& result, int targetLabel) const;
 
+    void removeInstructions(const std::vector<bool>& removed);
+
     int calcLinesSpan() const;
     void fillBaselineInfo(int span, int* baseline, size_t baselineSize) const;
 
-    void writeFunction(std::string& ss, uint32_t id, uint8_t flags, uint64_t cost);
+    void writeFunction(std::string& ss, uint32_t id, uint8_t flags, uint64_t cost, bool compact);
     void writeLineInfo(std::string& ss) const;
+    void writeCompactLineInfo(std::string& ss) const;
     void writeStringTable(std::string& ss) const;
     void writeClassShape(std::string& ss, const ClassShape& cs) const;
 
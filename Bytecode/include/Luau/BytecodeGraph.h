@@ -586,6 +586,7 @@ struct BcFunction
 
 using CompTimeBcFunction = BcFunction<BcVmConst>;
 
+// Function data has to use the regular encoding; compact encoding refers to chunk-level number constants
 std::optional<CompTimeBcFunction> fromFunctionBytecode(std::string bytecode, std::vector<std::string_view>& strings);
 std::string toFunctionBytecode(CompTimeBcFunction& fn);
 std::string toFunctionBytecode(BytecodeBuilder& bcb, CompTimeBcFunction& fn);
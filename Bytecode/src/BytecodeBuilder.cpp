@@ -14,6 +14,9 @@ LUAU_FASTFLAG(DebugLuauUserDefinedClasses)
 LUAU_FASTFLAG(LuauEmitCallFeedback)
 LUAU_FASTFLAGVARIABLE(LuauVirtualBcBuilder)
 LUAU_FASTFLAGVARIABLE(LuauBytecodeCostModel)
+LUAU_FASTFLAGVARIABLE(LuauCompileMove2)
+LUAU_FASTFLAGVARIABLE(LuauCompileConcatBuffer)
+LUAU_FASTFLAGVARIABLE(LuauCompileWideStringHash)
 
 namespace Luau
 {
@@ -163,6 +166,7 @@ BytecodeBuilder::BytecodeBuilder(BytecodeEncoder* encoder)
     , protoMap(~0u)
     , stringTable({nullptr, 0})
     , encoder(encoder)
+    , sharedNumberMap({Constant::Type_Nil, ~0ull})
 {
     LUAU_ASSERT(stringTable.find(StringRef{"", 0}) == nullptr);
 
@@ -241,7 +245,11 @@ void BytecodeBuilder::endFunction(uint8_t maxstacksize, uint8_t numupvalues, uin
     if (encoder)
         encoder->encode(insns.data(), insns.size());
 
-    writeFunction(func.data, currentFunction, flags, cost);
+    writeFunction(func.data, currentFunction, flags, cost, /* compact= */ false);
+
+    // function data is kept in the regular encoding so that it can be read on its own, compact encoding refers to chunk-wide number constants
+    if (isCompactEncoding())
+        writeFunction(func.compactData, currentFunction, flags, cost, /* compact= */ true);
 
     currentFunction = ~0u;
 
@@ -275,6 +283,25 @@ void BytecodeBuilder::endFunction(uint8_t maxstacksize, uint8_t numupvalues, uin
     }
 }
 
+void BytecodeBuilder::discardFunctions()
+{
+    LUAU_ASSERT(currentFunction == ~0u && mainFunction == ~0u);
+
+    functions.clear();
+    totalInstructionCount = 0;
+
+    stringTable.clear();
+    debugStrings.clear();
+
+    sharedNumbers.clear();
+    sharedNumberMap.clear();
+
+    classShapes.clear();
+
+    for (UserdataType& ty : userdataTypes)
+        ty.used = false;
+}
+
 void BytecodeBuilder::setMainFunction(uint32_t fid)
 {
     LUAU_ASSERT(fid < functions.size());
@@ -678,6 +705,11 @@ uint32_t BytecodeBuilder::getDebugPC() const
     return uint32_t(insns.size());
 }
 
+size_t BytecodeBuilder::getConstantCount() const
+{
+    return constants.size();
+}
+
 void BytecodeBuilder::addDebugRemark(const char* format, ...)
 {
     if ((dumpFlags & Dump_Remarks) == 0)
@@ -713,13 +745,17 @@ void BytecodeBuilder::finalize()
     for (auto& p : stringTable)
         capacity += p.first.length + 2;
 
+    bool compact = isCompactEncoding();
+
     for (const Function& func : functions)
-        capacity += func.data.size();
+        capacity += compact ? func.compactData.size() : func.data.size();
+
+    capacity += sharedNumbers.size() * sizeof(double);
 
     bytecode.reserve(capacity);
 
     // assemble final bytecode blob
-    uint8_t version = getVersion();
+    uint8_t version = getEncodedVersion();
     LUAU_ASSERT(version >= LBC_VERSION_MIN && version <= LBC_VERSION_MAX);
 
     bytecode = char(version);
@@ -745,20 +781,30 @@ void BytecodeBuilder::finalize()
         writeByte(bytecode, 0);
     }
 
+    if (compact)
+    {
+        writeVarInt(bytecode, uint32_t(sharedNumbers.size()));
+
+        for (double value : sharedNumbers)
+            writeDouble(bytecode, value);
+    }
+
     writeVarInt(bytecode, uint32_t(functions.size()));
 
     for (const Function& func : functions)
     {
-        if (FFlag::LuauBytecodeCostModel)
-            writeVarInt(bytecode, func.data.size());
-        bytecode += func.data;
+        const std::string& data = compact ? func.compactData : func.data;
+
+        if (version >= 12)
+            writeVarInt(bytecode, data.size());
+        bytecode += data;
     }
 
     LUAU_ASSERT(mainFunction < functions.size());
     writeVarInt(bytecode, mainFunction);
 }
 
-void BytecodeBuilder::writeFunction(std::string& ss, uint32_t id, uint8_t flags, uint64_t cost)
+void BytecodeBuilder::writeFunction(std::string& ss, uint32_t id, uint8_t flags, uint64_t cost, bool compact)
 {
     LUAU_ASSERT(id < functions.size());
     const Function& func = functions[id];
@@ -825,7 +871,28 @@ void BytecodeBuilder::writeFunction(std::string& ss, uint32_t id, uint8_t flags,
 
         case Constant::Type_Number:
             writeByte(ss, LBC_CONSTANT_NUMBER);
-            writeDouble(ss, c.valueNumber);
+
+            if (compact)
+            {
+                ConstantKey key = {Constant::Type_Number};
+                static_assert(sizeof(key.value) == sizeof(c.valueNumber), "Expecting double to be 64-bit");
+                memcpy(&key.value, &c.valueNumber, sizeof(c.valueNumber));
+
+                uint32_t& index = sharedNumberMap[key];
+
+                if (index == 0)
+                {
+                    sharedNumbers.push_back(c.valueNumber);
+                    index = uint32_t(sharedNumbers.size());
+                }
+
+                // indices are stored with a bias of 1 in the map so that 0 can mark a new entry
+                writeVarInt(ss, index - 1);
+            }
+            else
+            {
+                writeDouble(ss, c.valueNumber);
+            }
             break;
 
         case Constant::Type_Integer:
@@ -922,7 +989,10 @@ void BytecodeBuilder::writeFunction(std::string& ss, uint32_t id, uint8_t flags,
     {
         writeByte(ss, 1);
 
-        writeLineInfo(ss);
+        if (compact)
+            writeCompactLineInfo(ss);
+        else
+            writeLineInfo(ss);
     }
     else
     {
@@ -941,7 +1011,17 @@ void BytecodeBuilder::writeFunction(std::string& ss, uint32_t id, uint8_t flags,
         {
             writeVarInt(ss, l.name);
             writeVarInt(ss, l.startpc);
-            writeVarInt(ss, l.endpc);
+
+            if (compact)
+            {
+                LUAU_ASSERT(l.endpc >= l.startpc);
+                writeVarInt(ss, l.endpc - l.startpc);
+            }
+            else
+            {
+                writeVarInt(ss, l.endpc);
+            }
+
             writeByte(ss, l.reg);
         }
 
@@ -957,7 +1037,7 @@ void BytecodeBuilder::writeFunction(std::string& ss, uint32_t id, uint8_t flags,
         writeByte(ss, 0);
     }
 
-    if (FFlag::LuauEmitCallFeedback)
+    if (getEncodedVersion() >= 11)
     {
         // Feedback Slots
         writeVarInt(ss, fbSlots.size());
@@ -968,10 +1048,8 @@ void BytecodeBuilder::writeFunction(std::string& ss, uint32_t id, uint8_t flags,
         }
     }
 
-    if (FFlag::LuauBytecodeCostModel && (flags & LPF_INLINABLE) != 0)
+    if (getEncodedVersion() >= 12 && (flags & LPF_INLINABLE) != 0)
     {
-        if (!FFlag::LuauEmitCallFeedback)
-            writeVarInt(ss, 0);
         writeVarInt(ss, cost);
     }
 }
@@ -1134,6 +1212,42 @@ void BytecodeBuilder::writeLineInfo(std::string& ss) const
     }
 }
 
+void BytecodeBuilder::writeCompactLineInfo(std::string& ss) const
+{
+    LUAU_ASSERT(!lines.empty());
+
+    // span is the same as in regular line info so that the loader can reconstruct the same line tables
+    int span = calcLinesSpan();
+
+    writeByte(ss, uint8_t(log2(span)));
+
+    // instructions that share the same line are stored as runs; each run has a zigzag encoded line delta and a length
+    uint32_t runs = 0;
+
+    for (size_t i = 0; i < lines.size(); ++i)
+        runs += i == 0 || lines[i] != lines[i - 1];
+
+    writeVarInt(ss, runs);
+
+    int lastLine = 0;
+
+    for (size_t i = 0; i < lines.size();)
+    {
+        size_t next = i + 1;
+
+        while (next < lines.size() && lines[next] == lines[i])
+            next++;
+
+        int delta = lines[i] - lastLine;
+
+        writeVarInt(ss, (uint32_t(delta) << 1) ^ uint32_t(delta >> 31));
+        writeVarInt(ss, uint32_t(next - i));
+
+        lastLine = lines[i];
+        i = next;
+    }
+}
+
 void BytecodeBuilder::writeStringTable(std::string& ss) const
 {
     std::vector<StringRef> strings(stringTable.size());
@@ -1183,15 +1297,55 @@ int BytecodeBuilder::decomposeImportId(uint32_t ids, int32_t& id0, int32_t& id1,
     return count;
 }
 
+// x*y => 128-bit product, folded to 64 bits
+static uint64_t hashMix(uint64_t x, uint64_t y)
+{
+    uint32_t x0 = uint32_t(x), x1 = uint32_t(x >> 32);
+    uint32_t y0 = uint32_t(y), y1 = uint32_t(y >> 32);
+    uint64_t p11 = uint64_t(x1) * y1, p01 = uint64_t(x0) * y1;
+    uint64_t p10 = uint64_t(x1) * y0, p00 = uint64_t(x0) * y0;
+    uint64_t mid = p10 + (p00 >> 32) + uint32_t(p01);
+    uint64_t r0 = (mid << 32) | uint32_t(p00);
+    uint64_t r1 = p11 + (mid >> 32) + (p01 >> 32);
+    return r0 ^ r1;
+}
+
 uint32_t BytecodeBuilder::getStringHash(StringRef key)
 {
     // This hashing algorithm should match luaS_hash defined in VM/lstring.cpp for short inputs; we can't use that code directly to keep compiler and
     // VM independent in terms of compilation/linking. The resulting string hashes are embedded into bytecode binary and result in a better initial
-    // guess for the field hashes which improves performance during initial code execution. We omit the long string processing here for simplicity, as
-    // it doesn't really matter on long identifiers.
+    // guess for the field hashes which improves performance during initial code execution. We omit the long string processing of luaS_hash here for
+    // simplicity, as it doesn't really matter on long identifiers; luaS_hashwide, which the VM can use for long strings instead, is simple enough to replicate.
     const char* str = key.data;
     size_t len = key.length;
 
+    if (FFlag::LuauCompileWideStringHash && len >= 32)
+    {
+        const uint64_t k0 = 0xa0761d6478bd642full;
+        const uint64_t k1 = 0xe7037ed1a0b428dbull;
+        const uint64_t k2 = 0x8ebc6af09c88c6e3ull;
+
+        const char* end = str + len;
+        uint64_t h = hashMix(uint64_t(len) ^ k0, k1);
+
+        while (len > 16)
+        {
+            uint64_t block[2];
+            memcpy(block, str, 16);
+
+            h = hashMix(block[0] ^ k1, block[1] ^ h);
+            str += 16;
+            len -= 16;
+        }
+
+        uint64_t block[2];
+        memcpy(block, end - 16, 16);
+
+        h = hashMix(block[0] ^ k2, block[1] ^ h);
+
+        return uint32_t(h ^ (h >> 32));
+    }
+
     unsigned int h = unsigned(len);
 
     // original Lua 5.1 hash for compatibility (exact match when len<32)
@@ -1201,6 +1355,370 @@ uint32_t BytecodeBuilder::getStringHash(StringRef key)
     return h;
 }
 
+// Returns the number of consecutive registers starting from A that are written by the instruction, or -1 if it's not known
+static int getWrittenRegisterCount(LuauOpcode op)
+{
+    switch (op)
+    {
+    case LOP_NOP:
+    case LOP_SETGLOBAL:
+    case LOP_SETUPVAL:
+    case LOP_CLOSEUPVALS:
+    case LOP_SETTABLE:
+    case LOP_SETTABLEKS:
+    case LOP_SETTABLEN:
+    case LOP_SETUDATAKS:
+    case LOP_SETLIST:
+    case LOP_RETURN:
+    case LOP_JUMP:
+    case LOP_JUMPBACK:
+    case LOP_JUMPIF:
+    case LOP_JUMPIFNOT:
+    case LOP_JUMPIFEQ:
+    case LOP_JUMPIFLE:
+    case LOP_JUMPIFLT:
+    case LOP_JUMPIFNOTEQ:
+    case LOP_JUMPIFNOTLE:
+    case LOP_JUMPIFNOTLT:
+    case LOP_JUMPXEQKNIL:
+    case LOP_JUMPXEQKB:
+    case LOP_JUMPXEQKN:
+    case LOP_JUMPXEQKS:
+    case LOP_FASTCALL:
+    case LOP_FASTCALL1:
+    case LOP_FASTCALL2:
+    case LOP_FASTCALL2K:
+    case LOP_FASTCALL3:
+    case LOP_COVERAGE:
+    case LOP_CAPTURE:
+        return 0;
+
+    case LOP_LOADNIL:
+    case LOP_LOADB:
+    case LOP_LOADN:
+    case LOP_LOADK:
+    case LOP_LOADKX:
+    case LOP_MOVE:
+    case LOP_GETGLOBAL:
+    case LOP_GETUPVAL:
+    case LOP_GETIMPORT:
+    case LOP_GETTABLE:
+    case LOP_GETTABLEKS:
+    case LOP_GETTABLEN:
+    case LOP_GETUDATAKS:
+    case LOP_NEWCLOSURE:
+    case LOP_DUPCLOSURE:
+    case LOP_NEWTABLE:
+    case LOP_DUPTABLE:
+    case LOP_ADD:
+    case LOP_SUB:
+    case LOP_MUL:
+    case LOP_DIV:
+    case LOP_IDIV:
+    case LOP_MOD:
+    case LOP_POW:
+    case LOP_ADDK:
+    case LOP_SUBK:
+    case LOP_MULK:
+    case LOP_DIVK:
+    case LOP_IDIVK:
+    case LOP_MODK:
+    case LOP_POWK:
+    case LOP_SUBRK:
+    case LOP_DIVRK:
+    case LOP_AND:
+    case LOP_OR:
+    case LOP_ANDK:
+    case LOP_ORK:
+    case LOP_NOT:
+    case LOP_MINUS:
+    case LOP_LENGTH:
+        return 1;
+
+    case LOP_NAMECALL:
+    case LOP_NAMECALLUDATA:
+    case LOP_MOVE2:
+        return 2;
+
+    // CONCAT writes its source registers as well; buffered concatenation also writes the buffer registers from AUX
+    case LOP_CONCAT:
+    case LOP_CONCATAPPEND:
+    case LOP_CONCATFLUSH:
+        return -1;
+
+    default:
+        return -1;
+    }
+}
+
+void BytecodeBuilder::foldMoves()
+{
+    // jump offsets are repatched on removal, which is not possible for jumps that require trampolines
+    if (hasLongJumps)
+        return;
+
+    enum
+    {
+        kBlockStart = 1 << 0,
+    };
+
+    size_t count = insns.size();
+
+    std::vector<uint8_t> flags(count + 1);
+
+    // registers captured by reference can be changed by any call through the upvalue, so their contents can't be tracked
+    bool captured[256] = {};
+
+    for (size_t i = 0; i < count;)
+    {
+        uint32_t insn = insns[i];
+        LuauOpcode op = LuauOpcode(LUAU_INSN_OP(insn));
+        size_t next = i + getOpLength(op);
+
+        if (op == LOP_CAPTURE && LUAU_INSN_A(insn) == LCT_REF)
+            captured[LUAU_INSN_B(insn)] = true;
+
+        int target = getJumpTarget(insn, uint32_t(i));
+
+        if (target >= 0)
+        {
+            LUAU_ASSERT(size_t(target) <= count);
+            flags[target] |= kBlockStart;
+        }
+
+        // fallthrough into the next instruction from a conditional jump extends the current block
+        if (!isFallthrough(op))
+            flags[next] |= kBlockStart;
+
+        i = next;
+    }
+
+    // value numbering within each basic block: registers with the same non-zero value number are known to hold the same value
+    uint32_t values[256] = {};
+    uint32_t nextValue = 1;
+
+    // constant loads are numbered by the instruction encoding; 0 can't be a valid load instruction
+    DenseHashMap<uint32_t, uint32_t> constantValues{0};
+
+    std::vector<bool> removed(count);
+    bool changed = false;
+
+    for (size_t i = 0; i < count;)
+    {
+        uint32_t insn = insns[i];
+        LuauOpcode op = LuauOpcode(LUAU_INSN_OP(insn));
+        size_t next = i + getOpLength(op);
+
+        if (flags[i] & kBlockStart)
+            memset(values, 0, sizeof(values));
+
+        uint8_t a = LUAU_INSN_A(insn);
+        uint32_t value = 0;
+
+        if (op == LOP_MOVE)
+        {
+            uint8_t b = LUAU_INSN_B(insn);
+
+            if (!captured[a] && !captured[b])
+            {
+                if (values[b] == 0)
+                    values[b] = nextValue++;
+
+                value = values[b];
+            }
+        }
+        else if (op == LOP_LOADNIL || op == LOP_LOADN || op == LOP_LOADK || (op == LOP_LOADB && LUAU_INSN_C(insn) == 0))
+        {
+            if (!captured[a])
+            {
+                uint32_t& id = constantValues[insn];
+
+                if (id == 0)
+                    id = nextValue++;
+
+                value = id;
+            }
+        }
+
+        if (value != 0 && values[a] == value)
+        {
+            // the target register already holds the value, the instruction can be removed
+            removed[i] = true;
+            changed = true;
+        }
+        else if (value != 0)
+        {
+            values[a] = value;
+        }
+        else if (op == LOP_CONCAT)
+        {
+            // concatenation stores partial results and converted numbers back into the source registers B..C
+            values[a] = 0;
+
+            for (int r = LUAU_INSN_B(insn); r <= LUAU_INSN_C(insn); ++r)
+                values[r] = 0;
+        }
+        else
+        {
+            int written = getWrittenRegisterCount(op);
+
+            if (written < 0)
+                memset(values, 0, sizeof(values));
+            else
+                for (int r = a; r < a + written && r < 256; ++r)
+                    values[r] = 0;
+        }
+
+        i = next;
+    }
+
+    if (changed)
+        removeInstructions(removed);
+}
+
+void BytecodeBuilder::fuseMoves()
+{
+    // jump offsets are repatched on removal, which is not possible for jumps that require trampolines
+    if (hasLongJumps)
+        return;
+
+    size_t count = insns.size();
+
+    std::vector<bool> targets(count + 1);
+
+    for (size_t i = 0; i < count; i += getOpLength(LuauOpcode(LUAU_INSN_OP(insns[i]))))
+    {
+        int target = getJumpTarget(insns[i], uint32_t(i));
+
+        if (target >= 0)
+            targets[target] = true;
+    }
+
+    std::vector<bool> removed(count);
+    bool changed = false;
+
+    for (size_t i = 0; i + 1 < count;)
+    {
+        uint32_t insn = insns[i];
+        uint32_t next = insns[i + 1];
+
+        // second move has to be in the same block and on the same line to keep debug information and line hooks intact
+        if (LUAU_INSN_OP(insn) == LOP_MOVE && LUAU_INSN_OP(next) == LOP_MOVE && LUAU_INSN_A(next) == LUAU_INSN_A(insn) + 1 && !targets[i + 1] &&
+            lines[i] == lines[i + 1])
+        {
+            insns[i] = LOP_MOVE2 | (LUAU_INSN_A(insn) << 8) | (LUAU_INSN_B(insn) << 16) | (LUAU_INSN_B(next) << 24);
+            removed[i + 1] = true;
+            changed = true;
+
+            i += 2;
+            continue;
+        }
+
+        i += getOpLength(LuauOpcode(LUAU_INSN_OP(insn)));
+    }
+
+    if (changed)
+        removeInstructions(removed);
+}
+
+void BytecodeBuilder::removeInstructions(const std::vector<bool>& removed)
+{
+    LUAU_ASSERT(!hasLongJumps);
+
+    size_t count = insns.size();
+    LUAU_ASSERT(removed.size() == count);
+
+    // instructions that skip over other instructions using C, these are not part of 'jumps'
+    std::vector<Jump> skips;
+
+    for (size_t i = 0; i < count; i += getOpLength(LuauOpcode(LUAU_INSN_OP(insns[i]))))
+    {
+        LuauOpcode op = LuauOpcode(LUAU_INSN_OP(insns[i]));
+
+        if (isFastCall(op) || isSkipC(op))
+        {
+            int target = getJumpTarget(insns[i], uint32_t(i));
+
+            if (target >= 0)
+                skips.push_back({uint32_t(i), uint32_t(target)});
+        }
+    }
+
+    // compact the instruction stream, with remap table keeping track of the moves: remap[oldpc] = newpc
+    // removed instructions are mapped to the next instruction that is kept
+    std::vector<uint32_t> remap(count + 1);
+
+    size_t newcount = 0;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        remap[i] = uint32_t(newcount);
+
+        if (!removed[i])
+        {
+            insns[newcount] = insns[i];
+            lines[newcount] = lines[i];
+            newcount++;
+        }
+    }
+
+    remap[count] = uint32_t(newcount);
+
+    insns.resize(newcount);
+    lines.resize(newcount);
+
+    for (Jump& jump : jumps)
+    {
+        LUAU_ASSERT(!removed[jump.source]);
+
+        uint32_t& insn = insns[remap[jump.source]];
+
+        // make sure jump instruction had the correct offset before we started
+        LUAU_ASSERT(LUAU_INSN_D(insn) == int(jump.target) - int(jump.source) - 1);
+
+        jump.source = remap[jump.source];
+        jump.target = remap[jump.target];
+
+        // removal can only make jumps shorter so the new offset always fits
+        int offset = int(jump.target) - int(jump.source) - 1;
+        LUAU_ASSERT(int16_t(offset) == offset);
+
+        insn &= 0xffff;
+        insn |= uint16_t(offset) << 16;
+    }
+
+    for (const Jump& skip : skips)
+    {
+        uint32_t& insn = insns[remap[skip.source]];
+
+        // skip offset is relative to the next instruction for LOADB and to CALL for FASTCALL
+        int base = isFastCall(LuauOpcode(LUAU_INSN_OP(insn))) ? 2 : 1;
+        int offset = int(remap[skip.target]) - int(remap[skip.source]) - base;
+        LUAU_ASSERT(offset >= 0 && offset <= int(LUAU_INSN_C(insn)));
+
+        insn &= ~(0xffu << 24);
+        insn |= uint32_t(offset) << 24;
+    }
+
+    for (uint32_t& pc : fbSlots)
+        pc = remap[pc];
+
+    for (auto& remark : debugRemarks)
+        remark.first = remap[remark.first];
+
+    for (DebugLocal& debugLocal : debugLocals)
+    {
+        debugLocal.startpc = remap[debugLocal.startpc];
+        debugLocal.endpc = remap[debugLocal.endpc];
+    }
+
+    for (TypedLocal& typedLocal : typedLocals)
+    {
+        typedLocal.startpc = remap[typedLocal.startpc];
+        typedLocal.endpc = remap[typedLocal.endpc];
+    }
+}
+
 void BytecodeBuilder::foldJumps()
 {
     // if our function has long jumps, some processing below can make jump instructions not-jumps (e.g. JUMP->RETURN)
@@ -1413,6 +1931,10 @@ std::string BytecodeBuilder::getError(const std::string& message)
 
 uint8_t BytecodeBuilder::getVersion()
 {
+    if (FFlag::LuauCompileConcatBuffer)
+        return 15;
+    if (FFlag::LuauCompileMove2)
+        return 13;
     if (FFlag::LuauBytecodeCostModel)
         return 12;
     if (FFlag::LuauEmitCallFeedback)
@@ -1431,6 +1953,19 @@ uint8_t BytecodeBuilder::getVersion()
     return LBC_VERSION_TARGET;
 }
 
+uint8_t BytecodeBuilder::getEncodedVersion() const
+{
+    uint8_t version = getVersion();
+
+    // version 14 is a compact encoding of all earlier versions; later versions keep using it
+    return compactEncoding && version < 14 ? 14 : version;
+}
+
+bool BytecodeBuilder::isCompactEncoding() const
+{
+    return getEncodedVersion() >= 14;
+}
+
 uint8_t BytecodeBuilder::getTypeEncodingVersion()
 {
     return LBC_TYPE_VERSION_TARGET;
@@ -1530,6 +2065,12 @@ void BytecodeBuilder::validateInstructions() const
             VREG(LUAU_INSN_B(insn));
             break;
 
+        case LOP_MOVE2:
+            VREG(LUAU_INSN_A(insn) + 1);
+            VREG(LUAU_INSN_B(insn));
+            VREG(LUAU_INSN_C(insn));
+            break;
+
         case LOP_GETGLOBAL:
         case LOP_SETGLOBAL:
             VREG(LUAU_INSN_A(insn));
@@ -1719,6 +2260,20 @@ void BytecodeBuilder::validateInstructions() const
             LUAU_ASSERT(LUAU_INSN_B(insn) <= LUAU_INSN_C(insn));
             break;
 
+        case LOP_CONCATAPPEND:
+            VREG(LUAU_INSN_A(insn));
+            VREG(LUAU_INSN_B(insn));
+            VREG(LUAU_INSN_C(insn));
+            LUAU_ASSERT(LUAU_INSN_B(insn) < LUAU_INSN_C(insn));
+            VREG(insns[i + 1]);
+            VREG(insns[i + 1] + 1);
+            break;
+
+        case LOP_CONCATFLUSH:
+            VREG(LUAU_INSN_A(insn));
+            VREG(LUAU_INSN_B(insn) + 1);
+            break;
+
         case LOP_NOT:
         case LOP_MINUS:
         case LOP_LENGTH:
@@ -2031,7 +2586,7 @@ void BytecodeBuilder::validateVariadic() const
             // (we can't simply start a variadic sequence here because that would trigger assertions during linked CALL validation)
         }
         else if (op == LOP_CLOSEUPVALS || op == LOP_NAMECALL || op == LOP_GETIMPORT || op == LOP_MOVE || op == LOP_GETUPVAL || op == LOP_GETGLOBAL ||
-                 op == LOP_GETTABLEKS || op == LOP_COVERAGE)
+                 op == LOP_GETTABLEKS || op == LOP_COVERAGE || op == LOP_MOVE2)
         {
             // instructions inside a variadic sequence must be neutral (can't change L->top)
             // while there are many neutral instructions like this, here we check that the instruction is one of the few
@@ -2262,6 +2817,10 @@ void BytecodeBuilder::dumpInstruction(const uint32_t* code, std::string& result,
         formatAppend(result, "MOVE R%d R%d\n", LUAU_INSN_A(insn), LUAU_INSN_B(insn));
         break;
 
+    case LOP_MOVE2:
+        formatAppend(result, "MOVE2 R%d R%d R%d\n", LUAU_INSN_A(insn), LUAU_INSN_B(insn), LUAU_INSN_C(insn));
+        break;
+
     case LOP_GETGLOBAL:
         formatAppend(result, "GETGLOBAL R%d K%d [", LUAU_INSN_A(insn), *code);
         dumpConstant(result, *code, false);
@@ -2491,6 +3050,14 @@ void BytecodeBuilder::dumpInstruction(const uint32_t* code, std::string& result,
         formatAppend(result, "CONCAT R%d R%d R%d\n", LUAU_INSN_A(insn), LUAU_INSN_B(insn), LUAU_INSN_C(insn));
         break;
 
+    case LOP_CONCATAPPEND:
+        formatAppend(result, "CONCATAPPEND R%d R%d R%d R%d\n", LUAU_INSN_A(insn), LUAU_INSN_B(insn), LUAU_INSN_C(insn), *code++);
+        break;
+
+    case LOP_CONCATFLUSH:
+        formatAppend(result, "CONCATFLUSH R%d R%d\n", LUAU_INSN_A(insn), LUAU_INSN_B(insn));
+        break;
+
     case LOP_NOT:
         formatAppend(result, "NOT R%d R%d\n", LUAU_INSN_A(insn), LUAU_INSN_B(insn));
         break;
@@ -2883,6 +3450,14 @@ std::string BytecodeBuilder::dumpCurrentFunction(std::vector<int>& dumpinstoffs)
     return result;
 }
 
+void BytecodeBuilder::setCompactEncoding(bool enabled)
+{
+    // function data is serialized as soon as the function is complete
+    LUAU_ASSERT(functions.empty());
+
+    compactEncoding = enabled;
+}
+
 void BytecodeBuilder::setDumpSource(const std::string& source)
 {
     dumpSource.clear();
@@ -607,6 +607,15 @@ struct BytecodeGraphParser
                 addProducer(LUAU_INSN_A(insn), nodeOp);
                 break;
 
+            case LOP_MOVE2:
+                addVmRegInput(node, LUAU_INSN_B(insn));
+                func.regs[nodeOp] = LUAU_INSN_A(insn);
+                addProducer(LUAU_INSN_A(insn), func.addProj(nodeOp, 0));
+                // second copy observes the first one; when it reads A, it reads the value that was copied from B
+                addVmRegInput(node, LUAU_INSN_C(insn) == LUAU_INSN_A(insn) ? LUAU_INSN_B(insn) : LUAU_INSN_C(insn));
+                addProducer(LUAU_INSN_A(insn) + 1, func.addProj(nodeOp, 1));
+                break;
+
             case LOP_GETGLOBAL:
                 addImmInput(node, static_cast<int32_t>(LUAU_INSN_C(insn)));
                 addVmConstInput(node, aux);
@@ -821,6 +830,28 @@ struct BytecodeGraphParser
                 break;
             }
 
+            case LOP_CONCATAPPEND:
+            {
+                LUAU_ASSERT(LUAU_INSN_B(insn) < LUAU_INSN_C(insn));
+                addVmRegInput(node, LUAU_INSN_A(insn));
+                // first register of the range is scratch and doesn't hold an input
+                for (Reg param = LUAU_INSN_B(insn) + 1; param <= LUAU_INSN_C(insn); param++)
+                    addVmRegInput(node, param);
+                addVmRegInput(node, Reg(aux));
+                addVmRegInput(node, Reg(aux + 1));
+                func.regs[nodeOp] = Reg(aux);
+                addProducer(Reg(aux), func.addProj(nodeOp, 0));
+                addProducer(Reg(aux + 1), func.addProj(nodeOp, 1));
+                break;
+            }
+
+            case LOP_CONCATFLUSH:
+                addVmRegInput(node, LUAU_INSN_A(insn));
+                addVmRegInput(node, LUAU_INSN_B(insn));
+                addVmRegInput(node, LUAU_INSN_B(insn) + 1);
+                addProducer(LUAU_INSN_A(insn), nodeOp);
+                break;
+
             case LOP_NOT:
             case LOP_MINUS:
             case LOP_LENGTH:
@@ -249,6 +249,10 @@ struct BytecodeGraphSerializer
             bcb.emitABC(LOP_MOVE, getRegister(insnOp), getRegInput(insn, 0), 0);
             break;
 
+        case LOP_MOVE2:
+            bcb.emitABC(LOP_MOVE2, getRegister(insnOp), getRegInput(insn, 0), getRegInput(insn, 1));
+            break;
+
         case LOP_GETGLOBAL:
             bcb.emitABC(LOP_GETGLOBAL, getRegister(insnOp), 0, getImmInt(insn, 0));
             bcb.emitAux(getVmConstInputAux(insn, 1));
@@ -398,6 +402,17 @@ struct BytecodeGraphSerializer
             bcb.emitABC(LOP_CONCAT, getRegister(insnOp), getRegInput(insn, 0), getRegInput(insn, insn.ops.size() - 1));
             break;
 
+        case LOP_CONCATAPPEND:
+            LUAU_ASSERT(insn.ops.size() > 3);
+            // the last two inputs are the buffer registers, and the scratch register precedes the appended values
+            bcb.emitABC(LOP_CONCATAPPEND, getRegInput(insn, 0), getRegInput(insn, 1) - 1, getRegInput(insn, insn.ops.size() - 3));
+            bcb.emitAux(getRegister(insnOp));
+            break;
+
+        case LOP_CONCATFLUSH:
+            bcb.emitABC(LOP_CONCATFLUSH, getRegister(insnOp), getRegInput(insn, 1), 0);
+            break;
+
         case LOP_NOT:
         case LOP_MINUS:
         case LOP_LENGTH:
@@ -0,0 +1,7 @@
+// This file is part of the Luau programming language and is licensed under MIT License; see LICENSE.txt for details
+#pragma once
+
+struct lua_State;
+
+void opcodePairsStart(lua_State* L);
+void opcodePairsDump(const char* path);
@@ -10,6 +10,7 @@
 #include "Luau/FileUtils.h"
 #include "Luau/Flags.h"
 
+#include <algorithm>
 #include <memory>
 
 using Luau::CodeGen::FunctionBytecodeSummary;
@@ -210,7 +211,33 @@ static void serializeFunctionSummary(const FunctionBytecodeSummary& summary, FIL
             fprintf(fp, ",");
     }
 
-    fprintf(fp, "\n            ]");
+    fprintf(fp, "\n            ],\n");
+
+    // instruction pairs are sorted by frequency, most common first
+    std::vector<std::pair<uint16_t, unsigned>> pairs;
+
+    for (const auto& [key, count] : summary.getPairCounts())
+        pairs.push_back({key, count});
+
+    std::sort(
+        pairs.begin(),
+        pairs.end(),
+        [](const std::pair<uint16_t, unsigned>& a, const std::pair<uint16_t, unsigned>& b)
+        {
+            return a.second != b.second ? a.second > b.second : a.first < b.first;
+        }
+    );
+
+    fprintf(fp, "            \"pairs\": [");
+
+    for (size_t i = 0; i < pairs.size(); ++i)
+    {
+        fprintf(fp, "[%d, %d, %u]", pairs[i].first >> 8, pairs[i].first & 0xff, pairs[i].second);
+        if (i < pairs.size() - 1)
+            fprintf(fp, ", ");
+    }
+
+    fprintf(fp, "]");
     fprintf(fp, "\n        }");
 }
 
@@ -282,7 +309,7 @@ int main(int argc, char** argv)
     size_t fileCount = files.size();
 
     std::vector<std::vector<FunctionBytecodeSummary>> scriptSummaries;
-    scriptSummaries.reserve(fileCount);
+    scriptSummaries.resize(fileCount);
 
     for (size_t i = 0; i < fileCount; ++i)
     {
@@ -7,12 +7,17 @@
 #include "Luau/Compiler.h"
 #include "Luau/BytecodeBuilder.h"
 #include "Luau/Parser.h"
+#include "Luau/StringUtils.h"
 #include "Luau/TimeTrace.h"
 
 #include "Luau/FileUtils.h"
 #include "Luau/Flags.h"
 
+#include <algorithm>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
+#include <thread>
 
 #ifdef _WIN32
 #include <io.h>
@@ -54,6 +59,7 @@ struct GlobalOptions
 
     bool onlyParse = false;
     bool parseCst = false;
+    bool compactBytecode = false;
 } globalOptions;
 
 static Luau::CompileOptions copts()
@@ -96,26 +102,27 @@ static std::optional<CompileFormat> getCompileFormat(const char* name)
         return std::nullopt;
 }
 
-static void report(const char* name, const Luau::Location& location, const char* type, const char* message)
+static void report(std::string& errors, const char* name, const Luau::Location& location, const char* type, const char* message)
 {
-    fprintf(stderr, "%s(%d,%d): %s: %s\n", name, location.begin.line + 1, location.begin.column + 1, type, message);
+    Luau::formatAppend(errors, "%s(%d,%d): %s: %s\n", name, location.begin.line + 1, location.begin.column + 1, type, message);
 }
 
-static void reportError(const char* name, const Luau::ParseError& error)
+static void reportError(std::string& errors, const char* name, const Luau::ParseError& error)
 {
-    report(name, error.getLocation(), "SyntaxError", error.what());
+    report(errors, name, error.getLocation(), "SyntaxError", error.what());
 }
 
-static void reportError(const char* name, const Luau::CompileError& error)
+static void reportError(std::string& errors, const char* name, const Luau::CompileError& error)
 {
-    report(name, error.getLocation(), "CompileError", error.what());
+    report(errors, name, error.getLocation(), "CompileError", error.what());
 }
 
 static std::string getCodegenAssembly(
     const char* name,
     const std::string& bytecode,
     Luau::CodeGen::AssemblyOptions options,
-    Luau::CodeGen::LoweringStats* stats
+    Luau::CodeGen::LoweringStats* stats,
+    std::string& errors
 )
 {
     std::unique_ptr<lua_State, void (*)(lua_State*)> globalState(luaL_newstate(), lua_close);
@@ -124,7 +131,7 @@ static std::string getCodegenAssembly(
     if (luau_load(L, name, bytecode.data(), bytecode.size(), 0) == 0)
         return Luau::CodeGen::getAssembly(L, -1, options, stats);
 
-    fprintf(stderr, "Error loading bytecode %s\n", name);
+    Luau::formatAppend(errors, "Error loading bytecode %s\n", name);
     return "";
 }
 
@@ -302,6 +309,8 @@ static bool compileFile(
     CompileFormat format,
     Luau::CodeGen::AssemblyOptions::Target assemblyTarget,
     CompileStats& stats,
+    std::string& output,
+    std::string& errors,
     bool dumpConstants
 )
 {
@@ -310,7 +319,7 @@ static bool compileFile(
     std::optional<std::string> source = readFile(name);
     if (!source)
     {
-        fprintf(stderr, "Error opening %s\n", name);
+        Luau::formatAppend(errors, "Error opening %s\n", name);
         return false;
     }
 
@@ -322,6 +331,7 @@ static bool compileFile(
     try
     {
         Luau::BytecodeBuilder bcb;
+        bcb.setCompactEncoding(globalOptions.compactBytecode);
 
         Luau::CodeGen::AssemblyOptions options;
         options.compilationOptions.flags = Luau::CodeGen::CodeGen_ColdFunctions;
@@ -388,22 +398,22 @@ static bool compileFile(
         switch (format)
         {
         case CompileFormat::Text:
-            printf("%s", bcb.dumpEverything().c_str());
+            output += bcb.dumpEverything();
             break;
         case CompileFormat::Remarks:
-            printf("%s", bcb.dumpSourceRemarks().c_str());
+            output += bcb.dumpSourceRemarks();
             break;
         case CompileFormat::Binary:
-            fwrite(bcb.getBytecode().data(), 1, bcb.getBytecode().size(), stdout);
+            output += bcb.getBytecode();
             break;
         case CompileFormat::Codegen:
         case CompileFormat::CodegenAsm:
         case CompileFormat::CodegenIr:
         case CompileFormat::CodegenVerbose:
-            printf("%s", getCodegenAssembly(name, bcb.getBytecode(), options, &stats.lowerStats).c_str());
+            output += getCodegenAssembly(name, bcb.getBytecode(), options, &stats.lowerStats, errors);
             break;
         case CompileFormat::CodegenNull:
-            stats.codegen += getCodegenAssembly(name, bcb.getBytecode(), options, &stats.lowerStats).size();
+            stats.codegen += getCodegenAssembly(name, bcb.getBytecode(), options, &stats.lowerStats, errors).size();
             stats.codegenTime += recordDeltaTime(currts);
             break;
         case CompileFormat::Null:
@@ -415,12 +425,12 @@ static bool compileFile(
     catch (Luau::ParseErrors& e)
     {
         for (auto& error : e.getErrors())
-            reportError(name, error);
+            reportError(errors, name, error);
         return false;
     }
     catch (Luau::CompileError& e)
     {
-        reportError(name, e);
+        reportError(errors, name, e);
         return false;
     }
 }
@@ -437,6 +447,7 @@ static void displayHelp(const char* argv0)
     printf("  -O<n>: compile with optimization level n (default 1, n should be between 0 and 2).\n");
     printf("  -g<n>: compile with debug level n (default 1, n should be between 0 and 2).\n");
     printf("  -t<n>: compile with type information level n (default 0, n should be between 0 and 1).\n");
+    printf("  -j<n>: compile files on n threads (default 1, 0 uses all hardware threads); output is produced in file order.\n");
     printf("  --target=<target>: compile code for specific architecture (a64, x64, a64_nf, x64_ms).\n");
     printf("  --timetrace: record compiler time tracing information into trace.json\n");
     printf("  --record-stats=<granularity>: granularity of compilation stats (total, file, function).\n");
@@ -448,6 +459,7 @@ static void displayHelp(const char* argv0)
     printf("  --vector-type=<name>: name of the vector type.\n");
     printf("  --only-parse: Only parse the input.\n");
     printf("  --parse-cst: Whether parser should parse CST in addition to AST.\n");
+    printf("  --compact-bytecode: Use the compact bytecode encoding that is smaller but needs a recent VM to load.\n");
     printf("  --fflags=<flags>: comma-separated list of fast flags to enable/disable (--fflags=true,false,LuauFlag1=true,LuauFlag2=false).\n");
 }
 
@@ -493,6 +505,7 @@ int main(int argc, char** argv)
     std::string statsFile("stats.json");
     bool bytecodeSummary = false;
     bool dumpConstants = false;
+    int threadCount = 1;
 
     for (int i = 1; i < argc; i++)
     {
@@ -531,6 +544,13 @@ int main(int argc, char** argv)
             }
             globalOptions.typeInfoLevel = level;
         }
+        else if (strncmp(argv[i], "-j", 2) == 0)
+        {
+            threadCount = int(strtol(argv[i] + 2, nullptr, 10));
+
+            if (threadCount <= 0)
+                threadCount = int(std::max(std::thread::hardware_concurrency(), 1u));
+        }
         else if (strncmp(argv[i], "--target=", 9) == 0)
         {
             const char* value = argv[i] + 9;
@@ -611,6 +631,10 @@ int main(int argc, char** argv)
         {
             globalOptions.onlyParse = true;
         }
+        else if (strcmp(argv[i], "--compact-bytecode") == 0)
+        {
+            globalOptions.compactBytecode = true;
+        }
         else if (argv[i][0] == '-' && argv[i][1] == '-' && getCompileFormat(argv[i] + 2))
         {
             compileFormat = *getCompileFormat(argv[i] + 2);
@@ -654,14 +678,126 @@ int main(int argc, char** argv)
     int failed = 0;
     unsigned functionStats = (recordStats == RecordStats::Function ? Luau::CodeGen::FunctionStats_Enable : 0) |
                              (bytecodeSummary ? Luau::CodeGen::FunctionStats_BytecodeSummary : 0);
-    for (const std::string& path : files)
+
+    struct FileResult
     {
-        CompileStats fileStat = {};
-        fileStat.lowerStats.functionStatsFlags = functionStats;
-        failed += !compileFile(path.c_str(), compileFormat, assemblyTarget, fileStat, dumpConstants);
-        stats += fileStat;
+        CompileStats stats = {};
+        std::string output;
+        std::string errors;
+        bool success = false;
+    };
+
+    std::vector<FileResult> results(fileCount);
+
+    auto compile = [&](size_t index)
+    {
+        FileResult& result = results[index];
+        result.stats.lowerStats.functionStatsFlags = functionStats;
+        result.success = compileFile(files[index].c_str(), compileFormat, assemblyTarget, result.stats, result.output, result.errors, dumpConstants);
+    };
+
+    // results are always reported in file order so that the output doesn't depend on the thread count
+    auto flush = [&](size_t index)
+    {
+        FileResult& result = results[index];
+
+        fwrite(result.output.data(), 1, result.output.size(), stdout);
+        fwrite(result.errors.data(), 1, result.errors.size(), stderr);
+
+        failed += !result.success;
+        stats += result.stats;
         if (recordStats == RecordStats::File || recordStats == RecordStats::Function)
-            fileStats.push_back(fileStat);
+            fileStats.push_back(result.stats);
+
+        result = {};
+    };
+
+    if (threadCount <= 1 || fileCount <= 1)
+    {
+        for (size_t i = 0; i < fileCount; ++i)
+        {
+            compile(i);
+            flush(i);
+        }
+    }
+    else
+    {
+        // each file gets its own allocator and name table, so workers only share the file queue
+        // results are flushed as soon as every file before them is done, and workers stay within a window of the oldest
+        // unflushed file so that one slow file doesn't make the output of the others pile up in memory
+        const size_t window = size_t(threadCount) * 4;
+
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::vector<uint8_t> done(fileCount);
+        size_t nextFile = 0;
+        size_t flushed = 0;
+
+        std::vector<std::thread> workers;
+
+        for (size_t i = 0; i < std::min(size_t(threadCount), fileCount); ++i)
+        {
+            workers.emplace_back(
+                [&]
+                {
+                    for (;;)
+                    {
+                        size_t index = 0;
+
+                        {
+                            std::unique_lock<std::mutex> lock(mutex);
+                            cv.wait(
+                                lock,
+                                [&]
+                                {
+                                    return nextFile >= fileCount || nextFile < flushed + window;
+                                }
+                            );
+
+                            if (nextFile >= fileCount)
+                                break;
+
+                            index = nextFile++;
+                        }
+
+                        compile(index);
+
+                        {
+                            std::lock_guard<std::mutex> lock(mutex);
+                            done[index] = true;
+                        }
+
+                        cv.notify_all();
+                    }
+                }
+            );
+        }
+
+        for (size_t i = 0; i < fileCount; ++i)
+        {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                cv.wait(
+                    lock,
+                    [&]
+                    {
+                        return done[i] != 0;
+                    }
+                );
+            }
+
+            flush(i);
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                flushed = i + 1;
+            }
+
+            cv.notify_all();
+        }
+
+        for (std::thread& worker : workers)
+            worker.join();
     }
 
     if (compileFormat == CompileFormat::Null)
@@ -0,0 +1,105 @@
+// This file is part of the Luau programming language and is licensed under MIT License; see LICENSE.txt for details
+#include "Luau/OpcodePairs.h"
+#include "Luau/DenseHash.h"
+
+#include "lua.h"
+
+#include <algorithm>
+#include <stdio.h>
+#include <vector>
+
+struct ThreadPairs
+{
+    // opcode executed last at each call depth, -1 when the frame hasn't executed anything yet
+    std::vector<int> previous;
+    int depth = 0;
+};
+
+struct OpcodePairs
+{
+    Luau::DenseHashMap<lua_State*, ThreadPairs> threads{nullptr};
+
+    // pairs are keyed by (first << 8) | second
+    uint64_t counts[256 * 256] = {};
+} gOpcodePairs;
+
+static void opcodePairsStep(lua_State* L, lua_Debug* ar)
+{
+    int op = lua_getopcode(L, 0);
+
+    if (op < 0)
+        return;
+
+    ThreadPairs& thread = gOpcodePairs.threads[L];
+    int depth = lua_stackdepth(L);
+
+    if (size_t(depth) >= thread.previous.size())
+        thread.previous.resize(depth + 1, -1);
+
+    // frames above the last seen depth are new calls, so their first instruction doesn't pair with whatever ran at that depth before
+    for (int i = thread.depth + 1; i <= depth; ++i)
+        thread.previous[i] = -1;
+
+    // pairs are counted within a single call frame, so the instruction after a call pairs with the call itself
+    if (int prev = thread.previous[depth]; prev >= 0)
+        gOpcodePairs.counts[(prev << 8) | op]++;
+
+    thread.previous[depth] = op;
+    thread.depth = depth;
+}
+
+static void opcodePairsThread(lua_State* LP, lua_State* L)
+{
+    // thread addresses can be reused after the thread is destroyed
+    if (ThreadPairs* thread = gOpcodePairs.threads.find(L))
+        *thread = ThreadPairs();
+}
+
+void opcodePairsStart(lua_State* L)
+{
+    lua_Callbacks* cb = lua_callbacks(L);
+
+    cb->debugstep = opcodePairsStep;
+    cb->userthread = opcodePairsThread;
+
+    // new threads inherit single step mode from their parent
+    lua_singlestep(L, true);
+}
+
+void opcodePairsDump(const char* path)
+{
+    std::vector<std::pair<int, uint64_t>> pairs;
+
+    for (int i = 0; i < 256 * 256; ++i)
+        if (gOpcodePairs.counts[i])
+            pairs.push_back({i, gOpcodePairs.counts[i]});
+
+    // most frequent pairs first
+    std::sort(
+        pairs.begin(),
+        pairs.end(),
+        [](auto&& a, auto&& b)
+        {
+            return a.second != b.second ? a.second > b.second : a.first < b.first;
+        }
+    );
+
+    FILE* f = fopen(path, "wb");
+    if (!f)
+    {
+        fprintf(stderr, "Error opening opcode pairs file %s\n", path);
+        return;
+    }
+
+    uint64_t total = 0;
+
+    for (const auto& [key, count] : pairs)
+    {
+        fprintf(f, "%d %d %lld\n", key >> 8, key & 0xff, (long long)count);
+        total += count;
+    }
+
+    fclose(f);
+
+    printf("Opcode pairs written to %s (%d distinct, %lld total)\n", path, int(pairs.size()), (long long)total);
+}
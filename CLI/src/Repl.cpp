@@ -15,6 +15,7 @@
 #include "Luau/FileUtils.h"
 #include "Luau/Flags.h"
 #include "Luau/JitInliner.h"
+#include "Luau/OpcodePairs.h"
 #include "Luau/Profiler.h"
 #include "Luau/ReplRequirer.h"
 #include "Luau/Require.h"
@@ -682,6 +683,7 @@ static void displayHelp(const char* argv0)
     printf("Available options:\n");
     printf("  --coverage: collect code coverage while running the code and output results to coverage.out\n");
     printf("  --counters: collect native counters data while running the code and output results to callgrind.out\n");
+    printf("  --opcode-pairs: count pairs of opcodes executed back to back by the interpreter and output results to oppairs.out\n");
     printf("  -h, --help: Display this usage message.\n");
     printf("  -i, --interactive: Run an interactive REPL after executing the last script specified.\n");
     printf("  -O<n>: compile with optimization level n (default 1, n should be between 0 and 2).\n");
@@ -715,6 +717,7 @@ int replMain(int argc, char** argv)
     bool interactive = false;
     bool codegenPerf = false;
     bool counters = false;
+    bool opcodePairs = false;
     int program_args = argc;
 
     for (int i = 1; i < argc; i++)
@@ -778,6 +781,10 @@ int replMain(int argc, char** argv)
         {
             counters = true;
         }
+        else if (strcmp(argv[i], "--opcode-pairs") == 0)
+        {
+            opcodePairs = true;
+        }
         else if (strcmp(argv[i], "--timetrace") == 0)
         {
             FFlag::DebugLuauTimeTracing.value = true;
@@ -815,6 +822,13 @@ int replMain(int argc, char** argv)
     }
 #endif
 
+    // native code doesn't single step, so its instructions wouldn't be counted
+    if (opcodePairs && codegen)
+    {
+        fprintf(stderr, "--opcode-pairs option can't be combined with native code generation\n");
+        return 1;
+    }
+
     if (codegenPerf)
     {
 #if __linux__
@@ -865,6 +879,9 @@ int replMain(int argc, char** argv)
         if (counters)
             countersInit(L);
 
+        if (opcodePairs)
+            opcodePairsStart(L);
+
         int failed = 0;
 
         for (size_t i = 0; i < files.size(); ++i)
@@ -885,6 +902,9 @@ int replMain(int argc, char** argv)
         if (counters)
             countersDump("callgrind.out");
 
+        if (opcodePairs)
+            opcodePairsDump("oppairs.out");
+
         return failed ? 1 : 0;
     }
 }
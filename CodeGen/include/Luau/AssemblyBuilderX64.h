@@ -131,12 +131,15 @@ public:
     void vsubsd(OperandX64 dst, OperandX64 src1, OperandX64 src2);
     void vsubss(OperandX64 dst, OperandX64 src1, OperandX64 src2);
     void vsubps(OperandX64 dst, OperandX64 src1, OperandX64 src2);
+    void vsubpd(OperandX64 dst, OperandX64 src1, OperandX64 src2);
     void vmulsd(OperandX64 dst, OperandX64 src1, OperandX64 src2);
     void vmulss(OperandX64 dst, OperandX64 src1, OperandX64 src2);
     void vmulps(OperandX64 dst, OperandX64 src1, OperandX64 src2);
+    void vmulpd(OperandX64 dst, OperandX64 src1, OperandX64 src2);
     void vdivsd(OperandX64 dst, OperandX64 src1, OperandX64 src2);
     void vdivss(OperandX64 dst, OperandX64 src1, OperandX64 src2);
     void vdivps(OperandX64 dst, OperandX64 src1, OperandX64 src2);
+    void vdivpd(OperandX64 dst, OperandX64 src1, OperandX64 src2);
 
     void vandps(OperandX64 dst, OperandX64 src1, OperandX64 src2);
     void vandpd(OperandX64 dst, OperandX64 src1, OperandX64 src2);
@@ -155,6 +158,8 @@ public:
     void vcvtsi2ss(OperandX64 dst, OperandX64 src1, OperandX64 src2);
     void vcvtsd2ss(OperandX64 dst, OperandX64 src1, OperandX64 src2);
     void vcvtss2sd(OperandX64 dst, OperandX64 src1, OperandX64 src2);
+    void vcvtps2pd(OperandX64 dst, OperandX64 src);
+    void vcvtpd2ps(OperandX64 dst, OperandX64 src);
 
     void vroundsd(OperandX64 dst, OperandX64 src1, OperandX64 src2, RoundingModeX64 roundingMode); // inexact
     void vroundss(OperandX64 dst, OperandX64 src1, OperandX64 src2, RoundingModeX64 roundingMode); // inexact
@@ -176,9 +181,11 @@ public:
     void vmovq(OperandX64 dst, OperandX64 src);
 
     void vmaxps(OperandX64 dst, OperandX64 src1, OperandX64 src2);
+    void vmaxpd(OperandX64 dst, OperandX64 src1, OperandX64 src2);
     void vmaxsd(OperandX64 dst, OperandX64 src1, OperandX64 src2);
     void vmaxss(OperandX64 dst, OperandX64 src1, OperandX64 src2);
     void vminps(OperandX64 dst, OperandX64 src1, OperandX64 src2);
+    void vminpd(OperandX64 dst, OperandX64 src1, OperandX64 src2);
     void vminsd(OperandX64 dst, OperandX64 src1, OperandX64 src2);
     void vminss(OperandX64 dst, OperandX64 src1, OperandX64 src2);
 
@@ -295,6 +302,7 @@ private:
     void placeRexNoW(OperandX64 op);
     void placeRex(RegisterX64 lhs, OperandX64 rhs);
     void placeVex(OperandX64 dst, OperandX64 src1, OperandX64 src2, bool setW, uint8_t mode, uint8_t prefix);
+    void placeVex(OperandX64 dst, OperandX64 src1, OperandX64 src2, bool setW, uint8_t mode, uint8_t prefix, SizeX64 vectorSize);
     void placeImm8Or32(int32_t imm);
     void placeImm8(int32_t imm);
     void placeImm16(int16_t imm);
@@ -3,6 +3,7 @@
 
 #include "Luau/CodeGenCommon.h"
 #include "Luau/Bytecode.h"
+#include "Luau/DenseHash.h"
 
 #include <string>
 #include <vector>
@@ -67,6 +68,24 @@ public:
         return counts[nesting];
     }
 
+    // Pairs of instructions that follow each other in the same basic block, keyed by (first << 8) | second
+    void incPairCount(uint8_t first, uint8_t second)
+    {
+        CODEGEN_ASSERT(first < getOpLimit() && second < getOpLimit());
+        ++pairCounts[uint16_t((first << 8) | second)];
+    }
+
+    unsigned getPairCount(uint8_t first, uint8_t second) const
+    {
+        const unsigned* count = pairCounts.find(uint16_t((first << 8) | second));
+        return count ? *count : 0;
+    }
+
+    const DenseHashMap<uint16_t, unsigned>& getPairCounts() const
+    {
+        return pairCounts;
+    }
+
     static FunctionBytecodeSummary fromProto(Proto* proto, unsigned nestingLimit);
 
 private:
@@ -75,6 +94,7 @@ private:
     int line;
     unsigned nestingLimit;
     std::vector<std::vector<unsigned>> counts;
+    DenseHashMap<uint16_t, unsigned> pairCounts{0xffff};
 };
 
 std::vector<FunctionBytecodeSummary> summarizeBytecode(lua_State* L, int idx, unsigned nestingLimit);
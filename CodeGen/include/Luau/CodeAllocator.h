@@ -16,6 +16,22 @@ namespace CodeGen
 
 constexpr uint32_t kCodeAlignment = 32;
 
+struct CodeAllocatorStats
+{
+    // Number of currently mapped blocks and their total size
+    size_t blockCount = 0;
+    size_t reservedBytes = 0;
+
+    // Number of live allocations and their total page-aligned size
+    size_t liveAllocations = 0;
+    size_t usedBytes = 0;
+
+    // Space inside mapped blocks that is available for future allocations, including the unused part of the current block
+    size_t freeBytes = 0;
+    size_t freeRangeCount = 0;
+    size_t largestFreeRange = 0;
+};
+
 struct CodeAllocator
 {
     CodeAllocator(size_t blockSize, size_t maxTotalSize);
@@ -29,8 +45,12 @@ struct CodeAllocator
 
     // Marks executable page area as no longer executable
     // Freed allocation area can be reused for future allocations
+    // Blocks that no longer have any live allocations are unmapped together with their unwind information
     void deallocate(CodeAllocationData codeAllocationData);
 
+    // Reports block usage and fragmentation of the free space
+    CodeAllocatorStats getStats() const;
+
     // Provided to unwind info callbacks
     void* context = nullptr;
 
@@ -49,22 +69,53 @@ private:
     // But to simplify block space checks, we limit the max size of all that data
     static const size_t kMaxReservedDataSize = 256;
 
+    struct FreeRange
+    {
+        uint8_t* start = nullptr;
+        size_t size = 0;
+    };
+
+    struct Block
+    {
+        uint8_t* start = nullptr;
+        void* unwindInfo = nullptr;
+
+        // Space at the beginning of the block that is occupied by unwind information
+        size_t reservedSize = 0;
+
+        size_t liveAllocations = 0;
+
+        // Page-aligned ranges that were freed and can be reused, sorted by address and coalesced
+        std::vector<FreeRange> freeRanges;
+    };
+
     bool allocateNewBlock(size_t& unwindInfoSize);
 
+    // Selects a free range or a new block that can fit the allocation as the current allocation area
+    bool allocateRegion(size_t dataSize, size_t codeSize);
+
+    Block* findBlock(uint8_t* ptr);
+    void releaseBlock(Block& block);
+    void addFreeRange(Block& block, uint8_t* start, size_t size);
+
     uint8_t* allocatePages(size_t size) const;
     void freePages(uint8_t* mem, size_t size) const;
 
-    // Current block we use for allocations
+    // Current area we use for allocations
     uint8_t* blockPos = nullptr;
     uint8_t* blockEnd = nullptr;
 
+    // Block that contains the current area and the space reserved at the start of the area
+    uint8_t* regionBlock = nullptr;
+    size_t regionStartOffset = 0;
+
     // All allocated blocks
-    std::vector<uint8_t*> blocks;
-    std::vector<void*> unwindInfos;
+    std::vector<Block> blocks;
 
     size_t blockSize = 0;
     size_t maxTotalSize = 0;
     size_t liveAllocations = 0;
+    size_t liveBytes = 0;
 
     AllocationCallback* allocationCallback = nullptr;
     void* allocationCallbackContext = nullptr;
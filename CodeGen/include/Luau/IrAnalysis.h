@@ -53,6 +53,23 @@ struct BlockOrdering
     bool visited = false;
 };
 
+// Natural loop is formed by all blocks that can reach a back edge source without going through the loop header
+// Back edge is an edge to the block that dominates the edge source
+struct CfgLoop
+{
+    uint32_t header = ~0u;
+
+    // Sources of the back edges into the header
+    std::vector<uint32_t> latches;
+
+    // Sorted list of all loop blocks, including the header and blocks of the nested loops
+    std::vector<uint32_t> blocks;
+
+    // VM registers that might be written by any block of the loop
+    // Unlike block 'def' sets, variadic sequences that are consumed inside the loop are also included
+    RegisterSet written;
+};
+
 struct CfgInfo
 {
     std::vector<uint32_t> predecessors;
@@ -91,6 +108,9 @@ struct CfgInfo
     // VM registers defined in any block
     // Lowest variadic sequence start is stored to mark variadic writes
     RegisterSet written;
+
+    // Natural loops of the function, outer loops come before the loops nested inside of them
+    std::vector<CfgLoop> loops;
 };
 
 // Calculate lists of block predecessors and successors
@@ -151,6 +171,16 @@ void computeIteratedDominanceFrontierForDefs(
     const std::vector<uint32_t>& liveInBlocks
 );
 
+// Check if block 'a' dominates block 'b' using the dominator tree ordering
+bool dominates(const CfgInfo& cfg, uint32_t a, uint32_t b);
+
+// Find natural loops and the VM registers which are written inside of them
+// Requires dominator tree to be computed
+void computeCfgLoops(IrFunction& function);
+
+// Returns loop information if the block is a natural loop header
+const CfgLoop* findLoopByHeader(const CfgInfo& cfg, uint32_t blockIdx);
+
 // Function used to update all CFG data
 void computeCfgInfo(IrFunction& function);
 
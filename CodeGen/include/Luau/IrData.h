@@ -356,6 +356,18 @@ enum class IrCmd : uint8_t
     // B: int (0-3 index)
     EXTRACT_VEC,
 
+    // Add/Sub/Mul/Div two pairs of double values lanewise
+    // Pairs are only formed by the x64 buffer access vectorizer
+    // A, B: TValue (pair of doubles)
+    ADD_NUMX2,
+    SUB_NUMX2,
+    MUL_NUMX2,
+    DIV_NUMX2,
+
+    // Put the same double value into both lanes of a pair
+    // A: double
+    NUM_TO_NUMX2,
+
     // Compute Luau 'not' operation on destructured TValue
     // A: tag
     // B: int (value)
@@ -611,6 +623,19 @@ enum class IrCmd : uint8_t
     // Note: all referenced registers might be modified in the operation
     CONCAT,
 
+    // Append multiple TValues to a value, accumulating the result in a string buffer
+    // A: Rn (initial value)
+    // B: Rn (value start, the first register is used as scratch)
+    // C: unsigned int (number of registers to go over)
+    // D: Rn (buffer start, two registers)
+    // Note: all referenced registers except for 'A' might be modified in the operation
+    CONCAT_APPEND,
+
+    // Store the value accumulated in a string buffer into a register and reset the buffer
+    // A: Rn (target)
+    // B: Rn (buffer start, two registers)
+    CONCAT_FLUSH,
+
     // Load function upvalue
     // A: UPn
     GET_UPVALUE,
@@ -661,6 +686,12 @@ enum class IrCmd : uint8_t
     // When undef is specified instead of a block, execution is aborted on check failure
     CHECK_ARRAY_SIZE,
 
+    // Guard against table having a typed array part
+    // A: pointer (LuaTable)
+    // B: block/vmexit/undef
+    // When undef is specified instead of a block, execution is aborted on check failure
+    CHECK_NO_TYPED_ARRAY,
+
     // Guard against cached table node slot not matching the actual table node slot for a key
     // A: pointer (LuaNode)
     // B: Kn
@@ -1040,6 +1071,28 @@ enum class IrCmd : uint8_t
     // C: int64 (value)
     BUFFER_WRITEI64,
 
+    // Read two consecutive double values from buffer storage at specified offset as a pair
+    // A: pointer (buffer)
+    // B: int (offset)
+    BUFFER_READF64X2,
+
+    // Write a pair of double values to buffer storage at specified offset
+    // A: pointer (buffer)
+    // B: int (offset)
+    // C: TValue (pair of doubles)
+    BUFFER_WRITEF64X2,
+
+    // Read two consecutive float values from buffer storage at specified offset as a pair of doubles
+    // A: pointer (buffer)
+    // B: int (offset)
+    BUFFER_READF32X2,
+
+    // Write a pair of double values to buffer storage at specified offset as two consecutive float values
+    // A: pointer (buffer)
+    // B: int (offset)
+    // C: TValue (pair of doubles)
+    BUFFER_WRITEF32X2,
+
     // Perform a conditional jump based on the result of Proto ID comparison
     // A: closure pointer
     // B: protoid
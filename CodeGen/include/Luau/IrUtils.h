@@ -64,6 +64,7 @@ inline bool isNonTerminatingJump(IrCmd cmd)
     case IrCmd::CHECK_NO_METATABLE:
     case IrCmd::CHECK_SAFE_ENV:
     case IrCmd::CHECK_ARRAY_SIZE:
+    case IrCmd::CHECK_NO_TYPED_ARRAY:
     case IrCmd::CHECK_SLOT_MATCH:
     case IrCmd::CHECK_NODE_NO_NEXT:
     case IrCmd::CHECK_NODE_VALUE:
@@ -96,6 +97,7 @@ inline bool canInvalidateSafeEnv(IrCmd cmd)
     case IrCmd::GET_TABLE:
     case IrCmd::SET_TABLE:
     case IrCmd::CONCAT: // TODO: if only strings and numbers are concatenated, there will be no user calls
+    case IrCmd::CONCAT_APPEND:
     case IrCmd::CALL:
     case IrCmd::FORGLOOP_FALLBACK:
     case IrCmd::FALLBACK_GETGLOBAL:
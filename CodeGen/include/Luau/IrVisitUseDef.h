@@ -81,6 +81,23 @@ static void visitVmRegDefsUses(T& visitor, IrFunction& function, IrInst& inst)
 
         visitor.defRange(vmRegOp(OP_A(inst)), function.uintOp(OP_B(inst)));
         break;
+    case IrCmd::CONCAT_APPEND:
+        // first register of the range is scratch space, only the pieces after it are read
+        visitor.use(OP_A(inst));
+        visitor.useRange(vmRegOp(OP_B(inst)) + 1, function.uintOp(OP_C(inst)) - 1);
+        visitor.useRange(vmRegOp(OP_D(inst)), 2);
+
+        visitor.defRange(vmRegOp(OP_B(inst)), function.uintOp(OP_C(inst)));
+        visitor.defRange(vmRegOp(OP_D(inst)), 2);
+        break;
+    case IrCmd::CONCAT_FLUSH:
+        // target keeps its value when nothing was appended
+        visitor.use(OP_A(inst));
+        visitor.useRange(vmRegOp(OP_B(inst)), 2);
+
+        visitor.def(OP_A(inst));
+        visitor.defRange(vmRegOp(OP_B(inst)), 2);
+        break;
     case IrCmd::GET_UPVALUE:
         break;
     case IrCmd::SET_UPVALUE:
@@ -9,6 +9,7 @@ namespace CodeGen
 {
 
 void optimizeMemoryOperandsX64(IrFunction& function);
+void vectorizeBufferAccessesX64(IrFunction& function);
 
 } // namespace CodeGen
 } // namespace Luau
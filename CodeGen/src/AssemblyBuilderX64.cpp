@@ -779,6 +779,11 @@ void AssemblyBuilderX64::vsubps(OperandX64 dst, OperandX64 src1, OperandX64 src2
     placeAvx("vsubps", dst, src1, src2, 0x5c, false, AVX_0F, AVX_NP);
 }
 
+void AssemblyBuilderX64::vsubpd(OperandX64 dst, OperandX64 src1, OperandX64 src2)
+{
+    placeAvx("vsubpd", dst, src1, src2, 0x5c, false, AVX_0F, AVX_66);
+}
+
 void AssemblyBuilderX64::vmulsd(OperandX64 dst, OperandX64 src1, OperandX64 src2)
 {
     placeAvx("vmulsd", dst, src1, src2, 0x59, false, AVX_0F, AVX_F2);
@@ -794,6 +799,11 @@ void AssemblyBuilderX64::vmulps(OperandX64 dst, OperandX64 src1, OperandX64 src2
     placeAvx("vmulps", dst, src1, src2, 0x59, false, AVX_0F, AVX_NP);
 }
 
+void AssemblyBuilderX64::vmulpd(OperandX64 dst, OperandX64 src1, OperandX64 src2)
+{
+    placeAvx("vmulpd", dst, src1, src2, 0x59, false, AVX_0F, AVX_66);
+}
+
 void AssemblyBuilderX64::vdivsd(OperandX64 dst, OperandX64 src1, OperandX64 src2)
 {
     placeAvx("vdivsd", dst, src1, src2, 0x5e, false, AVX_0F, AVX_F2);
@@ -809,6 +819,11 @@ void AssemblyBuilderX64::vdivps(OperandX64 dst, OperandX64 src1, OperandX64 src2
     placeAvx("vdivps", dst, src1, src2, 0x5e, false, AVX_0F, AVX_NP);
 }
 
+void AssemblyBuilderX64::vdivpd(OperandX64 dst, OperandX64 src1, OperandX64 src2)
+{
+    placeAvx("vdivpd", dst, src1, src2, 0x5e, false, AVX_0F, AVX_66);
+}
+
 void AssemblyBuilderX64::vandps(OperandX64 dst, OperandX64 src1, OperandX64 src2)
 {
     placeAvx("vandps", dst, src1, src2, 0x54, false, AVX_0F, AVX_NP);
@@ -889,6 +904,35 @@ void AssemblyBuilderX64::vcvtss2sd(OperandX64 dst, OperandX64 src1, OperandX64 s
     placeAvx("vcvtss2sd", dst, src1, src2, 0x5a, false, AVX_0F, AVX_F3);
 }
 
+void AssemblyBuilderX64::vcvtps2pd(OperandX64 dst, OperandX64 src)
+{
+    if (src.cat == CategoryX64::reg)
+        CODEGEN_ASSERT(src.base.size == SizeX64::xmmword);
+    else
+        CODEGEN_ASSERT(src.memSize == (dst.base.size == SizeX64::ymmword ? SizeX64::xmmword : SizeX64::qword));
+
+    placeAvx("vcvtps2pd", dst, src, 0x5a, false, AVX_0F, AVX_NP);
+}
+
+void AssemblyBuilderX64::vcvtpd2ps(OperandX64 dst, OperandX64 src)
+{
+    CODEGEN_ASSERT(dst.cat == CategoryX64::reg && dst.base.size == SizeX64::xmmword);
+    CODEGEN_ASSERT(src.cat == CategoryX64::reg || src.cat == CategoryX64::mem);
+
+    // 'placeAvx' wrapper takes vector length from the destination, but here it is defined by the source
+    SizeX64 srcSize = src.cat == CategoryX64::reg ? src.base.size : src.memSize;
+    CODEGEN_ASSERT(srcSize == SizeX64::xmmword || srcSize == SizeX64::ymmword);
+
+    if (logText)
+        log("vcvtpd2ps", dst, src);
+
+    placeVex(dst, noreg, src, false, AVX_0F, AVX_66, srcSize);
+    place(0x5a);
+    placeRegAndModRegMem(dst, src);
+
+    commit();
+}
+
 void AssemblyBuilderX64::vroundsd(OperandX64 dst, OperandX64 src1, OperandX64 src2, RoundingModeX64 roundingMode)
 {
     placeAvx("vroundsd", dst, src1, src2, uint8_t(roundingMode) | kRoundingPrecisionInexact, 0x0b, false, AVX_0F3A, AVX_66);
@@ -998,6 +1042,11 @@ void AssemblyBuilderX64::vmaxps(OperandX64 dst, OperandX64 src1, OperandX64 src2
     placeAvx("vmaxps", dst, src1, src2, 0x5f, false, AVX_0F, AVX_NP);
 }
 
+void AssemblyBuilderX64::vmaxpd(OperandX64 dst, OperandX64 src1, OperandX64 src2)
+{
+    placeAvx("vmaxpd", dst, src1, src2, 0x5f, false, AVX_0F, AVX_66);
+}
+
 void AssemblyBuilderX64::vmaxsd(OperandX64 dst, OperandX64 src1, OperandX64 src2)
 {
     placeAvx("vmaxsd", dst, src1, src2, 0x5f, false, AVX_0F, AVX_F2);
@@ -1013,6 +1062,11 @@ void AssemblyBuilderX64::vminps(OperandX64 dst, OperandX64 src1, OperandX64 src2
     placeAvx("vminps", dst, src1, src2, 0x5d, false, AVX_0F, AVX_NP);
 }
 
+void AssemblyBuilderX64::vminpd(OperandX64 dst, OperandX64 src1, OperandX64 src2)
+{
+    placeAvx("vminpd", dst, src1, src2, 0x5d, false, AVX_0F, AVX_66);
+}
+
 void AssemblyBuilderX64::vminsd(OperandX64 dst, OperandX64 src1, OperandX64 src2)
 {
     placeAvx("vminsd", dst, src1, src2, 0x5d, false, AVX_0F, AVX_F2);
@@ -1596,6 +1650,11 @@ void AssemblyBuilderX64::placeRex(RegisterX64 lhs, OperandX64 rhs)
 }
 
 void AssemblyBuilderX64::placeVex(OperandX64 dst, OperandX64 src1, OperandX64 src2, bool setW, uint8_t mode, uint8_t prefix)
+{
+    placeVex(dst, src1, src2, setW, mode, prefix, dst.base.size);
+}
+
+void AssemblyBuilderX64::placeVex(OperandX64 dst, OperandX64 src1, OperandX64 src2, bool setW, uint8_t mode, uint8_t prefix, SizeX64 vectorSize)
 {
     CODEGEN_ASSERT(dst.cat == CategoryX64::reg);
     CODEGEN_ASSERT(src1.cat == CategoryX64::reg);
@@ -1603,7 +1662,7 @@ void AssemblyBuilderX64::placeVex(OperandX64 dst, OperandX64 src1, OperandX64 sr
 
     place(AVX_3_1());
     place(AVX_3_2(dst.base, src2.index, src2.base, mode));
-    place(AVX_3_3(setW, src1.base, dst.base.size == SizeX64::ymmword, prefix));
+    place(AVX_3_3(setW, src1.base, vectorSize == SizeX64::ymmword, prefix));
 }
 
 static uint8_t getScaleEncoding(uint8_t scale)
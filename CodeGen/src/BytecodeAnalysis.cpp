@@ -518,6 +518,27 @@ static void applyBuiltinCall(LuauBuiltinFunction bfid, BytecodeTypes& types)
         types.b = LBC_TYPE_NUMBER;
         types.c = LBC_TYPE_INTEGER;
         break;
+    case LBF_BUFFER_FIND:
+        types.result = LBC_TYPE_ANY;
+        types.a = LBC_TYPE_BUFFER;
+        types.b = LBC_TYPE_NUMBER;
+        break;
+    case LBF_BUFFER_COMPARE:
+        types.result = LBC_TYPE_NUMBER;
+        types.a = LBC_TYPE_BUFFER;
+        types.b = LBC_TYPE_NUMBER;
+        types.c = LBC_TYPE_BUFFER;
+        break;
+    case LBF_BUFFER_EQUAL:
+        types.result = LBC_TYPE_BOOLEAN;
+        types.a = LBC_TYPE_BUFFER;
+        types.b = LBC_TYPE_NUMBER;
+        types.c = LBC_TYPE_BUFFER;
+        break;
+    case LBF_BUFFER_HASH:
+        types.result = LBC_TYPE_NUMBER;
+        types.a = LBC_TYPE_BUFFER;
+        break;
     case LBF_TABLE_INSERT:
         types.result = LBC_TYPE_NIL;
         types.a = LBC_TYPE_TABLE;
@@ -876,6 +897,23 @@ void analyzeBytecodeTypes(IrFunction& function, const HostIrHooks& hostHooks)
                 refineRegType(bcTypeInfo, ra, i, bcType.result);
                 break;
             }
+            case LOP_MOVE2:
+            {
+                int ra = LUAU_INSN_A(*pc);
+                int rb = LUAU_INSN_B(*pc);
+                int rc = LUAU_INSN_C(*pc);
+                bcType.a = getRegTag(regTags, bcTypeInfo, rb, i);
+                regTags[ra] = bcType.a;
+                refineRegType(bcTypeInfo, ra, i, regTags[ra]);
+
+                // second copy reads its source after the first one is written
+                bcType.b = getRegTag(regTags, bcTypeInfo, rc, i);
+                regTags[ra + 1] = bcType.b;
+                bcType.result = regTags[ra + 1];
+
+                refineRegType(bcTypeInfo, ra + 1, i, bcType.result);
+                break;
+            }
             case LOP_GETTABLE:
             {
                 int ra = LUAU_INSN_A(*pc);
@@ -1342,6 +1380,32 @@ void analyzeBytecodeTypes(IrFunction& function, const HostIrHooks& hostHooks)
                 bcType.result = regTags[ra];
                 break;
             }
+            case LOP_CONCATAPPEND:
+            {
+                int rb = LUAU_INSN_B(*pc);
+                int rc = LUAU_INSN_C(*pc);
+                int buf = pc[1];
+
+                // values that can't be buffered are concatenated through metamethods
+                for (int r = rb; r <= rc; r++)
+                    regTags[r] = LBC_TYPE_ANY;
+
+                regTags[buf] = LBC_TYPE_ANY;
+                regTags[buf + 1] = LBC_TYPE_ANY;
+                break;
+            }
+            case LOP_CONCATFLUSH:
+            {
+                int ra = LUAU_INSN_A(*pc);
+                int buf = LUAU_INSN_B(*pc);
+
+                // accumulated value is a string unless it was produced by a metamethod
+                regTags[ra] = LBC_TYPE_ANY;
+                regTags[buf] = LBC_TYPE_ANY;
+                regTags[buf + 1] = LBC_TYPE_ANY;
+                bcType.result = regTags[ra];
+                break;
+            }
             case LOP_NEWCLOSURE:
             case LOP_DUPCLOSURE:
             {
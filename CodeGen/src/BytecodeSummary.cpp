@@ -39,11 +39,34 @@ FunctionBytecodeSummary FunctionBytecodeSummary::fromProto(Proto* proto, unsigne
 
     FunctionBytecodeSummary summary(source, name, line, nestingLimit);
 
+    std::vector<bool> jumpTargets(proto->sizecode + 1);
+
     for (int i = 0; i < proto->sizecode;)
     {
         Instruction insn = proto->code[i];
         uint8_t op = LUAU_INSN_OP(insn);
         summary.incCount(0, op);
+
+        int target = getJumpTarget(insn, i);
+        if (target >= 0 && target <= proto->sizecode)
+            jumpTargets[target] = true;
+
+        i += getOpLength(LuauOpcode(op));
+    }
+
+    // instruction pairs are only counted when the second instruction is always reached from the first one
+    int prev = -1;
+
+    for (int i = 0; i < proto->sizecode;)
+    {
+        uint8_t op = LUAU_INSN_OP(proto->code[i]);
+
+        if (prev >= 0 && !jumpTargets[i])
+            summary.incPairCount(uint8_t(prev), op);
+
+        bool terminator = op == LOP_JUMP || op == LOP_JUMPBACK || op == LOP_JUMPX || op == LOP_RETURN;
+        prev = terminator ? -1 : op;
+
         i += getOpLength(LuauOpcode(op));
     }
 
@@ -3,9 +3,12 @@
 
 #include "Luau/CodeGenCommon.h"
 
+#include <algorithm>
+
 #include <string.h>
 
 LUAU_FASTFLAGVARIABLE(LuauCodegenProtectData)
+LUAU_FASTFLAGVARIABLE(LuauCodegenReclaimCode)
 
 #if defined(_WIN32)
 
@@ -151,6 +154,22 @@ size_t CodeAllocator::alignToPageSize(size_t size)
     return (size + kPageSize - 1) & ~(kPageSize - 1);
 }
 
+// Size of the area required to place the data and code after 'startOffset' reserved bytes
+static size_t getRequiredSize(size_t startOffset, size_t dataSize, size_t codeSize)
+{
+    if (FFlag::LuauCodegenProtectData)
+    {
+        if (dataSize != 0)
+            return CodeAllocator::alignToPageSize(startOffset + dataSize) + codeSize;
+
+        return startOffset + codeSize;
+    }
+
+    size_t alignedDataSize = (dataSize + (kCodeAlignment - 1)) & ~(kCodeAlignment - 1);
+
+    return startOffset + alignedDataSize + codeSize;
+}
+
 CodeAllocator::CodeAllocator(size_t blockSize, size_t maxTotalSize)
     : CodeAllocator(blockSize, maxTotalSize, nullptr, nullptr)
 {
@@ -170,14 +189,17 @@ CodeAllocator::~CodeAllocator()
 {
     if (destroyBlockUnwindInfo)
     {
-        for (void* unwindInfo : unwindInfos)
-            destroyBlockUnwindInfo(context, unwindInfo);
+        for (Block& block : blocks)
+        {
+            if (block.unwindInfo)
+                destroyBlockUnwindInfo(context, block.unwindInfo);
+        }
     }
 
     CODEGEN_ASSERT(liveAllocations == 0);
 
-    for (uint8_t* block : blocks)
-        freePages(block, blockSize);
+    for (Block& block : blocks)
+        freePages(block.start, blockSize);
 }
 
 CodeAllocationData CodeAllocator::allocate(const uint8_t* data, size_t dataSize, const uint8_t* code, size_t codeSize)
@@ -188,6 +210,23 @@ CodeAllocationData CodeAllocator::allocate(const uint8_t* data, size_t dataSize,
     size_t pageAlignedSize;
     size_t totalSize;
 
+    if (FFlag::LuauCodegenReclaimCode)
+    {
+        // Function has to fit into a single block with unwinding information
+        if (getRequiredSize(kMaxReservedDataSize, dataSize, codeSize) > blockSize)
+            return {};
+
+        // Current area might not have enough space, but there might be a freed range that does
+        if (getRequiredSize(regionStartOffset, dataSize, codeSize) > size_t(blockEnd - blockPos))
+        {
+            if (!allocateRegion(dataSize, codeSize))
+                return {};
+        }
+
+        // Checks below will not request a new block since the area has enough space even with the reserved data
+        startOffset = regionStartOffset;
+    }
+
     if (FFlag::LuauCodegenProtectData)
     {
         if (dataSize != 0)
@@ -290,6 +329,16 @@ CodeAllocationData CodeAllocator::allocate(const uint8_t* data, size_t dataSize,
     }
 
     liveAllocations++;
+    liveBytes += pageAlignedSize;
+
+    if (FFlag::LuauCodegenReclaimCode)
+    {
+        Block* block = findBlock(regionBlock);
+        CODEGEN_ASSERT(block);
+
+        block->liveAllocations++;
+        regionStartOffset = 0;
+    }
 
     flushInstructionCache(blockPos + codeOffset, codeSize);
 
@@ -331,7 +380,93 @@ void CodeAllocator::deallocate(CodeAllocationData codeAllocationData)
     CODEGEN_ASSERT(liveAllocations != 0);
     liveAllocations--;
 
-    // TODO: new allocations should be able to reuse the freed pages (but note that first block page contains unwind data)
+    CODEGEN_ASSERT(liveBytes >= codeAllocationData.allocationSize);
+    liveBytes -= codeAllocationData.allocationSize;
+
+    if (!FFlag::LuauCodegenReclaimCode)
+        return;
+
+    Block* block = findBlock(codeAllocationData.allocationStart);
+    CODEGEN_ASSERT(block);
+
+    CODEGEN_ASSERT(block->liveAllocations != 0);
+    block->liveAllocations--;
+
+    if (block->liveAllocations == 0)
+    {
+        if (block->start == regionBlock)
+        {
+            // Whole block becomes the current area again, first page still contains unwind data
+            block->freeRanges.clear();
+
+            blockPos = block->start;
+            blockEnd = block->start + blockSize;
+            regionStartOffset = block->reservedSize;
+        }
+        else
+        {
+            releaseBlock(*block);
+        }
+
+        return;
+    }
+
+    // Page-aligned allocation size can go past the end of a block that is not a multiple of the page size
+    size_t size = std::min(codeAllocationData.allocationSize, size_t(block->start + blockSize - codeAllocationData.allocationStart));
+
+    addFreeRange(*block, codeAllocationData.allocationStart, size);
+
+    // Free ranges next to the current area extend it
+    if (block->start == regionBlock)
+    {
+        for (size_t i = 0; i < block->freeRanges.size();)
+        {
+            FreeRange range = block->freeRanges[i];
+
+            if (range.start + range.size == blockPos)
+                blockPos = range.start;
+            else if (range.start == blockEnd)
+                blockEnd = range.start + range.size;
+            else
+            {
+                i++;
+                continue;
+            }
+
+            block->freeRanges.erase(block->freeRanges.begin() + i);
+        }
+
+        regionStartOffset = blockPos == block->start ? block->reservedSize : 0;
+    }
+}
+
+CodeAllocatorStats CodeAllocator::getStats() const
+{
+    CodeAllocatorStats stats;
+
+    stats.blockCount = blocks.size();
+    stats.reservedBytes = blocks.size() * blockSize;
+    stats.liveAllocations = liveAllocations;
+    stats.usedBytes = liveBytes;
+
+    for (const Block& block : blocks)
+    {
+        for (const FreeRange& range : block.freeRanges)
+        {
+            stats.freeBytes += range.size;
+            stats.freeRangeCount++;
+            stats.largestFreeRange = std::max(stats.largestFreeRange, range.size);
+        }
+    }
+
+    if (size_t regionSize = size_t(blockEnd - blockPos))
+    {
+        stats.freeBytes += regionSize;
+        stats.freeRangeCount++;
+        stats.largestFreeRange = std::max(stats.largestFreeRange, regionSize);
+    }
+
+    return stats;
 }
 
 bool CodeAllocator::allocateNewBlock(size_t& unwindInfoSize)
@@ -348,7 +483,7 @@ bool CodeAllocator::allocateNewBlock(size_t& unwindInfoSize)
     blockPos = block;
     blockEnd = block + blockSize;
 
-    blocks.push_back(block);
+    blocks.push_back(Block{block});
 
     if (createBlockUnwindInfo)
     {
@@ -362,12 +497,119 @@ bool CodeAllocator::allocateNewBlock(size_t& unwindInfoSize)
         if (!unwindInfo)
             return false;
 
-        unwindInfos.push_back(unwindInfo);
+        blocks.back().unwindInfo = unwindInfo;
+        blocks.back().reservedSize = unwindInfoSize;
     }
 
     return true;
 }
 
+bool CodeAllocator::allocateRegion(size_t dataSize, size_t codeSize)
+{
+    // Unused part of the current area can be picked up later
+    if (Block* block = findBlock(regionBlock); block && blockPos != blockEnd)
+        addFreeRange(*block, blockPos, size_t(blockEnd - blockPos));
+
+    blockPos = nullptr;
+    blockEnd = nullptr;
+    regionBlock = nullptr;
+    regionStartOffset = 0;
+
+    // First fit, ranges that start a block have to skip the unwind information
+    for (Block& block : blocks)
+    {
+        for (size_t i = 0; i < block.freeRanges.size(); i++)
+        {
+            FreeRange range = block.freeRanges[i];
+            size_t startOffset = range.start == block.start ? block.reservedSize : 0;
+
+            if (getRequiredSize(startOffset, dataSize, codeSize) <= range.size)
+            {
+                block.freeRanges.erase(block.freeRanges.begin() + i);
+
+                blockPos = range.start;
+                blockEnd = range.start + range.size;
+                regionBlock = block.start;
+                regionStartOffset = startOffset;
+                return true;
+            }
+        }
+    }
+
+    size_t startOffset = 0;
+
+    if (!allocateNewBlock(startOffset))
+        return false;
+
+    regionBlock = blockPos;
+    regionStartOffset = startOffset;
+
+    CODEGEN_ASSERT(getRequiredSize(startOffset, dataSize, codeSize) <= size_t(blockEnd - blockPos));
+    return true;
+}
+
+CodeAllocator::Block* CodeAllocator::findBlock(uint8_t* ptr)
+{
+    for (Block& block : blocks)
+    {
+        if (ptr >= block.start && ptr < block.start + blockSize)
+            return &block;
+    }
+
+    return nullptr;
+}
+
+void CodeAllocator::releaseBlock(Block& block)
+{
+    CODEGEN_ASSERT(block.liveAllocations == 0);
+    CODEGEN_ASSERT(block.start != regionBlock);
+
+    if (block.unwindInfo && destroyBlockUnwindInfo)
+        destroyBlockUnwindInfo(context, block.unwindInfo);
+
+    freePages(block.start, blockSize);
+
+    blocks.erase(blocks.begin() + (&block - blocks.data()));
+}
+
+void CodeAllocator::addFreeRange(Block& block, uint8_t* start, size_t size)
+{
+    CODEGEN_ASSERT((uintptr_t(start) & (kPageSize - 1)) == 0);
+
+    auto it = std::lower_bound(
+        block.freeRanges.begin(),
+        block.freeRanges.end(),
+        start,
+        [](const FreeRange& range, uint8_t* start)
+        {
+            return range.start < start;
+        }
+    );
+
+    // Merge with the following range
+    if (it != block.freeRanges.end() && start + size == it->start)
+    {
+        it->start = start;
+        it->size += size;
+    }
+    else
+    {
+        it = block.freeRanges.insert(it, FreeRange{start, size});
+    }
+
+    // Merge with the preceding range
+    if (it != block.freeRanges.begin())
+    {
+        auto prev = it - 1;
+
+        if (prev->start + prev->size == it->start)
+        {
+            prev->size += it->size;
+            block.freeRanges.erase(it);
+        }
+    }
+}
+
 uint8_t* CodeAllocator::allocatePages(size_t size) const
 {
     const size_t pageAlignedSize = alignToPageSize(size);
@@ -22,10 +22,12 @@
 #include "lstate.h"
 
 #include <algorithm>
+#include <type_traits>
 #include <vector>
 
 LUAU_FASTFLAG(DebugCodegenOptSize)
 LUAU_FASTFLAG(LuauCodegenSharedLog)
+LUAU_FASTFLAG(LuauCodegenVectorizeBufferOps)
 LUAU_FASTINT(CodegenHeuristicsInstructionLimit)
 LUAU_FASTINT(CodegenHeuristicsBlockLimit)
 LUAU_FASTINT(CodegenHeuristicsBlockInstructionLimit)
@@ -50,6 +52,10 @@ inline void gatherFunctionsHelper(
     if (results[proto->bytecodeid])
         return;
 
+    // functions of lazily loaded chunks that haven't been instantiated yet have no code
+    if (proto->lazychunk)
+        return;
+
     // if native module, compile cold functions if requested
     // if not native module, compile function if it has native attribute and is not root
     bool shouldGather = hasNativeFunctions ? (!root && (proto->flags & LPF_NATIVE_FUNCTION) != 0)
@@ -454,6 +460,13 @@ inline bool lowerFunction(
 
     markDeadStoresInBlockChains(ir);
 
+    // Only x64 lowering supports operations on pairs of doubles
+    if constexpr (std::is_same_v<AssemblyBuilder, X64::AssemblyBuilderX64>)
+    {
+        if (FFlag::LuauCodegenVectorizeBufferOps)
+            vectorizeBufferAccessesX64(ir.function);
+    }
+
     // Recompute the CFG predecessors/successors to match block uses after optimizations
     computeCfgBlockEdges(ir.function);
 
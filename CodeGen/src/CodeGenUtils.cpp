@@ -21,6 +21,7 @@
 LUAU_FASTFLAG(LuauDirectFieldGet)
 LUAU_FASTFLAG(LuauCIProto)
 LUAU_FASTFLAG(LuauPromoteProto)
+LUAU_FASTFLAG(LuauTableBulkCopy)
 
 // All external function calls that can cause stack realloc or Lua calls have to be wrapped in VM_PROTECT
 // This makes sure that we save the pc (in case the Lua call needs to generate a backtrace) before the call,
@@ -65,8 +66,51 @@ namespace Luau
 namespace CodeGen
 {
 
+static bool forgLoopTypedIter(lua_State* L, LuaTable* h, int index, TValue* ra)
+{
+    LuaTypedArray* ta = h->typedarray;
+
+    // typed array part has no holes before its size
+    if (unsigned(index) < unsigned(ta->size))
+    {
+        setpvalue(ra + 2, reinterpret_cast<void*>(uintptr_t(index + 1)), LU_TAG_ITERATOR);
+        setnvalue(ra + 3, double(index + 1));
+        setnvalue(ra + 4, ta->data[index]);
+
+        return true;
+    }
+
+    int sizearray = ta->capacity;
+    int sizenode = 1 << h->lsizenode;
+
+    if (unsigned(index) < unsigned(sizearray))
+        index = sizearray;
+
+    // hash elements are numbered after the capacity of the typed array part
+    while (unsigned(index - sizearray) < unsigned(sizenode))
+    {
+        LuaNode* n = &h->node[index - sizearray];
+
+        if (!ttisnil(gval(n)))
+        {
+            setpvalue(ra + 2, reinterpret_cast<void*>(uintptr_t(index + 1)), LU_TAG_ITERATOR);
+            getnodekey(L, ra + 3, n);
+            setobj(L, ra + 4, gval(n));
+
+            return true;
+        }
+
+        index++;
+    }
+
+    return false;
+}
+
 bool forgLoopTableIter(lua_State* L, LuaTable* h, int index, TValue* ra)
 {
+    if (LUAU_UNLIKELY(hastypedarray(h)))
+        return forgLoopTypedIter(L, h, index, ra);
+
     int sizearray = h->sizearray;
 
     // first we advance index through the array portion
@@ -110,6 +154,10 @@ bool forgLoopTableIter(lua_State* L, LuaTable* h, int index, TValue* ra)
 
 bool forgLoopNodeIter(lua_State* L, LuaTable* h, int index, TValue* ra)
 {
+    // inline array iteration doesn't visit the typed array part since its 'sizearray' is 0
+    if (LUAU_UNLIKELY(hastypedarray(h)))
+        return forgLoopTypedIter(L, h, index, ra);
+
     int sizearray = h->sizearray;
     int sizenode = 1 << h->lsizenode;
 
@@ -754,8 +802,17 @@ const Instruction* executeSETLIST(lua_State* L, const Instruction* pc, StkId bas
 
     TValue* array = h->array;
 
-    for (int i = 0; i < c; ++i)
-        setobj2t(L, &array[index + i - 1], rb + i);
+    if (FFlag::LuauTableBulkCopy)
+    {
+        // registers and array slots share the TValue layout, so the batch is copied at once; the barrier below covers all of it
+        if (c > 0)
+            memcpy(&array[index - 1], rb, c * sizeof(TValue));
+    }
+    else
+    {
+        for (int i = 0; i < c; ++i)
+            setobj2t(L, &array[index + i - 1], rb + i);
+    }
 
     luaC_barrierfast(L, h);
     return pc;
@@ -858,6 +915,10 @@ const Instruction* executeDUPCLOSURE(lua_State* L, const Instruction* pc, StkId
 
     VM_PROTECT_PC(); // luaF_newLclosure may fail due to OOM
 
+    // closure constants of lazily loaded chunks are created before their function is decoded
+    if (kcl->l.p->lazychunk)
+        luaV_loadproto(L, kcl->l.p, kcl->env);
+
     // clone closure if the environment is not shared
     // note: we save closure to stack early in case the code below wants to capture it by value
     Closure* ncl = (kcl->env == cl->env) ? kcl : luaF_newLclosure(L, kcl->nupvalues, cl->env, FFlag::LuauCIProto ? getproto(kcl) : kcl->l.p);
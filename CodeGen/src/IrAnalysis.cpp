@@ -882,12 +882,172 @@ void computeIteratedDominanceFrontierForDefs(
     }
 }
 
+bool dominates(const CfgInfo& cfg, uint32_t a, uint32_t b)
+{
+    CODEGEN_ASSERT(a < cfg.domOrdering.size() && b < cfg.domOrdering.size());
+
+    const BlockOrdering& aOrdering = cfg.domOrdering[a];
+    const BlockOrdering& bOrdering = cfg.domOrdering[b];
+
+    // Unreachable blocks are not a part of the dominator tree
+    if (!aOrdering.visited || !bOrdering.visited)
+        return false;
+
+    // Dominator tree subtree of 'a' is visited after 'a' is entered and before it's exited
+    return aOrdering.preOrder <= bOrdering.preOrder && aOrdering.postOrder >= bOrdering.postOrder;
+}
+
+struct LoopVmRegWriteCollector
+{
+    LoopVmRegWriteCollector(RegisterSet& written)
+        : written(written)
+    {
+    }
+
+    RegisterSet& written;
+
+    void def(IrOp op, int offset = 0)
+    {
+        written.regs.set(vmRegOp(op) + offset, true);
+    }
+
+    void use(IrOp op, int offset = 0) {}
+
+    void maybeDef(IrOp op)
+    {
+        if (op.kind == IrOpKind::VmReg)
+            written.regs.set(vmRegOp(op), true);
+    }
+
+    void maybeUse(IrOp op) {}
+
+    void useVarargs(uint8_t varargStart) {}
+
+    void defRange(int start, int count)
+    {
+        if (count == -1)
+        {
+            // Variadic sequence is recorded even if it's consumed later in the loop
+            if (!written.varargSeq || start < written.varargStart)
+                written.varargStart = uint8_t(start);
+
+            written.varargSeq = true;
+        }
+        else
+        {
+            for (int i = start; i < start + count; i++)
+                written.regs.set(i, true);
+        }
+    }
+
+    void useRange(int start, int count) {}
+
+    void capture(int reg) {}
+};
+
+void computeCfgLoops(IrFunction& function)
+{
+    CfgInfo& info = function.cfg;
+
+    CODEGEN_ASSERT(info.domOrdering.size() == function.blocks.size());
+
+    // Clear existing data
+    info.loops.clear();
+
+    std::vector<uint8_t> inLoop(function.blocks.size(), false);
+    std::vector<uint32_t> worklist;
+
+    for (size_t headerIdx = 0; headerIdx < function.blocks.size(); headerIdx++)
+    {
+        if (function.blocks[headerIdx].kind == IrBlockKind::Dead)
+            continue;
+
+        CfgLoop loop;
+
+        for (uint32_t predIdx : predecessors(info, uint32_t(headerIdx)))
+        {
+            if (dominates(info, uint32_t(headerIdx), predIdx))
+                loop.latches.push_back(predIdx);
+        }
+
+        if (loop.latches.empty())
+            continue;
+
+        loop.header = uint32_t(headerIdx);
+
+        // Loop body is collected by walking predecessors from the latches until we reach the header
+        inLoop[headerIdx] = true;
+        loop.blocks.push_back(uint32_t(headerIdx));
+
+        for (uint32_t latchIdx : loop.latches)
+        {
+            if (!inLoop[latchIdx])
+            {
+                inLoop[latchIdx] = true;
+                loop.blocks.push_back(latchIdx);
+                worklist.push_back(latchIdx);
+            }
+        }
+
+        while (!worklist.empty())
+        {
+            uint32_t blockIdx = worklist.back();
+            worklist.pop_back();
+
+            for (uint32_t predIdx : predecessors(info, blockIdx))
+            {
+                // Unreachable blocks can jump into the loop, but they are not a part of it
+                if (inLoop[predIdx] || !info.domOrdering[predIdx].visited)
+                    continue;
+
+                inLoop[predIdx] = true;
+                loop.blocks.push_back(predIdx);
+                worklist.push_back(predIdx);
+            }
+        }
+
+        for (uint32_t blockIdx : loop.blocks)
+            inLoop[blockIdx] = false;
+
+        std::sort(loop.blocks.begin(), loop.blocks.end());
+
+        LoopVmRegWriteCollector visitor(loop.written);
+
+        for (uint32_t blockIdx : loop.blocks)
+            visitVmRegDefsUses(visitor, function, function.blocks[blockIdx]);
+
+        info.loops.push_back(std::move(loop));
+    }
+
+    // Outer loop header dominates the headers of nested loops, so it comes first in the dominator tree pre-order
+    std::sort(
+        info.loops.begin(),
+        info.loops.end(),
+        [&](const CfgLoop& a, const CfgLoop& b)
+        {
+            return info.domOrdering[a.header].preOrder < info.domOrdering[b.header].preOrder;
+        }
+    );
+}
+
+const CfgLoop* findLoopByHeader(const CfgInfo& cfg, uint32_t blockIdx)
+{
+    for (const CfgLoop& loop : cfg.loops)
+    {
+        if (loop.header == blockIdx)
+            return &loop;
+    }
+
+    return nullptr;
+}
+
 void computeCfgInfo(IrFunction& function)
 {
     computeCfgBlockEdges(function);
     computeCfgImmediateDominators(function);
     computeCfgDominanceTreeChildren(function);
     computeCfgLiveInOutRegSets(function);
+    computeCfgLoops(function);
 }
 
 BlockIteratorWrapper predecessors(const CfgInfo& cfg, uint32_t blockIdx)
@@ -319,6 +319,9 @@ void IrBuilder::translateInst(LuauOpcode op, const Instruction* pc, int i)
     case LOP_MOVE:
         translateInstMove(*this, pc);
         break;
+    case LOP_MOVE2:
+        translateInstMove2(*this, pc);
+        break;
     case LOP_GETGLOBAL:
         translateInstGetGlobal(*this, pc, i);
         break;
@@ -629,6 +632,12 @@ void IrBuilder::translateInst(LuauOpcode op, const Instruction* pc, int i)
     case LOP_CONCAT:
         translateInstConcat(*this, pc, i);
         break;
+    case LOP_CONCATAPPEND:
+        translateInstConcatAppend(*this, pc, i);
+        break;
+    case LOP_CONCATFLUSH:
+        translateInstConcatFlush(*this, pc, i);
+        break;
     case LOP_CAPTURE:
         translateInstCapture(*this, pc, i);
         break;
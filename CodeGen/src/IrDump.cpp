@@ -263,6 +263,16 @@ const char* getCmdName(IrCmd cmd)
         return "DOT_VEC";
     case IrCmd::EXTRACT_VEC:
         return "EXTRACT_VEC";
+    case IrCmd::ADD_NUMX2:
+        return "ADD_NUMX2";
+    case IrCmd::SUB_NUMX2:
+        return "SUB_NUMX2";
+    case IrCmd::MUL_NUMX2:
+        return "MUL_NUMX2";
+    case IrCmd::DIV_NUMX2:
+        return "DIV_NUMX2";
+    case IrCmd::NUM_TO_NUMX2:
+        return "NUM_TO_NUMX2";
     case IrCmd::NOT_ANY:
         return "NOT_ANY";
     case IrCmd::CMP_ANY:
@@ -357,6 +367,10 @@ const char* getCmdName(IrCmd cmd)
         return "GET_CACHED_IMPORT";
     case IrCmd::CONCAT:
         return "CONCAT";
+    case IrCmd::CONCAT_APPEND:
+        return "CONCAT_APPEND";
+    case IrCmd::CONCAT_FLUSH:
+        return "CONCAT_FLUSH";
     case IrCmd::GET_UPVALUE:
         return "GET_UPVALUE";
     case IrCmd::SET_UPVALUE:
@@ -373,6 +387,8 @@ const char* getCmdName(IrCmd cmd)
         return "CHECK_SAFE_ENV";
     case IrCmd::CHECK_ARRAY_SIZE:
         return "CHECK_ARRAY_SIZE";
+    case IrCmd::CHECK_NO_TYPED_ARRAY:
+        return "CHECK_NO_TYPED_ARRAY";
     case IrCmd::CHECK_SLOT_MATCH:
         return "CHECK_SLOT_MATCH";
     case IrCmd::CHECK_NODE_NO_NEXT:
@@ -529,6 +545,14 @@ const char* getCmdName(IrCmd cmd)
         return "BUFFER_READI64";
     case IrCmd::BUFFER_WRITEI64:
         return "BUFFER_WRITEI64";
+    case IrCmd::BUFFER_READF64X2:
+        return "BUFFER_READF64X2";
+    case IrCmd::BUFFER_WRITEF64X2:
+        return "BUFFER_WRITEF64X2";
+    case IrCmd::BUFFER_READF32X2:
+        return "BUFFER_READF32X2";
+    case IrCmd::BUFFER_WRITEF32X2:
+        return "BUFFER_WRITEF32X2";
     case IrCmd::JUMP_CMP_PROTOID:
         return "JUMP_CMP_PROTOID";
     }
@@ -2252,6 +2252,26 @@ void IrLoweringA64::lowerInst(IrInst& inst, uint32_t index, const IrBlock& next)
 
         emitUpdateBase(build);
         break;
+    case IrCmd::CONCAT_APPEND:
+        regs.spill(index);
+        build.mov(x0, rState);
+        build.mov(w1, vmRegOp(OP_A(inst)));
+        build.mov(w2, vmRegOp(OP_B(inst)));
+        build.mov(w3, vmRegOp(OP_B(inst)) + uintOp(OP_C(inst)) - 1);
+        build.mov(w4, vmRegOp(OP_D(inst)));
+        build.ldr(x5, mem(rNativeContext, offsetof(NativeContext, luaV_concatappend)));
+        build.blr(x5);
+
+        emitUpdateBase(build);
+        break;
+    case IrCmd::CONCAT_FLUSH:
+        regs.spill(index);
+        build.mov(x0, rState);
+        build.mov(w1, vmRegOp(OP_A(inst)));
+        build.mov(w2, vmRegOp(OP_B(inst)));
+        build.ldr(x3, mem(rNativeContext, offsetof(NativeContext, luaV_concatflush)));
+        build.blr(x3);
+        break;
     case IrCmd::GET_UPVALUE:
     {
         inst.regA64 = regs.allocReg(KindA64::q, index);
@@ -2426,6 +2446,22 @@ void IrLoweringA64::lowerInst(IrInst& inst, uint32_t index, const IrBlock& next)
         finalizeTargetLabel(OP_C(inst), index, fresh);
         break;
     }
+    case IrCmd::CHECK_NO_TYPED_ARRAY:
+    {
+        Label fresh; // used when guard aborts execution or jumps to a VM exit
+        Label skip;
+
+        // Typed array part is present when the regular array part is empty and the pointer is set
+        RegisterA64 temp = regs.allocTemp(KindA64::x);
+        RegisterA64 tempw = castReg(KindA64::w, temp);
+        build.ldr(tempw, mem(regOp(OP_A(inst)), offsetof(LuaTable, sizearray)));
+        build.cbnz(tempw, skip);
+        build.ldr(temp, mem(regOp(OP_A(inst)), offsetof(LuaTable, typedarray)));
+        build.cbnz(temp, getTargetLabel(OP_B(inst), index, fresh));
+        finalizeTargetLabel(OP_B(inst), index, fresh);
+        build.setLabel(skip);
+        break;
+    }
     case IrCmd::JUMP_SLOT_MATCH:
     case IrCmd::CHECK_SLOT_MATCH:
     {
@@ -3658,6 +3694,19 @@ void IrLoweringA64::lowerInst(IrInst& inst, uint32_t index, const IrBlock& next)
         break;
     }
 
+    // Pairs of doubles are only formed by the x64 buffer access vectorizer
+    case IrCmd::ADD_NUMX2:
+    case IrCmd::SUB_NUMX2:
+    case IrCmd::MUL_NUMX2:
+    case IrCmd::DIV_NUMX2:
+    case IrCmd::NUM_TO_NUMX2:
+    case IrCmd::BUFFER_READF64X2:
+    case IrCmd::BUFFER_WRITEF64X2:
+    case IrCmd::BUFFER_READF32X2:
+    case IrCmd::BUFFER_WRITEF32X2:
+        error = true;
+        break;
+
     case IrCmd::JUMP_CMP_PROTOID:
     {
         LUAU_ASSERT(OP_A(inst).kind == IrOpKind::Inst && OP_B(inst).kind == IrOpKind::Constant);
@@ -1455,6 +1455,41 @@ void IrLoweringX64::lowerInst(IrInst& inst, uint32_t index, const IrBlock& next)
         build.vpshufps(inst.regX64, regOp(OP_A(inst)), regOp(OP_A(inst)), intOp(OP_B(inst)));
         break;
     }
+    case IrCmd::ADD_NUMX2:
+        inst.regX64 = regs.allocRegOrReuse(SizeX64::xmmword, index, {OP_A(inst), OP_B(inst)});
+
+        build.vaddpd(inst.regX64, regOp(OP_A(inst)), regOp(OP_B(inst)));
+        break;
+    case IrCmd::SUB_NUMX2:
+        inst.regX64 = regs.allocRegOrReuse(SizeX64::xmmword, index, {OP_A(inst), OP_B(inst)});
+
+        build.vsubpd(inst.regX64, regOp(OP_A(inst)), regOp(OP_B(inst)));
+        break;
+    case IrCmd::MUL_NUMX2:
+        inst.regX64 = regs.allocRegOrReuse(SizeX64::xmmword, index, {OP_A(inst), OP_B(inst)});
+
+        build.vmulpd(inst.regX64, regOp(OP_A(inst)), regOp(OP_B(inst)));
+        break;
+    case IrCmd::DIV_NUMX2:
+        inst.regX64 = regs.allocRegOrReuse(SizeX64::xmmword, index, {OP_A(inst), OP_B(inst)});
+
+        build.vdivpd(inst.regX64, regOp(OP_A(inst)), regOp(OP_B(inst)));
+        break;
+    case IrCmd::NUM_TO_NUMX2:
+        inst.regX64 = regs.allocReg(SizeX64::xmmword, index);
+
+        if (OP_A(inst).kind == IrOpKind::Constant)
+        {
+            double value = doubleOp(OP_A(inst));
+
+            build.vmovapd(inst.regX64, build.f64x2(value, value));
+        }
+        else
+        {
+            // Duplicate the low 64 bits holding the double into the high half
+            build.vpshufps(inst.regX64, regOp(OP_A(inst)), regOp(OP_A(inst)), 0b01'00'01'00);
+        }
+        break;
     case IrCmd::NOT_ANY:
     {
         // TODO: if we have a single user which is a STORE_INT, we are missing the opportunity to write directly to target
@@ -2221,6 +2256,28 @@ void IrLoweringX64::lowerInst(IrInst& inst, uint32_t index, const IrBlock& next)
         emitUpdateBase(build);
         break;
     }
+    case IrCmd::CONCAT_APPEND:
+    {
+        IrCallWrapperX64 callWrap(regs, build, index);
+        callWrap.addArgument(SizeX64::qword, rState);
+        callWrap.addArgument(SizeX64::dword, int32_t(vmRegOp(OP_A(inst))));
+        callWrap.addArgument(SizeX64::dword, int32_t(vmRegOp(OP_B(inst))));
+        callWrap.addArgument(SizeX64::dword, int32_t(vmRegOp(OP_B(inst)) + uintOp(OP_C(inst)) - 1));
+        callWrap.addArgument(SizeX64::dword, int32_t(vmRegOp(OP_D(inst))));
+        callWrap.call(qword[rNativeContext + offsetof(NativeContext, luaV_concatappend)]);
+
+        emitUpdateBase(build);
+        break;
+    }
+    case IrCmd::CONCAT_FLUSH:
+    {
+        IrCallWrapperX64 callWrap(regs, build, index);
+        callWrap.addArgument(SizeX64::qword, rState);
+        callWrap.addArgument(SizeX64::dword, int32_t(vmRegOp(OP_A(inst))));
+        callWrap.addArgument(SizeX64::dword, int32_t(vmRegOp(OP_B(inst))));
+        callWrap.call(qword[rNativeContext + offsetof(NativeContext, luaV_concatflush)]);
+        break;
+    }
     case IrCmd::GET_UPVALUE:
     {
         inst.regX64 = regs.allocReg(SizeX64::xmmword, index);
@@ -2326,6 +2383,17 @@ void IrLoweringX64::lowerInst(IrInst& inst, uint32_t index, const IrBlock& next)
 
         jumpOrAbortOnUndef(ConditionX64::BelowEqual, OP_C(inst), index, next);
         break;
+    case IrCmd::CHECK_NO_TYPED_ARRAY:
+    {
+        // Typed array part is present when the regular array part is empty and the pointer is set
+        Label skip;
+        build.cmp(dword[regOp(OP_A(inst)) + offsetof(LuaTable, sizearray)], 0);
+        build.jcc(ConditionX64::NotEqual, skip);
+        build.cmp(qword[regOp(OP_A(inst)) + offsetof(LuaTable, typedarray)], 0);
+        jumpOrAbortOnUndef(ConditionX64::NotEqual, OP_B(inst), index, next);
+        build.setLabel(skip);
+        break;
+    }
     case IrCmd::JUMP_SLOT_MATCH:
     case IrCmd::CHECK_SLOT_MATCH:
     {
@@ -3212,6 +3280,31 @@ void IrLoweringX64::lowerInst(IrInst& inst, uint32_t index, const IrBlock& next)
         }
         break;
 
+    case IrCmd::BUFFER_READF64X2:
+        inst.regX64 = regs.allocReg(SizeX64::xmmword, index);
+
+        build.vmovupd(inst.regX64, xmmword[bufferAddrOp(OP_A(inst), OP_B(inst), tagOp(OP_C(inst)))]);
+        break;
+
+    case IrCmd::BUFFER_WRITEF64X2:
+        build.vmovupd(xmmword[bufferAddrOp(OP_A(inst), OP_B(inst), tagOp(OP_D(inst)))], regOp(OP_C(inst)));
+        break;
+
+    case IrCmd::BUFFER_READF32X2:
+        inst.regX64 = regs.allocReg(SizeX64::xmmword, index);
+
+        build.vcvtps2pd(inst.regX64, qword[bufferAddrOp(OP_A(inst), OP_B(inst), tagOp(OP_C(inst)))]);
+        break;
+
+    case IrCmd::BUFFER_WRITEF32X2:
+    {
+        ScopedRegX64 tmp{regs, SizeX64::xmmword};
+
+        build.vcvtpd2ps(tmp.reg, regOp(OP_C(inst)));
+        build.vmovsd(qword[bufferAddrOp(OP_A(inst), OP_B(inst), tagOp(OP_D(inst)))], tmp.reg);
+        break;
+    }
+
     case IrCmd::CHECK_DIV_INT64:
     {
         ScopedRegX64 tmpA{regs, SizeX64::qword};
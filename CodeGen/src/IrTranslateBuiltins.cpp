@@ -10,6 +10,7 @@
 #include <math.h>
 
 LUAU_FASTFLAG(LuauCodegenInteger3)
+LUAU_FASTFLAG(LuauBufferTableArrays)
 LUAU_FASTFLAGVARIABLE(LuauCodegenBufferInteger)
 
 // TODO: when nresults is less than our actual result count, we can skip computing/writing unused results
@@ -833,6 +834,10 @@ static BuiltinImplResult translateBuiltinTableInsert(IrBuilder& build, int npara
     IrOp table = build.inst(IrCmd::LOAD_POINTER, build.vmReg(arg));
     build.inst(IrCmd::CHECK_READONLY, table, build.vmExit(pcpos));
 
+    // TABLE_SETNUM would replace a typed array part with a regular one, the interpreter appends to it in place
+    if (FFlag::LuauBufferTableArrays)
+        build.inst(IrCmd::CHECK_NO_TYPED_ARRAY, table, build.vmExit(pcpos));
+
     IrOp pos = build.inst(IrCmd::ADD_INT, build.inst(IrCmd::TABLE_LEN, table), build.constInt(1));
 
     IrOp setnum = build.inst(IrCmd::TABLE_SETNUM, table, pos);
@@ -13,6 +13,7 @@
 #include "ltm.h"
 
 LUAU_FASTFLAG(LuauCodegenInteger3)
+LUAU_FASTFLAG(LuauBufferTableArrays)
 
 namespace Luau
 {
@@ -143,6 +144,20 @@ void translateInstMove(IrBuilder& build, const Instruction* pc)
     build.inst(IrCmd::STORE_TVALUE, build.vmReg(ra), load);
 }
 
+void translateInstMove2(IrBuilder& build, const Instruction* pc)
+{
+    int ra = LUAU_INSN_A(*pc);
+    int rb = LUAU_INSN_B(*pc);
+    int rc = LUAU_INSN_C(*pc);
+
+    IrOp loadb = build.inst(IrCmd::LOAD_TVALUE, build.vmReg(rb));
+    build.inst(IrCmd::STORE_TVALUE, build.vmReg(ra), loadb);
+
+    // source of the second copy might be the target of the first one
+    IrOp loadc = build.inst(IrCmd::LOAD_TVALUE, build.vmReg(rc));
+    build.inst(IrCmd::STORE_TVALUE, build.vmReg(ra + 1), loadc);
+}
+
 void translateInstJump(IrBuilder& build, const Instruction* pc, int pcpos)
 {
     build.inst(IrCmd::JUMP, build.blockAtInst(pcpos + 1 + LUAU_INSN_D(*pc)));
@@ -1283,6 +1298,13 @@ void translateInstForGPrepInext(IrBuilder& build, const Instruction* pc, int pcp
 
     build.beginBlock(finish);
 
+    // inline loop only reads the regular array part, so tables with a typed array part iterate through the function
+    if (FFlag::LuauBufferTableArrays)
+    {
+        IrOp table = build.inst(IrCmd::LOAD_POINTER, build.vmReg(ra + 1));
+        build.inst(IrCmd::CHECK_NO_TYPED_ARRAY, table, fallback);
+    }
+
     build.inst(IrCmd::STORE_TAG, build.vmReg(ra), build.constTag(LUA_TNIL));
 
     // setpvalue(ra + 2, reinterpret_cast<void*>(uintptr_t(0)), LU_TAG_ITERATOR);
@@ -1736,6 +1758,30 @@ void translateInstConcat(IrBuilder& build, const Instruction* pc, int pcpos)
     build.inst(IrCmd::CHECK_GC);
 }
 
+void translateInstConcatAppend(IrBuilder& build, const Instruction* pc, int pcpos)
+{
+    int ra = LUAU_INSN_A(*pc);
+    int rb = LUAU_INSN_B(*pc);
+    int rc = LUAU_INSN_C(*pc);
+    uint32_t aux = pc[1];
+
+    build.inst(IrCmd::SET_SAVEDPC, build.constUint(pcpos + 1));
+    build.inst(IrCmd::CONCAT_APPEND, build.vmReg(ra), build.vmReg(rb), build.constUint(rc - rb + 1), build.vmReg(aux));
+
+    build.inst(IrCmd::CHECK_GC);
+}
+
+void translateInstConcatFlush(IrBuilder& build, const Instruction* pc, int pcpos)
+{
+    int ra = LUAU_INSN_A(*pc);
+    int rb = LUAU_INSN_B(*pc);
+
+    build.inst(IrCmd::SET_SAVEDPC, build.constUint(pcpos + 1));
+    build.inst(IrCmd::CONCAT_FLUSH, build.vmReg(ra), build.vmReg(rb));
+
+    build.inst(IrCmd::CHECK_GC);
+}
+
 void translateInstCapture(IrBuilder& build, const Instruction* pc, int pcpos)
 {
     int type = LUAU_INSN_A(*pc);
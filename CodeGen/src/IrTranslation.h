@@ -23,6 +23,7 @@ void translateInstLoadN(IrBuilder& build, const Instruction* pc);
 void translateInstLoadK(IrBuilder& build, const Instruction* pc);
 void translateInstLoadKX(IrBuilder& build, const Instruction* pc);
 void translateInstMove(IrBuilder& build, const Instruction* pc);
+void translateInstMove2(IrBuilder& build, const Instruction* pc);
 void translateInstJump(IrBuilder& build, const Instruction* pc, int pcpos);
 void translateInstJumpBack(IrBuilder& build, const Instruction* pc, int pcpos);
 void translateInstJumpIf(IrBuilder& build, const Instruction* pc, int pcpos, bool not_);
@@ -73,6 +74,8 @@ void translateInstSetTableKS(IrBuilder& build, const Instruction* pc, int pcpos)
 void translateInstGetGlobal(IrBuilder& build, const Instruction* pc, int pcpos);
 void translateInstSetGlobal(IrBuilder& build, const Instruction* pc, int pcpos);
 void translateInstConcat(IrBuilder& build, const Instruction* pc, int pcpos);
+void translateInstConcatAppend(IrBuilder& build, const Instruction* pc, int pcpos);
+void translateInstConcatFlush(IrBuilder& build, const Instruction* pc, int pcpos);
 void translateInstCapture(IrBuilder& build, const Instruction* pc, int pcpos);
 bool translateInstNamecall(IrBuilder& build, const Instruction* pc, int pcpos);
 void translateInstAndX(IrBuilder& build, const Instruction* pc, int pcpos, IrOp c);
@@ -11,12 +11,17 @@
 
 #include "lua.h"
 #include "lnumutils.h"
+#include "lobject.h"
 
 #include <algorithm>
 #include <vector>
 
 #include <limits.h>
 #include <math.h>
+#include <string.h>
+
+LUAU_FASTFLAG(LuauCodegenLoopInvariantTags)
+LUAU_FASTFLAGVARIABLE(LuauCodegenColdBlockLayout)
 
 namespace Luau
 {
@@ -58,6 +63,7 @@ int getOpLength(LuauOpcode op)
     case LOP_NEWCLASSMEMBER:
     case LOP_CALLFB:
     case LOP_CMPPROTO:
+    case LOP_CONCATAPPEND:
         return 2;
 
     default:
@@ -254,6 +260,12 @@ IrValueKind getCmdValueKind(IrCmd cmd)
     case IrCmd::DOT_VEC:
     case IrCmd::EXTRACT_VEC:
         return IrValueKind::Float;
+    case IrCmd::ADD_NUMX2:
+    case IrCmd::SUB_NUMX2:
+    case IrCmd::MUL_NUMX2:
+    case IrCmd::DIV_NUMX2:
+    case IrCmd::NUM_TO_NUMX2:
+        return IrValueKind::Tvalue;
     case IrCmd::NOT_ANY:
     case IrCmd::CMP_ANY:
     case IrCmd::CMP_INT:
@@ -320,6 +332,8 @@ IrValueKind getCmdValueKind(IrCmd cmd)
     case IrCmd::SET_TABLE:
     case IrCmd::GET_CACHED_IMPORT:
     case IrCmd::CONCAT:
+    case IrCmd::CONCAT_APPEND:
+    case IrCmd::CONCAT_FLUSH:
         return IrValueKind::None;
     case IrCmd::GET_UPVALUE:
         return IrValueKind::Tvalue;
@@ -330,6 +344,7 @@ IrValueKind getCmdValueKind(IrCmd cmd)
     case IrCmd::CHECK_NO_METATABLE:
     case IrCmd::CHECK_SAFE_ENV:
     case IrCmd::CHECK_ARRAY_SIZE:
+    case IrCmd::CHECK_NO_TYPED_ARRAY:
     case IrCmd::CHECK_SLOT_MATCH:
     case IrCmd::CHECK_NODE_NO_NEXT:
     case IrCmd::CHECK_NODE_VALUE:
@@ -410,6 +425,12 @@ IrValueKind getCmdValueKind(IrCmd cmd)
         return IrValueKind::Float;
     case IrCmd::BUFFER_READF64:
         return IrValueKind::Double;
+    case IrCmd::BUFFER_READF64X2:
+    case IrCmd::BUFFER_READF32X2:
+        return IrValueKind::Tvalue;
+    case IrCmd::BUFFER_WRITEF64X2:
+    case IrCmd::BUFFER_WRITEF32X2:
+        return IrValueKind::None;
     case IrCmd::JUMP_CMP_PROTOID:
         return IrValueKind::None;
     }
@@ -1771,6 +1792,93 @@ static int getBlockKindPriority(IrBlockKind kind)
     return 0;
 }
 
+static int getBlockPriority(const IrBlock& block, const std::vector<uint8_t>& coldBlocks, uint32_t index)
+{
+    // Cold blocks are placed after all other regular blocks, but before fallback and exit sync blocks
+    if (FFlag::LuauCodegenColdBlockLayout)
+    {
+        if (block.kind == IrBlockKind::Fallback)
+            return 2;
+
+        if (block.kind == IrBlockKind::ExitSync)
+            return 3;
+
+        return coldBlocks[index] ? 1 : 0;
+    }
+
+    return getBlockKindPriority(block.kind);
+}
+
+static bool isImportOfGlobal(const Proto* proto, uint32_t importId, const char* name)
+{
+    // Import path has to consist of a single global name
+    if ((importId >> 30) != 1)
+        return false;
+
+    int id = int(importId >> 20) & 1023;
+
+    if (id >= proto->sizek || !ttisstring(&proto->k[id]))
+        return false;
+
+    return strcmp(svalue(&proto->k[id]), name) == 0;
+}
+
+// Static heuristic: a block that calls the global 'error' function is not expected to run often
+// Imports are only resolved in a safe environment, so the call target is the builtin function
+static bool isColdBlock(IrFunction& function, const IrBlock& block)
+{
+    if (block.kind != IrBlockKind::Bytecode && block.kind != IrBlockKind::Internal)
+        return false;
+
+    if (!function.proto)
+        return false;
+
+    int errorReg = -1;
+
+    for (uint32_t index = block.start; index <= block.finish; index++)
+    {
+        IrInst& inst = function.instructions[index];
+
+        if (inst.cmd == IrCmd::GET_CACHED_IMPORT && OP_A(inst).kind == IrOpKind::VmReg && OP_C(inst).kind == IrOpKind::Constant)
+        {
+            if (isImportOfGlobal(function.proto, function.constOp(OP_C(inst)).valueUint, "error"))
+                errorReg = vmRegOp(OP_A(inst));
+        }
+        else if (inst.cmd == IrCmd::CALL && errorReg != -1 && OP_A(inst).kind == IrOpKind::VmReg && vmRegOp(OP_A(inst)) == errorReg)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Blocks that are part of a chain have to stay next to each other and cannot be moved
+static std::vector<uint8_t> findColdBlocks(IrFunction& function)
+{
+    std::vector<uint8_t> coldBlocks(function.blocks.size(), false);
+    std::vector<uint8_t> chained(function.blocks.size(), false);
+
+    for (IrBlock& block : function.blocks)
+    {
+        if (block.kind != IrBlockKind::Dead && block.expectedNextBlock != ~0u)
+            chained[block.expectedNextBlock] = true;
+    }
+
+    for (uint32_t i = 0; i < function.blocks.size(); i++)
+    {
+        IrBlock& block = function.blocks[i];
+
+        // Entry block always has to be placed first
+        if (i == function.entryBlock || block.kind == IrBlockKind::Dead || chained[i] || block.expectedNextBlock != ~0u)
+            continue;
+
+        coldBlocks[i] = isColdBlock(function, block);
+    }
+
+    return coldBlocks;
+}
+
 std::vector<uint32_t> getSortedBlockOrder(IrFunction& function)
 {
     std::vector<uint32_t> sortedBlocks;
@@ -1778,6 +1886,11 @@ std::vector<uint32_t> getSortedBlockOrder(IrFunction& function)
     for (uint32_t i = 0; i < function.blocks.size(); i++)
         sortedBlocks.push_back(i);
 
+    std::vector<uint8_t> coldBlocks;
+
+    if (FFlag::LuauCodegenColdBlockLayout)
+        coldBlocks = findColdBlocks(function);
+
     std::sort(
         sortedBlocks.begin(),
         sortedBlocks.end(),
@@ -1787,8 +1900,11 @@ std::vector<uint32_t> getSortedBlockOrder(IrFunction& function)
             const IrBlock& b = function.blocks[idxB];
 
             // Place fallback blocks at the end followed by exit sync blocks
-            if (getBlockKindPriority(a.kind) != getBlockKindPriority(b.kind))
-                return getBlockKindPriority(a.kind) < getBlockKindPriority(b.kind);
+            int priorityA = getBlockPriority(a, coldBlocks, idxA);
+            int priorityB = getBlockPriority(b, coldBlocks, idxB);
+
+            if (priorityA != priorityB)
+                return priorityA < priorityB;
 
             // Try to order by instruction order
             if (a.sortkey != b.sortkey)
@@ -1867,8 +1983,28 @@ void propagateTagsFromPredecessors(
     if (preds.empty())
         return;
 
+    // Back edges of a loop cannot change the tags of registers that are not written inside the loop
+    // Tags of those registers at loop entry are preserved on each iteration and we don't have to wait for loop body exit state
+    const CfgLoop* loop = FFlag::LuauCodegenLoopInvariantTags ? findLoopByHeader(function.cfg, blockIdx) : nullptr;
+
+    auto isBackEdge = [&](uint32_t predIdx)
+    {
+        return loop && std::find(loop->latches.begin(), loop->latches.end(), predIdx) != loop->latches.end();
+    };
+
+    auto isLoopInvariant = [&](size_t reg)
+    {
+        if (loop->written.regs.test(reg) || (loop->written.varargSeq && reg >= loop->written.varargStart))
+            return false;
+
+        return !function.cfg.captured.regs.test(reg);
+    };
+
     size_t minRegsKnown = std::numeric_limits<size_t>::max();
 
+    // Tags of loop invariant registers only depend on loop entry edges
+    size_t minEntryRegsKnown = std::numeric_limits<size_t>::max();
+
     const size_t numBlockExitTags = function.blockExitTags.size();
 
     for (uint32_t predIdx : preds)
@@ -1876,34 +2012,50 @@ void propagateTagsFromPredecessors(
         if (predIdx >= numBlockExitTags)
             return;
 
-        minRegsKnown = std::min(minRegsKnown, function.blockExitTags[predIdx].size());
+        size_t predRegsKnown = function.blockExitTags[predIdx].size();
+
+        minRegsKnown = std::min(minRegsKnown, predRegsKnown);
+
+        if (!isBackEdge(predIdx))
+            minEntryRegsKnown = std::min(minEntryRegsKnown, predRegsKnown);
     }
 
-    const RegisterSet& in = function.cfg.in[blockIdx];
+    // Loop invariant registers can have known tags even if a back edge predecessor hasn't been visited yet
+    size_t regsKnown = loop && minEntryRegsKnown != std::numeric_limits<size_t>::max() ? minEntryRegsKnown : minRegsKnown;
 
-    bool firstPredecessor = true;
+    const RegisterSet& in = function.cfg.in[blockIdx];
 
-    for (uint32_t predIdx : preds)
+    for (size_t i = 0; i < regsKnown; ++i)
     {
-        const std::vector<uint8_t>& predTags = function.blockExitTags[predIdx];
+        // Only registers that are live in can receive information from the predecessors
+        if (!in.regs.test(i) && !(in.varargSeq && i >= in.varargStart))
+            continue;
 
-        CODEGEN_ASSERT(minRegsKnown <= predTags.size());
+        bool invariant = loop && isLoopInvariant(i);
 
-        for (size_t i = 0; i < minRegsKnown; ++i)
+        if (i >= minRegsKnown && !invariant)
+            continue;
+
+        bool firstPredecessor = true;
+
+        for (uint32_t predIdx : preds)
         {
-            // Only registers that are live in can receive information from the predecessors
-            if (in.regs.test(i) || (in.varargSeq && i >= in.varargStart))
-            {
-                uint8_t currentTag = getTag(i);
+            if (invariant && isBackEdge(predIdx))
+                continue;
 
-                if (firstPredecessor)
-                    setTag(i, predTags[i]);
-                else if (currentTag != kUnknownTag && currentTag != predTags[i])
-                    setTag(i, kUnknownTag);
-            }
-        }
+            const std::vector<uint8_t>& predTags = function.blockExitTags[predIdx];
 
-        firstPredecessor = false;
+            CODEGEN_ASSERT(i < predTags.size());
+
+            uint8_t currentTag = getTag(i);
+
+            if (firstPredecessor)
+                setTag(i, predTags[i]);
+            else if (currentTag != kUnknownTag && currentTag != predTags[i])
+                setTag(i, kUnknownTag);
+
+            firstPredecessor = false;
+        }
     }
 }
 
@@ -115,6 +115,14 @@ void IrValueLocationTracking::beforeInstLowering(IrInst& inst)
     case IrCmd::CONCAT:
         invalidateRestoreVmRegs(vmRegOp(OP_A(inst)), function.uintOp(OP_B(inst)));
         break;
+    case IrCmd::CONCAT_APPEND:
+        invalidateRestoreVmRegs(vmRegOp(OP_B(inst)), function.uintOp(OP_C(inst)));
+        invalidateRestoreVmRegs(vmRegOp(OP_D(inst)), 2);
+        break;
+    case IrCmd::CONCAT_FLUSH:
+        invalidateRestoreOp(OP_A(inst), /*skipValueInvalidation*/ false);
+        invalidateRestoreVmRegs(vmRegOp(OP_B(inst)), 2);
+        break;
     case IrCmd::GET_UPVALUE:
         break;
     case IrCmd::CALL:
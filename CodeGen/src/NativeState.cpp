@@ -41,6 +41,8 @@ void initFunctions(NativeContext& context)
     context.luaV_gettable = luaV_gettable;
     context.luaV_settable = luaV_settable;
     context.luaV_concat = luaV_concat;
+    context.luaV_concatappend = luaV_concatappend;
+    context.luaV_concatflush = luaV_concatflush;
 
     context.luaH_getn = luaH_getn;
     context.luaH_new = luaH_new;
@@ -45,6 +45,8 @@ struct NativeContext
     void (*luaV_gettable)(lua_State* L, const TValue* t, TValue* key, StkId val) = nullptr;
     void (*luaV_settable)(lua_State* L, const TValue* t, TValue* key, StkId val) = nullptr;
     void (*luaV_concat)(lua_State* L, int total, int last) = nullptr;
+    void (*luaV_concatappend)(lua_State* L, int a, int first, int last, int buf) = nullptr;
+    void (*luaV_concatflush)(lua_State* L, int a, int buf) = nullptr;
 
     int (*luaH_getn)(LuaTable* t) = nullptr;
     LuaTable* (*luaH_new)(lua_State* L, int narray, int lnhash) = nullptr;
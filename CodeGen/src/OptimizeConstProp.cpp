@@ -26,6 +26,7 @@ LUAU_FASTFLAGVARIABLE(DebugLuauAbortingChecks)
 LUAU_FASTFLAGVARIABLE(LuauCodegenLoadPropagateOrigin)
 LUAU_FASTFLAGVARIABLE(LuauCodegenRecordAllBlockExitInfo)
 LUAU_FASTFLAGVARIABLE(LuauCodegenSubstituteReplacements)
+LUAU_FASTFLAGVARIABLE(LuauCodegenLoopInvariantTags)
 
 namespace Luau
 {
@@ -1453,6 +1454,10 @@ static void handleBuiltinEffects(ConstPropState& state, LuauBuiltinFunction bfid
     case LBF_BUFFER_READF32:
     case LBF_BUFFER_READF64:
     case LBF_BUFFER_READINTEGER:
+    case LBF_BUFFER_FIND:
+    case LBF_BUFFER_COMPARE:
+    case LBF_BUFFER_EQUAL:
+    case LBF_BUFFER_HASH:
     case LBF_VECTOR_MAGNITUDE:
     case LBF_VECTOR_NORMALIZE:
     case LBF_VECTOR_CROSS:
@@ -3267,6 +3272,7 @@ static void constPropInInst(ConstPropState& state, IrBuilder& build, IrFunction&
 
     case IrCmd::CHECK_NODE_NO_NEXT:
     case IrCmd::CHECK_NODE_VALUE:
+    case IrCmd::CHECK_NO_TYPED_ARRAY:
     case IrCmd::BARRIER_TABLE_BACK:
     case IrCmd::RETURN:
     case IrCmd::COVERAGE:
@@ -3309,6 +3315,19 @@ static void constPropInInst(ConstPropState& state, IrBuilder& build, IrFunction&
     case IrCmd::JUMP_CMP_PROTOID:
         break;
 
+    // Pairs of doubles are only formed by the x64 buffer access vectorizer after constant propagation
+    case IrCmd::ADD_NUMX2:
+    case IrCmd::SUB_NUMX2:
+    case IrCmd::MUL_NUMX2:
+    case IrCmd::DIV_NUMX2:
+    case IrCmd::NUM_TO_NUMX2:
+    case IrCmd::BUFFER_READF64X2:
+    case IrCmd::BUFFER_WRITEF64X2:
+    case IrCmd::BUFFER_READF32X2:
+    case IrCmd::BUFFER_WRITEF32X2:
+        CODEGEN_ASSERT(!"Pairs of doubles are not expected before lowering");
+        break;
+
     case IrCmd::DO_ARITH:
         state.invalidate(OP_A(inst));
         state.invalidateUserCall();
@@ -3339,6 +3358,15 @@ static void constPropInInst(ConstPropState& state, IrBuilder& build, IrFunction&
         state.invalidateRegisterRange(vmRegOp(OP_A(inst)), function.uintOp(OP_B(inst)));
         state.invalidateUserCall(); // TODO: if only strings and numbers are concatenated, there will be no user calls
         break;
+    case IrCmd::CONCAT_APPEND:
+        state.invalidateRegisterRange(vmRegOp(OP_B(inst)), function.uintOp(OP_C(inst)));
+        state.invalidateRegisterRange(vmRegOp(OP_D(inst)), 2);
+        state.invalidateUserCall();
+        break;
+    case IrCmd::CONCAT_FLUSH:
+        state.invalidate(OP_A(inst));
+        state.invalidateRegisterRange(vmRegOp(OP_B(inst)), 2);
+        break;
     case IrCmd::INTERRUPT:
         // While interrupt can observe state and yield/error, interrupt handlers must never change state
         break;
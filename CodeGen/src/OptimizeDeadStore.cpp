@@ -44,6 +44,8 @@ static bool isUnsafeToSink(IrCmd cmd)
     case IrCmd::BUFFER_READI64:
     case IrCmd::BUFFER_READF32:
     case IrCmd::BUFFER_READF64:
+    case IrCmd::BUFFER_READF32X2:
+    case IrCmd::BUFFER_READF64X2:
 
     // Upvalue read: SET_UPVALUE to the same upvalue slot
     case IrCmd::GET_UPVALUE:
@@ -1213,6 +1215,9 @@ static void markDeadStoresInInst(RemoveDeadStoreState& state, IrBuilder& build,
     case IrCmd::CHECK_ARRAY_SIZE:
         state.checkLiveIns(OP_C(inst), index, true);
         break;
+    case IrCmd::CHECK_NO_TYPED_ARRAY:
+        state.checkLiveIns(OP_B(inst), index, true);
+        break;
     case IrCmd::CHECK_DIV_INT64:
         // This instruction has two jumps to the exit in the lowering and that prevents exit sync record from being generated
         state.checkLiveIns(OP_C(inst), index, false);
@@ -1276,6 +1281,8 @@ static void markDeadStoresInInst(RemoveDeadStoreState& state, IrBuilder& build,
     case IrCmd::SET_TABLE:
     case IrCmd::GET_CACHED_IMPORT:
     case IrCmd::CONCAT:
+    case IrCmd::CONCAT_APPEND:
+    case IrCmd::CONCAT_FLUSH:
     case IrCmd::INTERRUPT:
     case IrCmd::CHECK_GC:
     case IrCmd::CALL:
@@ -1320,6 +1327,7 @@ static void markDeadStoresInInst(RemoveDeadStoreState& state, IrBuilder& build,
     case IrCmd::GET_TABLE:
     case IrCmd::SET_TABLE:
     case IrCmd::CONCAT:
+    case IrCmd::CONCAT_APPEND:
     case IrCmd::GET_CACHED_IMPORT:
     case IrCmd::FORGLOOP_FALLBACK:
     case IrCmd::FALLBACK_GETGLOBAL:
@@ -3,7 +3,11 @@
 
 #include "Luau/IrUtils.h"
 
+#include <algorithm>
 #include <utility>
+#include <vector>
+
+LUAU_FASTFLAGVARIABLE(LuauCodegenVectorizeBufferOps)
 
 namespace Luau
 {
@@ -129,6 +133,517 @@ static void optimizeMemoryOperandsX64(IrFunction& function, IrBlock& block)
     }
 }
 
+// Node of a computation on pairs of doubles that replaces the same computation performed separately for two adjacent buffer elements
+struct PackedNode
+{
+    IrCmd cmd = IrCmd::NOP;
+
+    // Values computed by the scalar code for the first and the second element (for a shared value, both are the same)
+    IrOp lane0;
+    IrOp lane1;
+
+    // Operands referring to other nodes use their node index and are marked in 'packedOps'
+    IrOps ops;
+    uint8_t packedOps = 0;
+
+    // The node has to be placed after this instruction
+    uint32_t after = 0;
+    uint32_t slot = ~0u;
+};
+
+// Limit on the size of the computation to keep the matching cheap
+constexpr size_t kMaxPackedNodes = 16;
+
+// Instructions between the scalar element accesses that don't prevent the accesses from being moved
+// They can't call out, leave the block or write memory other than VM registers
+static bool isSafeToReorderBufferAccess(IrInst& inst)
+{
+    switch (inst.cmd)
+    {
+    case IrCmd::CMP_ANY:
+    case IrCmd::INVOKE_FASTCALL:
+    case IrCmd::INVOKE_LIBM:
+    case IrCmd::TABLE_LEN:
+    case IrCmd::TABLE_SETNUM:
+    case IrCmd::NEW_TABLE:
+    case IrCmd::DUP_TABLE:
+    case IrCmd::NEW_USERDATA:
+    case IrCmd::NEWCLOSURE:
+    case IrCmd::FINDUPVAL:
+    case IrCmd::GET_TYPEOF:
+    case IrCmd::TRY_NUM_TO_INDEX:
+    case IrCmd::TRY_CALL_FASTGETTM:
+        return false;
+    default:
+        break;
+    }
+
+    if (isPseudo(inst.cmd) || hasResult(inst.cmd))
+        return true;
+
+    switch (inst.cmd)
+    {
+    case IrCmd::STORE_TAG:
+    case IrCmd::STORE_EXTRA:
+    case IrCmd::STORE_POINTER:
+    case IrCmd::STORE_DOUBLE:
+    case IrCmd::STORE_INT:
+    case IrCmd::STORE_INT64:
+    case IrCmd::STORE_VECTOR:
+    case IrCmd::STORE_TVALUE:
+    case IrCmd::STORE_SPLIT_TVALUE:
+        return OP_A(inst).kind == IrOpKind::VmReg;
+    default:
+        break;
+    }
+
+    return false;
+}
+
+static bool isBufferRead(IrCmd cmd)
+{
+    switch (cmd)
+    {
+    case IrCmd::BUFFER_READI8:
+    case IrCmd::BUFFER_READU8:
+    case IrCmd::BUFFER_READI16:
+    case IrCmd::BUFFER_READU16:
+    case IrCmd::BUFFER_READI32:
+    case IrCmd::BUFFER_READF32:
+    case IrCmd::BUFFER_READF64:
+    case IrCmd::BUFFER_READI64:
+        return true;
+    default:
+        break;
+    }
+
+    return false;
+}
+
+static IrCmd getPackedArithCmd(IrCmd cmd)
+{
+    switch (cmd)
+    {
+    case IrCmd::ADD_NUM:
+        return IrCmd::ADD_NUMX2;
+    case IrCmd::SUB_NUM:
+        return IrCmd::SUB_NUMX2;
+    case IrCmd::MUL_NUM:
+        return IrCmd::MUL_NUMX2;
+    case IrCmd::DIV_NUM:
+        return IrCmd::DIV_NUMX2;
+    default:
+        break;
+    }
+
+    return IrCmd::NOP;
+}
+
+// Two writes of adjacent f32 or f64 buffer elements are replaced with a single write of a pair when both values are computed by the same
+// tree of arithmetic on elements at the same offsets of other buffers
+// Scalar code computes f32 element values in doubles as well, so the packed computation produces exactly the same results
+struct BufferPairVectorizer
+{
+    BufferPairVectorizer(IrFunction& function, IrBlock& block)
+        : function(function)
+        , block(block)
+    {
+    }
+
+    bool inBlock(IrOp op) const
+    {
+        return op.kind == IrOpKind::Inst && op.index >= block.start && op.index <= block.finish;
+    }
+
+    static uint32_t definedAt(IrOp op)
+    {
+        return op.kind == IrOpKind::Inst ? op.index : 0;
+    }
+
+    bool isNextElement(IrOp curr, IrOp next) const
+    {
+        if (curr.kind == IrOpKind::Constant && next.kind == IrOpKind::Constant)
+            return function.intOp(next) == function.intOp(curr) + elementSize;
+
+        if (next.kind != IrOpKind::Inst)
+            return false;
+
+        IrInst& inst = function.instOp(next);
+
+        if (inst.cmd != IrCmd::ADD_INT)
+            return false;
+
+        if (OP_A(inst) == curr && OP_B(inst).kind == IrOpKind::Constant)
+            return function.intOp(OP_B(inst)) == elementSize;
+
+        if (OP_B(inst) == curr && OP_A(inst).kind == IrOpKind::Constant)
+            return function.intOp(OP_A(inst)) == elementSize;
+
+        return false;
+    }
+
+    // Find the bounds check that covers both elements at the first element offset
+    uint32_t findRangeCheck(IrOp buffer, uint32_t before) const
+    {
+        for (uint32_t index = block.start; index < before; index++)
+        {
+            IrInst& inst = function.instructions[index];
+
+            if (inst.cmd != IrCmd::CHECK_BUFFER_LEN || OP_A(inst) != buffer || OP_B(inst) != index0)
+                continue;
+
+            if (function.intOp(OP_C(inst)) <= 0 && function.intOp(OP_D(inst)) >= elementSize * 2)
+                return index;
+        }
+
+        return ~0u;
+    }
+
+    int addNode(IrCmd cmd, IrOp lane0, IrOp lane1, IrOps ops, uint8_t packedOps, uint32_t after)
+    {
+        PackedNode node;
+        node.cmd = cmd;
+        node.lane0 = lane0;
+        node.lane1 = lane1;
+        node.ops = std::move(ops);
+        node.packedOps = packedOps;
+        node.after = after;
+
+        nodes.push_back(std::move(node));
+        return int(nodes.size()) - 1;
+    }
+
+    int matchRead(IrOp lane0, IrOp lane1, IrOp read0, IrOp read1)
+    {
+        if (!inBlock(read0) || !inBlock(read1))
+            return -1;
+
+        IrInst& a = function.instOp(read0);
+        IrInst& b = function.instOp(read1);
+
+        if (a.cmd != readCmd || b.cmd != readCmd)
+            return -1;
+
+        // Both elements have to be read from the same buffer at the offsets they are written to
+        if (OP_A(a) != OP_A(b) || OP_C(a) != OP_C(b) || OP_B(a) != index0 || OP_B(b) != index1)
+            return -1;
+
+        uint32_t check = findRangeCheck(OP_A(a), block.finish);
+
+        if (check == ~0u)
+            return -1;
+
+        firstRead = std::min(firstRead, read0.index);
+        firstRead = std::min(firstRead, read1.index);
+
+        scalarInsts.push_back(read0.index);
+        scalarInsts.push_back(read1.index);
+
+        IrCmd cmd = readCmd == IrCmd::BUFFER_READF64 ? IrCmd::BUFFER_READF64X2 : IrCmd::BUFFER_READF32X2;
+        uint32_t after = std::max(std::max(definedAt(OP_A(a)), definedAt(index0)), check);
+
+        return addNode(cmd, lane0, lane1, {OP_A(a), index0, OP_C(a)}, 0, after);
+    }
+
+    int matchValue(IrOp lane0, IrOp lane1)
+    {
+        for (size_t i = 0; i < nodes.size(); i++)
+        {
+            if (nodes[i].lane0 == lane0 && nodes[i].lane1 == lane1)
+                return int(i);
+        }
+
+        if (nodes.size() >= kMaxPackedNodes)
+            return -1;
+
+        // Value shared by both elements is placed into both lanes
+        if (lane0 == lane1)
+        {
+            if (lane0.kind == IrOpKind::Constant && function.constOp(lane0).kind != IrConstKind::Double)
+                return -1;
+
+            if (lane0.kind == IrOpKind::Inst && getCmdValueKind(function.instOp(lane0).cmd) != IrValueKind::Double)
+                return -1;
+
+            if (lane0.kind != IrOpKind::Constant && lane0.kind != IrOpKind::Inst)
+                return -1;
+
+            return addNode(IrCmd::NUM_TO_NUMX2, lane0, lane1, {lane0}, 0, definedAt(lane0));
+        }
+
+        if (!inBlock(lane0) || !inBlock(lane1))
+            return -1;
+
+        IrInst& a = function.instOp(lane0);
+        IrInst& b = function.instOp(lane1);
+
+        if (a.cmd != b.cmd)
+            return -1;
+
+        if (IrCmd cmd = getPackedArithCmd(a.cmd); cmd != IrCmd::NOP)
+        {
+            int lhs = matchValue(OP_A(a), OP_A(b));
+
+            if (lhs < 0)
+                return -1;
+
+            int rhs = matchValue(OP_B(a), OP_B(b));
+
+            if (rhs < 0)
+                return -1;
+
+            scalarInsts.push_back(lane0.index);
+            scalarInsts.push_back(lane1.index);
+
+            return addNode(cmd, lane0, lane1, {IrOp{IrOpKind::Inst, uint32_t(lhs)}, IrOp{IrOpKind::Inst, uint32_t(rhs)}}, 0b11, 0);
+        }
+
+        if (a.cmd == IrCmd::BUFFER_READF64 && readCmd == IrCmd::BUFFER_READF64)
+            return matchRead(lane0, lane1, lane0, lane1);
+
+        if (a.cmd == IrCmd::FLOAT_TO_NUM && readCmd == IrCmd::BUFFER_READF32)
+        {
+            int node = matchRead(lane0, lane1, OP_A(a), OP_A(b));
+
+            if (node >= 0)
+            {
+                scalarInsts.push_back(lane0.index);
+                scalarInsts.push_back(lane1.index);
+            }
+
+            return node;
+        }
+
+        return -1;
+    }
+
+    bool tryVectorize(uint32_t write0Idx, uint32_t write1Idx)
+    {
+        IrInst& write0 = function.instructions[write0Idx];
+        IrInst& write1 = function.instructions[write1Idx];
+
+        if (OP_A(write0) != OP_A(write1) || OP_D(write0) != OP_D(write1))
+            return false;
+
+        bool isF64 = write0.cmd == IrCmd::BUFFER_WRITEF64;
+
+        readCmd = isF64 ? IrCmd::BUFFER_READF64 : IrCmd::BUFFER_READF32;
+        elementSize = isF64 ? 8 : 4;
+        index0 = OP_B(write0);
+        index1 = OP_B(write1);
+
+        if (!isNextElement(index0, index1))
+            return false;
+
+        // Write of the first element is delayed, so nothing in between can observe it or leave the block before it happens
+        for (uint32_t index = write0Idx + 1; index < write1Idx; index++)
+        {
+            IrInst& inst = function.instructions[index];
+
+            if (!isSafeToReorderBufferAccess(inst))
+                return false;
+
+            if (isBufferRead(inst.cmd) && OP_B(inst) != index1)
+                return false;
+        }
+
+        IrOp value0 = OP_C(write0);
+        IrOp value1 = OP_C(write1);
+
+        // Elements are computed in doubles and converted to floats on write
+        if (!isF64)
+        {
+            if (!inBlock(value0) || !inBlock(value1))
+                return false;
+
+            IrInst& conv0 = function.instOp(value0);
+            IrInst& conv1 = function.instOp(value1);
+
+            if (conv0.cmd != IrCmd::NUM_TO_FLOAT || conv1.cmd != IrCmd::NUM_TO_FLOAT)
+                return false;
+
+            scalarInsts.push_back(value0.index);
+            scalarInsts.push_back(value1.index);
+
+            value0 = OP_A(conv0);
+            value1 = OP_A(conv1);
+        }
+
+        int root = matchValue(value0, value1);
+
+        if (root < 0 || firstRead == ~0u)
+            return false;
+
+        IrCmd writeCmd = isF64 ? IrCmd::BUFFER_WRITEF64X2 : IrCmd::BUFFER_WRITEF32X2;
+        addNode(writeCmd, OP_C(write0), OP_C(write1), {OP_A(write0), index0, IrOp{IrOpKind::Inst, uint32_t(root)}, OP_D(write0)}, 0b100, 0);
+
+        std::sort(scalarInsts.begin(), scalarInsts.end());
+        scalarInsts.erase(std::unique(scalarInsts.begin(), scalarInsts.end()), scalarInsts.end());
+
+        // Find scalar instructions that will have no uses left once both writes are removed, their locations will hold the packed nodes
+        std::vector<uint32_t> pendingUses(block.finish - block.start + 1);
+        std::vector<uint32_t> slots = {write0Idx, write1Idx};
+
+        if (inBlock(OP_C(write0)))
+            pendingUses[OP_C(write0).index - block.start]++;
+
+        if (inBlock(OP_C(write1)))
+            pendingUses[OP_C(write1).index - block.start]++;
+
+        for (auto it = scalarInsts.rbegin(); it != scalarInsts.rend(); ++it)
+        {
+            IrInst& inst = function.instructions[*it];
+
+            if (inst.useCount != pendingUses[*it - block.start])
+                continue;
+
+            slots.push_back(*it);
+
+            for (IrOp& op : inst.ops)
+            {
+                if (inBlock(op))
+                    pendingUses[op.index - block.start]++;
+            }
+        }
+
+        std::sort(slots.begin(), slots.end());
+
+        if (slots.size() < nodes.size())
+            return false;
+
+        // Packed write takes the place of the second element write, other nodes are placed in order before it
+        size_t nextSlot = 0;
+
+        for (PackedNode& node : nodes)
+        {
+            if (node.cmd == writeCmd)
+            {
+                node.slot = write1Idx;
+                break;
+            }
+
+            uint32_t after = node.after;
+
+            for (size_t i = 0; i < node.ops.size(); i++)
+            {
+                if (node.packedOps & (1 << i))
+                    after = std::max(after, nodes[node.ops[i].index].slot);
+            }
+
+            while (nextSlot < slots.size() && slots[nextSlot] <= after)
+                nextSlot++;
+
+            if (nextSlot >= slots.size() || slots[nextSlot] >= write1Idx)
+                return false;
+
+            node.slot = slots[nextSlot++];
+            firstRead = std::min(firstRead, node.slot);
+        }
+
+        // Reads are moved to new locations up to the write of the second element and can't cross any other memory writes
+        for (uint32_t index = firstRead; index < write0Idx; index++)
+        {
+            IrInst& inst = function.instructions[index];
+
+            if (!isSafeToReorderBufferAccess(inst) && !isNonTerminatingJump(inst.cmd))
+                return false;
+        }
+
+        // Operands of packed nodes have to stay alive while scalar instructions are removed
+        for (PackedNode& node : nodes)
+        {
+            for (size_t i = 0; i < node.ops.size(); i++)
+            {
+                if ((node.packedOps & (1 << i)) == 0 && node.ops[i].kind == IrOpKind::Inst)
+                    function.instOp(node.ops[i]).useCount++;
+            }
+        }
+
+        kill(function, write0);
+        kill(function, write1);
+
+        for (PackedNode& node : nodes)
+        {
+            CODEGEN_ASSERT(function.instructions[node.slot].cmd == IrCmd::NOP);
+
+            IrInst inst{node.cmd, node.ops};
+
+            for (size_t i = 0; i < inst.ops.size(); i++)
+            {
+                if (node.packedOps & (1 << i))
+                    inst.ops[i] = IrOp{IrOpKind::Inst, nodes[node.ops[i].index].slot};
+            }
+
+            replace(function, block, node.slot, inst);
+        }
+
+        for (PackedNode& node : nodes)
+        {
+            for (size_t i = 0; i < node.ops.size(); i++)
+            {
+                if ((node.packedOps & (1 << i)) == 0 && node.ops[i].kind == IrOpKind::Inst)
+                    function.instOp(node.ops[i]).useCount--;
+            }
+        }
+
+        return true;
+    }
+
+    IrFunction& function;
+    IrBlock& block;
+
+    IrCmd readCmd = IrCmd::NOP;
+    int elementSize = 0;
+    IrOp index0;
+    IrOp index1;
+
+    std::vector<PackedNode> nodes;
+    std::vector<uint32_t> scalarInsts;
+    uint32_t firstRead = ~0u;
+};
+
+static void vectorizeBufferAccessesX64(IrFunction& function, IrBlock& block)
+{
+    CODEGEN_ASSERT(block.kind != IrBlockKind::Dead);
+
+    for (uint32_t index = block.start; index <= block.finish; index++)
+    {
+        IrInst& inst = function.instructions[index];
+
+        if (inst.cmd != IrCmd::BUFFER_WRITEF32 && inst.cmd != IrCmd::BUFFER_WRITEF64)
+            continue;
+
+        // Find the write of the next element, the first element write is delayed until then so nothing in between can exit or write memory
+        for (uint32_t next = index + 1; next <= block.finish; next++)
+        {
+            IrInst& nextInst = function.instructions[next];
+
+            if (nextInst.cmd == inst.cmd)
+            {
+                BufferPairVectorizer vectorizer(function, block);
+
+                if (vectorizer.tryVectorize(index, next))
+                    index = next;
+                break;
+            }
+
+            if (!isSafeToReorderBufferAccess(nextInst))
+                break;
+        }
+    }
+}
+
+void vectorizeBufferAccessesX64(IrFunction& function)
+{
+    for (IrBlock& block : function.blocks)
+    {
+        if (block.kind == IrBlockKind::Dead || block.kind == IrBlockKind::ExitSync)
+            continue;
+
+        vectorizeBufferAccessesX64(function, block);
+    }
+}
+
 void optimizeMemoryOperandsX64(IrFunction& function)
 {
     for (IrBlock& block : function.blocks)
@@ -53,6 +53,9 @@
 // Version 10: Adds LBC_CONSTANT_CLASS_SHAPE and NEWCLASSMEMBER for use with Luau Classes. Experimental.
 // Version 11: Adds CALLFB, CMPPROTO and feedback vector description. Experimental.
 // Version 12: Adds cost function serialized for proto and prepend each proto with size in bytes. Experimental.
+// Version 13: Adds MOVE2. Experimental.
+// Version 14: Compact encoding: number constants are shared between functions, line info is run-length encoded and local ranges store lengths. Experimental.
+// Version 15: Adds CONCATAPPEND/CONCATFLUSH. Uses the compact encoding of version 14. Experimental.
 
 // # Bytecode type information history
 // Version 1: (from bytecode version 4) Type information for function signature. Currently supported.
@@ -452,6 +455,25 @@ enum LuauOpcode
     // AUX: proto id
     LOP_CMPPROTO,
 
+    // MOVE2: copy values from two registers into two consecutive registers, in order
+    // A: target register (receives B), A+1 receives C
+    // B: source register for A
+    // C: source register for A+1; read after A is written
+    LOP_MOVE2,
+
+    // CONCATAPPEND: append strings between B+1 and C (inclusive) to the value of A, accumulating the result in a string buffer
+    // A: source register, holds the initial value and is never modified
+    // B: scratch register start, used to concatenate the accumulated value with the appended values when they can't be buffered
+    // C: source register end
+    // AUX: buffer register start; the buffer uses two registers that must be set to nil before the first append
+    // Note: the accumulated value is only stored into A by CONCATFLUSH
+    LOP_CONCATAPPEND,
+
+    // CONCATFLUSH: store the value accumulated by CONCATAPPEND into the target register and reset the buffer
+    // A: target register; unchanged if nothing was appended
+    // B: buffer register start
+    LOP_CONCATFLUSH,
+
     // Enum entry for number of opcodes, not a valid opcode by itself!
     LOP__COUNT
 };
@@ -500,7 +522,7 @@ enum LuauBytecodeTag
 {
     // Bytecode version; runtime supports [MIN, MAX], compiler emits TARGET by default but may emit a higher version when flags are enabled
     LBC_VERSION_MIN = 3,
-    LBC_VERSION_MAX = 12,
+    LBC_VERSION_MAX = 15,
     LBC_VERSION_TARGET = 7,
     // Type encoding version
     LBC_TYPE_VERSION_MIN = 1,
@@ -734,6 +756,12 @@ enum LuauBuiltinFunction
     // buffer.readinteger / buffer.writeinteger (int64_t)
     LBF_BUFFER_READINTEGER,
     LBF_BUFFER_WRITEINTEGER,
+
+    // buffer.find / buffer.compare / buffer.equal / buffer.hash
+    LBF_BUFFER_FIND,
+    LBF_BUFFER_COMPARE,
+    LBF_BUFFER_EQUAL,
+    LBF_BUFFER_HASH,
 };
 
 // Capture type, used in LOP_CAPTURE
@@ -23,6 +23,11 @@ using LibraryMemberTypeCallback = int (*)(const char* library, const char* membe
 // use setCompileConstant*** set of functions for values
 using LibraryMemberConstantCallback = void (*)(const char* library, const char* member, CompileConstant* constant);
 
+// return source code of a function expression for a global library member, or nullptr if it's unknown
+// the function is made available for inlining at the call sites; it can only refer to globals and its own locals, and can't create closures
+// the host must guarantee that the library member is never replaced at runtime, as no runtime check is performed
+using LibraryMemberFunctionCallback = const char* (*)(const char* library, const char* member, size_t* length);
+
 // Note: this structure is duplicated in luacode.h, don't forget to change these in sync!
 struct CompileOptions
 {
@@ -68,6 +73,9 @@ struct CompileOptions
 
     // null-terminated array of library functions that should not be compiled into a built-in fastcall ("name" "lib.name")
     const char* const* disabledBuiltins = nullptr;
+
+    // when a member of one of the librariesWithKnownMembers is called, this callback can provide the function source for inlining
+    LibraryMemberFunctionCallback libraryMemberFunctionCb = nullptr;
 };
 
 class CompileError : public std::exception
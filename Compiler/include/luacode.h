@@ -20,6 +20,11 @@ typedef int (*lua_LibraryMemberTypeCallback)(const char* library, const char* me
 // use luau_set_compile_constant_*** set of functions for values
 typedef void (*lua_LibraryMemberConstantCallback)(const char* library, const char* member, lua_CompileConstant* constant);
 
+// return source code of a function expression for a global library member, or NULL if it's unknown
+// the function is made available for inlining at the call sites; it can only refer to globals and its own locals, and can't create closures
+// the host must guarantee that the library member is never replaced at runtime, as no runtime check is performed
+typedef const char* (*lua_LibraryMemberFunctionCallback)(const char* library, const char* member, size_t* length);
+
 struct lua_CompileOptions
 {
     // 0 - no optimization
@@ -64,6 +69,9 @@ struct lua_CompileOptions
 
     // null-terminated array of library functions that should not be compiled into a built-in fastcall ("name" "lib.name")
     const char* const* disabledBuiltins;
+
+    // when a member of one of the librariesWithKnownMembers is called, this callback can provide the function source for inlining
+    lua_LibraryMemberFunctionCallback libraryMemberFunctionCb;
 };
 
 // compile source to bytecode; when source compilation fails, the resulting bytecode contains the encoded error. use free() to destroy
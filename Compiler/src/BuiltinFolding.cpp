@@ -8,6 +8,8 @@
 #include <limits>
 #include <math.h>
 
+LUAU_FASTFLAGVARIABLE(LuauCompileFoldVectorLib)
+
 namespace Luau
 {
 namespace Compile
@@ -134,6 +136,21 @@ static uint32_t bit32(double v)
     return uint32_t(int64_t(v));
 }
 
+static bool hasW(const Constant& c)
+{
+    return c.valueVector[3] != 0.0f;
+}
+
+// Vector constants always carry 4 components, but the VM might be built with 3-component vectors
+// Just like vector arithmetic folding, we only fold results that keep W at zero when inputs didn't use it
+static Constant cvectorw(const float v[4], bool hadW)
+{
+    if (!hadW && v[3] != 0.0f)
+        return cvar();
+
+    return cvector(v[0], v[1], v[2], v[3]);
+}
+
 Constant foldBuiltin(AstNameTable& stringTable, int bfid, const Constant* args, size_t count)
 {
     switch (bfid)
@@ -595,6 +612,165 @@ Constant foldBuiltin(AstNameTable& stringTable, int bfid, const Constant* args,
         }
         break;
 
+    case LBF_VECTOR_MAGNITUDE:
+        // result depends on the number of vector components when W is used
+        if (FFlag::LuauCompileFoldVectorLib && count == 1 && args[0].type == Constant::Type_Vector && !hasW(args[0]))
+        {
+            const float* v = args[0].valueVector;
+
+            return cnum(sqrtf(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]));
+        }
+        break;
+
+    case LBF_VECTOR_NORMALIZE:
+        if (FFlag::LuauCompileFoldVectorLib && count == 1 && args[0].type == Constant::Type_Vector && !hasW(args[0]))
+        {
+            const float* v = args[0].valueVector;
+            float invSqrt = 1.0f / sqrtf(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+
+            float r[4] = {v[0] * invSqrt, v[1] * invSqrt, v[2] * invSqrt, v[3] * invSqrt};
+            return cvectorw(r, false);
+        }
+        break;
+
+    case LBF_VECTOR_CROSS:
+        if (FFlag::LuauCompileFoldVectorLib && count == 2 && args[0].type == Constant::Type_Vector && args[1].type == Constant::Type_Vector)
+        {
+            const float* a = args[0].valueVector;
+            const float* b = args[1].valueVector;
+
+            return cvector(a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2], a[0] * b[1] - a[1] * b[0], 0.0f);
+        }
+        break;
+
+    case LBF_VECTOR_DOT:
+        // result depends on the number of vector components when W is used
+        if (FFlag::LuauCompileFoldVectorLib && count == 2 && args[0].type == Constant::Type_Vector && args[1].type == Constant::Type_Vector &&
+            !hasW(args[0]) && !hasW(args[1]))
+        {
+            const float* a = args[0].valueVector;
+            const float* b = args[1].valueVector;
+
+            return cnum(a[0] * b[0] + a[1] * b[1] + a[2] * b[2]);
+        }
+        break;
+
+    case LBF_VECTOR_FLOOR:
+        if (FFlag::LuauCompileFoldVectorLib && count == 1 && args[0].type == Constant::Type_Vector)
+        {
+            const float* v = args[0].valueVector;
+
+            float r[4] = {floorf(v[0]), floorf(v[1]), floorf(v[2]), floorf(v[3])};
+            return cvectorw(r, hasW(args[0]));
+        }
+        break;
+
+    case LBF_VECTOR_CEIL:
+        if (FFlag::LuauCompileFoldVectorLib && count == 1 && args[0].type == Constant::Type_Vector)
+        {
+            const float* v = args[0].valueVector;
+
+            float r[4] = {ceilf(v[0]), ceilf(v[1]), ceilf(v[2]), ceilf(v[3])};
+            return cvectorw(r, hasW(args[0]));
+        }
+        break;
+
+    case LBF_VECTOR_ABS:
+        if (FFlag::LuauCompileFoldVectorLib && count == 1 && args[0].type == Constant::Type_Vector)
+        {
+            const float* v = args[0].valueVector;
+
+            float r[4] = {fabsf(v[0]), fabsf(v[1]), fabsf(v[2]), fabsf(v[3])};
+            return cvectorw(r, hasW(args[0]));
+        }
+        break;
+
+    case LBF_VECTOR_SIGN:
+        if (FFlag::LuauCompileFoldVectorLib && count == 1 && args[0].type == Constant::Type_Vector)
+        {
+            const float* v = args[0].valueVector;
+
+            float r[4];
+
+            for (int i = 0; i < 4; ++i)
+                r[i] = v[i] > 0.0f ? 1.0f : v[i] < 0.0f ? -1.0f : 0.0f;
+
+            return cvectorw(r, hasW(args[0]));
+        }
+        break;
+
+    case LBF_VECTOR_CLAMP:
+        if (FFlag::LuauCompileFoldVectorLib && count == 3 && args[0].type == Constant::Type_Vector && args[1].type == Constant::Type_Vector &&
+            args[2].type == Constant::Type_Vector)
+        {
+            const float* v = args[0].valueVector;
+            const float* min = args[1].valueVector;
+            const float* max = args[2].valueVector;
+
+            // invalid ranges are reported as errors at runtime
+            if (min[0] <= max[0] && min[1] <= max[1] && min[2] <= max[2])
+            {
+                float r[4];
+
+                for (int i = 0; i < 4; ++i)
+                {
+                    r[i] = v[i] < min[i] ? min[i] : v[i];
+                    r[i] = r[i] > max[i] ? max[i] : r[i];
+                }
+
+                return cvectorw(r, hasW(args[0]) || hasW(args[1]) || hasW(args[2]));
+            }
+        }
+        break;
+
+    case LBF_VECTOR_MIN:
+    case LBF_VECTOR_MAX:
+        if (FFlag::LuauCompileFoldVectorLib && count >= 1)
+        {
+            bool hadW = false;
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (args[i].type != Constant::Type_Vector)
+                    return cvar();
+
+                hadW |= hasW(args[i]);
+            }
+
+            float r[4] = {args[0].valueVector[0], args[0].valueVector[1], args[0].valueVector[2], args[0].valueVector[3]};
+
+            for (size_t i = 1; i < count; ++i)
+            {
+                for (int c = 0; c < 4; ++c)
+                {
+                    float b = args[i].valueVector[c];
+
+                    if (bfid == LBF_VECTOR_MIN ? b < r[c] : b > r[c])
+                        r[c] = b;
+                }
+            }
+
+            return cvectorw(r, hadW);
+        }
+        break;
+
+    case LBF_VECTOR_LERP:
+        if (FFlag::LuauCompileFoldVectorLib && count == 3 && args[0].type == Constant::Type_Vector && args[1].type == Constant::Type_Vector &&
+            args[2].type == Constant::Type_Number)
+        {
+            const float* a = args[0].valueVector;
+            const float* b = args[1].valueVector;
+            float t = float(args[2].valueNumber);
+
+            float r[4];
+
+            for (int i = 0; i < 4; ++i)
+                r[i] = (t == 1.0f) ? b[i] : a[i] + (b[i] - a[i]) * t;
+
+            return cvectorw(r, hasW(args[0]) || hasW(args[1]));
+        }
+        break;
+
     case LBF_MATH_LERP:
         if (count == 3 && args[0].type == Constant::Type_Number && args[1].type == Constant::Type_Number && args[2].type == Constant::Type_Number)
         {
@@ -9,6 +9,7 @@
 
 LUAU_FASTFLAGVARIABLE(LuauIntegerFastcalls)
 LUAU_FASTFLAGVARIABLE(LuauIntegerBufferFastcalls)
+LUAU_FASTFLAGVARIABLE(LuauBufferBulkFastcalls)
 
 namespace Luau
 {
@@ -259,6 +260,14 @@ static int getBuiltinFunctionId(const Builtin& builtin, const CompileOptions& op
             return LBF_BUFFER_READINTEGER;
         if (FFlag::LuauIntegerFastcalls && FFlag::LuauIntegerBufferFastcalls && builtin.method == "writeinteger")
             return LBF_BUFFER_WRITEINTEGER;
+        if (FFlag::LuauBufferBulkFastcalls && builtin.method == "find")
+            return LBF_BUFFER_FIND;
+        if (FFlag::LuauBufferBulkFastcalls && builtin.method == "compare")
+            return LBF_BUFFER_COMPARE;
+        if (FFlag::LuauBufferBulkFastcalls && builtin.method == "equal")
+            return LBF_BUFFER_EQUAL;
+        if (FFlag::LuauBufferBulkFastcalls && builtin.method == "hash")
+            return LBF_BUFFER_HASH;
     }
 
     if (builtin.object == "vector")
@@ -656,6 +665,16 @@ BuiltinInfo getBuiltinInfo(int bfid)
     case LBF_BUFFER_READINTEGER:
         return {2, 1, BuiltinInfo::Flag_NoneSafe};
 
+    case LBF_BUFFER_FIND:
+        return {-1, 1}; // 3 or 4 parameters
+
+    case LBF_BUFFER_COMPARE:
+    case LBF_BUFFER_EQUAL:
+        return {-1, 1}; // 3, 4 or 5 parameters
+
+    case LBF_BUFFER_HASH:
+        return {-1, 1}; // 1, 2 or 3 parameters
+
     case LBF_VECTOR_MAGNITUDE:
     case LBF_VECTOR_NORMALIZE:
         return {1, 1, BuiltinInfo::Flag_NoneSafe};
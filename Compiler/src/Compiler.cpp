@@ -24,6 +24,7 @@
 
 LUAU_FASTINTVARIABLE(LuauCompileLoopUnrollThreshold, 25)
 LUAU_FASTINTVARIABLE(LuauCompileLoopUnrollThresholdMaxBoost, 300)
+LUAU_FASTINTVARIABLE(LuauCompileLoopUnrollFactor, 4)
 
 LUAU_FASTINTVARIABLE(LuauCompileInlineThreshold, 25)
 LUAU_FASTINTVARIABLE(LuauCompileInlineThresholdMaxBoost, 300)
@@ -35,6 +36,12 @@ LUAU_FASTFLAGVARIABLE(LuauCompileStringInterpTargetTop)
 LUAU_FASTFLAG(DebugLuauNoInline)
 LUAU_FASTFLAGVARIABLE(LuauEmitCallFeedback)
 LUAU_FASTFLAGVARIABLE(LuauCompileInlineTableFunctions)
+LUAU_FASTFLAGVARIABLE(LuauCompileScalarTables)
+LUAU_FASTFLAGVARIABLE(LuauCompileInlineLibraryFunctions)
+LUAU_FASTFLAGVARIABLE(LuauCompilePartialLoopUnroll)
+LUAU_FASTFLAGVARIABLE(LuauCompileFoldMoves)
+LUAU_FASTFLAG(LuauCompileMove2)
+LUAU_FASTFLAG(LuauCompileConcatBuffer)
 
 namespace Luau
 {
@@ -301,6 +308,14 @@ struct Compiler
 
             return getFunctionExpr(lv->init);
         }
+        else if (AstExprFunction** func = libraryFunctions.find(node))
+        {
+            // library member functions can only be used as long as the library global isn't replaced by the module
+            AstExprGlobal* library = node->as<AstExprIndexName>()->expr->as<AstExprGlobal>();
+            LUAU_ASSERT(library);
+
+            return getGlobalState(globals, library->name) == Global::Default ? *func : nullptr;
+        }
         else if (AstExprIndexName* expr = node->as<AstExprIndexName>(); expr && FFlag::LuauCompileInlineTableFunctions)
         {
             if (AstExpr* value = tryIndexConstantTable(expr))
@@ -490,6 +505,12 @@ struct Compiler
             }
         }
 
+        if (FFlag::LuauCompileFoldMoves && options.optimizationLevel >= 2)
+            bytecode.foldMoves();
+
+        if (FFlag::LuauCompileMove2 && options.optimizationLevel >= 2)
+            bytecode.fuseMoves();
+
         if (options.optimizationLevel >= 1)
             bytecode.foldJumps();
 
@@ -1051,6 +1072,11 @@ struct Compiler
         // the inline frame will be used to compile return statements as well as to reject recursive inlining attempts
         inlineFrames.push_back({func, oldLocals, target, targetCount});
 
+        int oldLibraryInlineLine = libraryInlineLine;
+
+        if (libraryFunctionExprs.contains(func))
+            libraryInlineLine = expr->location.begin.line + 1;
+
         // this pass tracks which calls are builtins and can be compiled more efficiently
         analyzeBuiltins(inlineBuiltins, globals, variables, options, func->body, names);
 
@@ -1122,6 +1148,8 @@ struct Compiler
 
         popLocals(oldLocals);
 
+        libraryInlineLine = oldLibraryInlineLine;
+
         size_t returnLabel = bytecode.emitLabel();
         patchJumps(expr, inlineFrames.back().returnJumps, returnLabel);
 
@@ -2603,6 +2631,12 @@ struct Compiler
     {
         setDebugLine(expr); // normally compileExpr sets up line info, but compileExprIndexName can be called directly
 
+        if (int reg = getScalarTableFieldReg(expr); reg >= 0)
+        {
+            bytecode.emitABC(LOP_MOVE, target, uint8_t(reg), 0);
+            return;
+        }
+
         // Optimization: index chains that start from global variables can be compiled into GETIMPORT statement
         AstExprGlobal* importRoot = 0;
         AstExprIndexName* import1 = 0;
@@ -2984,6 +3018,10 @@ struct Compiler
         if (int reg = getExprLocalReg(node); reg >= 0)
             return uint8_t(reg);
 
+        if (AstExprIndexName* expr = node->as<AstExprIndexName>())
+            if (int reg = getScalarTableFieldReg(expr); reg >= 0)
+                return uint8_t(reg);
+
         // note: the register is owned by the parent scope
         uint8_t reg = allocReg(node, 1u);
 
@@ -3307,6 +3345,24 @@ struct Compiler
             return -1;
     }
 
+    int getScalarTableFieldReg(AstExprIndexName* expr)
+    {
+        AstExprLocal* le = expr->expr->as<AstExprLocal>();
+        if (!le)
+            return -1;
+
+        AstExprTable** table = scalarTables.find(le->local);
+        uint8_t* reg = scalarTableRegs.find(le->local);
+
+        if (!table || !reg)
+            return -1;
+
+        int index = getTableRecordIndex(*table, expr->index);
+        LUAU_ASSERT(index >= 0);
+
+        return *reg + index;
+    }
+
     bool isStatBreak(AstStat* node)
     {
         if (AstStatBlock* stat = node->as<AstStatBlock>())
@@ -3660,6 +3716,21 @@ struct Compiler
             }
         }
 
+        // Optimization: tables that never escape and are only read through constant field names don't need to be allocated
+        if (AstExprTable** table = scalarTables.find(stat->vars.data[0]))
+        {
+            LUAU_ASSERT(stat->vars.size == 1 && stat->values.size == 1);
+
+            // note: allocReg in this case allocates into parent block register - note that we don't have RegScope here
+            uint8_t fields = allocReg(stat, unsigned((*table)->items.size));
+
+            for (size_t i = 0; i < (*table)->items.size; ++i)
+                compileExprTemp((*table)->items.data[i].value, uint8_t(fields + i));
+
+            scalarTableRegs[stat->vars.data[0]] = fields;
+            return;
+        }
+
         // note: allocReg in this case allocates into parent block register - note that we don't have RegScope here
         uint8_t vars = allocReg(stat, unsigned(stat->vars.size));
         uint32_t allocpc = bytecode.getDebugPC();
@@ -3813,6 +3884,238 @@ struct Compiler
         Compile::undoChanges(locstants, localChanges);
     }
 
+    bool tryCompilePartialUnrolledFor(AstStatFor* stat, int thresholdBase, int factorLimit)
+    {
+        Constant one = {Constant::Type_Number};
+        one.valueNumber = 1.0;
+
+        Constant fromc = getConstant(stat->from);
+        Constant stepc = stat->step ? getConstant(stat->step) : one;
+
+        // unrolled iterations compute the index as base + offset, which is only guaranteed to match repeated addition for integers
+        auto isSmallInteger = [](const Constant& c)
+        {
+            return c.type == Constant::Type_Number && c.valueNumber >= -1024 && c.valueNumber <= 1024 && double(int(c.valueNumber)) == c.valueNumber;
+        };
+
+        if (!isSmallInteger(fromc) || !isSmallInteger(stepc) || stepc.valueNumber == 0)
+        {
+            bytecode.addDebugRemark("partial loop unroll failed: non-integer start or step");
+            return false;
+        }
+
+        if (Variable* lv = variables.find(stat->var); lv && lv->written)
+        {
+            bytecode.addDebugRemark("partial loop unroll failed: mutable loop variable");
+            return false;
+        }
+
+        AstLocal* var = stat->var;
+        int bodyCost = computeCost(modelCost(stat->body, &var, 1, builtins, constants), nullptr, 0);
+
+        double step = stepc.valueNumber;
+
+        // the body is compiled once per unrolled iteration and once more for the remainder loop; each copy also needs an index increment
+        // the step of the unrolled loop is loaded with LOADN, so it has to fit into the 16-bit operand as well
+        int factor = factorLimit;
+
+        while (factor >= 2 && ((bodyCost + 1) * (factor + 1) > thresholdBase || fabs(factor * step) > 32767))
+            factor--;
+
+        if (factor < 2)
+        {
+            bytecode.addDebugRemark("partial loop unroll failed: too expensive (cost %d)", bodyCost);
+            return false;
+        }
+
+        // index offsets and the limit adjustment take up to 'factor' new constants, which are referenced by 8-bit operands
+        if (bytecode.getConstantCount() + factor > 256)
+        {
+            bytecode.addDebugRemark("partial loop unroll failed: too many constants");
+            return false;
+        }
+
+        bool varUsed = isLocalUsed(stat->body, var);
+
+        // offsets are added before the body is compiled, as the body can add constants of its own
+        // the last offset doubles as the limit adjustment and is added first, the others are only needed when the body reads the index
+        std::vector<uint8_t> offsetk(factor);
+
+        for (int i = 0; i < (varUsed ? factor - 1 : 1); ++i)
+        {
+            int iv = i == 0 ? factor - 1 : i;
+            int32_t cid = bytecode.addConstantNumber(iv * step);
+
+            if (cid < 0 || cid > 255)
+            {
+                bytecode.addDebugRemark("partial loop unroll failed: too many constants");
+                return false;
+            }
+
+            offsetk[iv] = uint8_t(cid);
+        }
+
+        bytecode.addDebugRemark("partial loop unroll succeeded (factor %d, cost %d)", factor, bodyCost);
+
+        compilePartialUnrolledFor(stat, factor, step, offsetk, varUsed);
+        return true;
+    }
+
+    bool isLocalUsed(AstNode* node, AstLocal* local)
+    {
+        struct Visitor : AstVisitor
+        {
+            AstLocal* local;
+            bool used = false;
+
+            Visitor(AstLocal* local)
+                : local(local)
+            {
+            }
+
+            bool visit(AstExprLocal* node) override
+            {
+                used |= node->local == local;
+
+                return !used;
+            }
+        };
+
+        Visitor visitor(local);
+        node->visit(&visitor);
+
+        return visitor.used;
+    }
+
+    // Compiles the loop as a nested pair of loops:
+    // - the outer loop uses the original limit and step; it validates the loop arguments and runs the remaining iterations one by one
+    // - the inner loop runs while at least 'factor' iterations remain and executes that many copies of the body per iteration
+    void compilePartialUnrolledFor(AstStatFor* stat, int factor, double step, const std::vector<uint8_t>& offsetk, bool varUsed)
+    {
+        AstLocal* var = stat->var;
+
+        size_t oldLocals = localStack.size();
+        size_t oldJumps = loopJumps.size();
+
+        loops.push_back({oldLocals, oldLocals, nullptr});
+        hasLoops = true;
+
+        // register layout: limit, step, index for both loops
+        uint8_t regs = allocReg(stat, 3u);
+        uint8_t unrolled = allocReg(stat, 3u);
+
+        uint32_t varregallocpc = bytecode.getDebugPC();
+
+        compileExprTemp(stat->from, uint8_t(regs + 2));
+        compileExprTemp(stat->to, uint8_t(regs + 0));
+        bytecode.emitAD(LOP_LOADN, uint8_t(regs + 1), int16_t(step));
+
+        size_t forLabel = bytecode.emitLabel();
+
+        bytecode.emitAD(LOP_FORNPREP, regs, 0);
+
+        // note: the step is loaded last so that native code generation can recognize it as a constant
+        bytecode.emitABC(LOP_MOVE, uint8_t(unrolled + 2), uint8_t(regs + 2), 0);
+        bytecode.emitABC(LOP_SUBK, uint8_t(unrolled + 0), uint8_t(regs + 0), offsetk[factor - 1]);
+        bytecode.emitAD(LOP_LOADN, uint8_t(unrolled + 1), int16_t(factor * step));
+
+        size_t unrolledForLabel = bytecode.emitLabel();
+
+        bytecode.emitAD(LOP_FORNPREP, unrolled, 0);
+
+        size_t unrolledLoopLabel = bytecode.emitLabel();
+
+        for (int iv = 0; iv < factor; ++iv)
+        {
+            RegScope rsi(this);
+
+            uint8_t varreg = uint8_t(unrolled + 2);
+
+            if (iv > 0 && varUsed)
+            {
+                varreg = allocReg(stat, 1u);
+                bytecode.emitABC(LOP_ADDK, varreg, uint8_t(unrolled + 2), offsetk[iv]);
+            }
+
+            pushLocal(var, varreg, varregallocpc);
+
+            size_t iterJumps = loopJumps.size();
+
+            compileStat(stat->body);
+
+            closeLocals(oldLocals);
+            popLocals(oldLocals);
+
+            // all continue jumps need to go to the next iteration
+            size_t contLabel = bytecode.emitLabel();
+
+            for (size_t i = iterJumps; i < loopJumps.size(); ++i)
+                if (loopJumps[i].type == LoopJump::Continue)
+                    patchJump(stat, loopJumps[i].label, contLabel);
+        }
+
+        setDebugLine(stat);
+
+        size_t unrolledBackLabel = bytecode.emitLabel();
+
+        bytecode.emitAD(LOP_FORNLOOP, unrolled, 0);
+
+        size_t unrolledEndLabel = bytecode.emitLabel();
+
+        // after the unrolled loop, the index holds the first iteration that hasn't been executed yet
+        bytecode.emitABC(LOP_MOVE, uint8_t(regs + 2), uint8_t(unrolled + 2), 0);
+
+        // note: loop arguments have been validated by the outer FORNPREP, so this comparison can't invoke metamethods or see a NaN
+        size_t exitLabel = bytecode.emitLabel();
+
+        if (step > 0)
+        {
+            bytecode.emitAD(LOP_JUMPIFLT, regs, 0);
+            bytecode.emitAux(regs + 2);
+        }
+        else
+        {
+            bytecode.emitAD(LOP_JUMPIFLT, uint8_t(regs + 2), 0);
+            bytecode.emitAux(regs);
+        }
+
+        size_t loopLabel = bytecode.emitLabel();
+        size_t remainderJumps = loopJumps.size();
+
+        pushLocal(var, uint8_t(regs + 2), varregallocpc);
+
+        compileStat(stat->body);
+
+        closeLocals(oldLocals);
+        popLocals(oldLocals);
+
+        setDebugLine(stat);
+
+        size_t contLabel = bytecode.emitLabel();
+
+        size_t backLabel = bytecode.emitLabel();
+
+        bytecode.emitAD(LOP_FORNLOOP, regs, 0);
+
+        size_t endLabel = bytecode.emitLabel();
+
+        patchJump(stat, forLabel, endLabel);
+        patchJump(stat, unrolledForLabel, unrolledEndLabel);
+        patchJump(stat, unrolledBackLabel, unrolledLoopLabel);
+        patchJump(stat, exitLabel, endLabel);
+        patchJump(stat, backLabel, loopLabel);
+
+        // continue jumps of the unrolled copies have already been patched
+        for (size_t i = oldJumps; i < remainderJumps; ++i)
+            if (loopJumps[i].type == LoopJump::Break)
+                patchJump(stat, loopJumps[i].label, endLabel);
+
+        patchLoopJumps(stat, remainderJumps, endLabel, contLabel);
+        loopJumps.resize(oldJumps);
+
+        loops.pop_back();
+    }
+
     void compileStatFor(AstStatFor* stat)
     {
         RegScope rs(this);
@@ -3822,6 +4125,12 @@ struct Compiler
             if (tryCompileUnrolledFor(stat, FInt::LuauCompileLoopUnrollThreshold, FInt::LuauCompileLoopUnrollThresholdMaxBoost))
                 return;
 
+        // Optimization: loops with small bodies can be partially unrolled to reduce the loop overhead
+        if (FFlag::LuauCompilePartialLoopUnroll && options.optimizationLevel >= 2 && isConstant(stat->from) &&
+            (!stat->step || isConstant(stat->step)))
+            if (tryCompilePartialUnrolledFor(stat, FInt::LuauCompileLoopUnrollThreshold, FInt::LuauCompileLoopUnrollFactor))
+                return;
+
         size_t oldLocals = localStack.size();
         size_t oldJumps = loopJumps.size();
 
@@ -4074,6 +4383,16 @@ struct Compiler
         // Optimization: one to one assignments don't require complex conflict resolution machinery
         if (stat->vars.size == 1 && stat->values.size == 1)
         {
+            if (const ConcatBuffer* buffer = findConcatBuffer(stat->vars.data[0]))
+            {
+                // locals are only buffered when all their assignments in the loop have the form `s = s .. x`
+                AstExprBinary* expr = stat->values.data[0]->as<AstExprBinary>();
+                LUAU_ASSERT(expr && expr->op == AstExprBinary::Concat);
+
+                compileConcatAppend(*buffer, expr->right, stat);
+                return;
+            }
+
             LValue var = compileLValue(stat->vars.data[0], rs);
 
             // Optimization: assign to locals directly
@@ -4177,6 +4496,15 @@ struct Compiler
     {
         RegScope rs(this);
 
+        if (stat->op == AstExprBinary::Concat)
+        {
+            if (const ConcatBuffer* buffer = findConcatBuffer(stat->var))
+            {
+                compileConcatAppend(*buffer, stat->value, stat);
+                return;
+            }
+        }
+
         LValue var = compileLValue(stat->var, rs);
 
         // Optimization: assign to locals directly
@@ -4259,6 +4587,103 @@ struct Compiler
         compileAssign(var, reg, stat->name);
     }
 
+    struct ConcatBuffer
+    {
+        AstLocal* local;
+        uint8_t localReg;
+        uint8_t reg;
+    };
+
+    // Appending to a string in a loop with `s = s .. x` copies the entire string every time, which is quadratic in the number of iterations
+    // When a local is only used this way in a loop, the appended values are accumulated in a string buffer and the local is updated after the loop
+    // Returns the number of buffers that were active before the loop, which is passed to finishConcatBuffers
+    size_t startConcatBuffers(AstStat* loop)
+    {
+        size_t oldBuffers = concatBuffers.size();
+
+        if (!FFlag::LuauCompileConcatBuffer || options.optimizationLevel < 2)
+            return oldBuffers;
+
+        ConcatBufferVisitor visitor;
+        loop->visit(&visitor);
+
+        for (AstLocal* local : visitor.locals)
+        {
+            // locals that are appended to in an enclosing loop already have a buffer
+            if (!visitor.appendOnly[local] || findConcatBuffer(local))
+                continue;
+
+            Local* l = locals.find(local);
+
+            // locals declared in the loop are read after each iteration, and captured locals can be read through the upvalue at any time
+            if (!l || !l->allocated || l->captured)
+                continue;
+
+            // most of the registers are left to the loop body, buffering shouldn't make the function run out of registers
+            if (regTop + 2 > kMaxRegisterCount / 2)
+                break;
+
+            uint8_t reg = allocReg(loop, 2u);
+
+            bytecode.emitABC(LOP_LOADNIL, reg, 0, 0);
+            bytecode.emitABC(LOP_LOADNIL, uint8_t(reg + 1), 0, 0);
+
+            concatBuffers.push_back({local, l->reg, reg});
+        }
+
+        return oldBuffers;
+    }
+
+    void finishConcatBuffers(AstStat* loop, size_t oldBuffers)
+    {
+        if (concatBuffers.size() == oldBuffers)
+            return;
+
+        // all loop exits, including break statements, continue here
+        setDebugLineEnd(loop);
+
+        for (size_t i = oldBuffers; i < concatBuffers.size(); ++i)
+            bytecode.emitABC(LOP_CONCATFLUSH, concatBuffers[i].localReg, concatBuffers[i].reg, 0);
+
+        // buffer registers were allocated in order right before the loop
+        regTop = concatBuffers[oldBuffers].reg;
+        concatBuffers.resize(oldBuffers);
+    }
+
+    const ConcatBuffer* findConcatBuffer(AstLocal* local)
+    {
+        for (const ConcatBuffer& buffer : concatBuffers)
+            if (buffer.local == local)
+                return &buffer;
+
+        return nullptr;
+    }
+
+    const ConcatBuffer* findConcatBuffer(AstExpr* var)
+    {
+        if (AstExprLocal* expr = var->as<AstExprLocal>())
+            return findConcatBuffer(expr->local);
+
+        return nullptr;
+    }
+
+    void compileConcatAppend(const ConcatBuffer& buffer, AstExpr* value, AstStat* stat)
+    {
+        std::vector<AstExpr*> args = {value};
+
+        // unroll the tree of concats down the right hand side to be able to do multiple ops
+        unrollConcats(args);
+
+        // first register is used when the values can't be buffered and have to be concatenated with the current value
+        uint8_t regs = allocReg(stat, unsigned(1 + args.size()));
+
+        for (size_t i = 0; i < args.size(); ++i)
+            compileExprTemp(args[i], uint8_t(regs + 1 + i));
+
+        bytecode.emitABC(LOP_CONCATAPPEND, buffer.localReg, regs, uint8_t(regs + args.size()));
+        bytecode.emitAux(buffer.reg);
+    }
+
     void compileStat(AstStat* node)
     {
         setDebugLine(node);
@@ -4297,11 +4722,19 @@ struct Compiler
         }
         else if (AstStatWhile* stat = node->as<AstStatWhile>())
         {
+            size_t oldConcatBuffers = startConcatBuffers(stat);
+
             compileStatWhile(stat);
+
+            finishConcatBuffers(stat, oldConcatBuffers);
         }
         else if (AstStatRepeat* stat = node->as<AstStatRepeat>())
         {
+            size_t oldConcatBuffers = startConcatBuffers(stat);
+
             compileStatRepeat(stat);
+
+            finishConcatBuffers(stat, oldConcatBuffers);
         }
         else if (node->is<AstStatBreak>())
         {
@@ -4370,11 +4803,19 @@ struct Compiler
         }
         else if (AstStatFor* stat = node->as<AstStatFor>())
         {
+            size_t oldConcatBuffers = startConcatBuffers(stat);
+
             compileStatFor(stat);
+
+            finishConcatBuffers(stat, oldConcatBuffers);
         }
         else if (AstStatForIn* stat = node->as<AstStatForIn>())
         {
+            size_t oldConcatBuffers = startConcatBuffers(stat);
+
             compileStatForIn(stat);
+
+            finishConcatBuffers(stat, oldConcatBuffers);
         }
         else if (AstStatAssign* stat = node->as<AstStatAssign>())
         {
@@ -4628,19 +5069,19 @@ struct Compiler
     void setDebugLine(AstNode* node)
     {
         if (options.debugLevel >= 1)
-            bytecode.setDebugLine(node->location.begin.line + 1);
+            bytecode.setDebugLine(libraryInlineLine ? libraryInlineLine : node->location.begin.line + 1);
     }
 
     void setDebugLine(const Location& location)
     {
         if (options.debugLevel >= 1)
-            bytecode.setDebugLine(location.begin.line + 1);
+            bytecode.setDebugLine(libraryInlineLine ? libraryInlineLine : location.begin.line + 1);
     }
 
     void setDebugLineEnd(AstNode* node)
     {
         if (options.debugLevel >= 1)
-            bytecode.setDebugLine(node->location.end.line + 1);
+            bytecode.setDebugLine(libraryInlineLine ? libraryInlineLine : node->location.end.line + 1);
     }
 
     bool needsCoverage(AstNode* node)
@@ -4687,6 +5128,36 @@ struct Compiler
         }
     };
 
+    struct LibraryCallVisitor : AstVisitor
+    {
+        const char* const* libraries;
+
+        std::vector<AstExprIndexName*> calls;
+
+        LibraryCallVisitor(const char* const* libraries)
+            : libraries(libraries)
+        {
+        }
+
+        bool isLibrary(AstName name)
+        {
+            for (const char* const* ptr = libraries; *ptr; ++ptr)
+                if (name == *ptr)
+                    return true;
+
+            return false;
+        }
+
+        bool visit(AstExprCall* node) override
+        {
+            if (AstExprIndexName* index = node->func->as<AstExprIndexName>(); index && !node->self)
+                if (AstExprGlobal* library = index->expr->as<AstExprGlobal>(); library && isLibrary(library->name))
+                    calls.push_back(index);
+
+            return true;
+        }
+    };
+
     struct FunctionVisitor : AstVisitor
     {
         std::vector<AstExprFunction*>& functions;
@@ -4794,6 +5265,68 @@ struct Compiler
         std::vector<AstLocal*> upvals;
     };
 
+    // Finds locals that are only updated with `s = s .. x` or `s ..= x` and aren't otherwise referenced
+    struct ConcatBufferVisitor : AstVisitor
+    {
+        DenseHashMap<AstLocal*, bool> appendOnly{nullptr};
+        std::vector<AstLocal*> locals;
+
+        void record(AstLocal* local, bool append)
+        {
+            if (bool* value = appendOnly.find(local))
+            {
+                *value &= append;
+            }
+            else
+            {
+                appendOnly[local] = append;
+                locals.push_back(local);
+            }
+        }
+
+        bool visit(AstExprLocal* node) override
+        {
+            record(node->local, false);
+
+            return false;
+        }
+
+        bool visit(AstStatAssign* node) override
+        {
+            if (node->vars.size != 1 || node->values.size != 1)
+                return true;
+
+            AstExprLocal* var = node->vars.data[0]->as<AstExprLocal>();
+            AstExprBinary* expr = node->values.data[0]->as<AstExprBinary>();
+
+            if (!var || var->upvalue || !expr || expr->op != AstExprBinary::Concat)
+                return true;
+
+            AstExprLocal* left = expr->left->as<AstExprLocal>();
+
+            if (!left || left->local != var->local || left->upvalue)
+                return true;
+
+            record(var->local, true);
+            expr->right->visit(this);
+
+            return false;
+        }
+
+        bool visit(AstStatCompoundAssign* node) override
+        {
+            AstExprLocal* var = node->var->as<AstExprLocal>();
+
+            if (!var || var->upvalue || node->op != AstExprBinary::Concat)
+                return true;
+
+            record(var->local, true);
+            node->value->visit(this);
+
+            return false;
+        }
+    };
+
     struct ReturnVisitor : AstVisitor
     {
         Compiler* self;
@@ -4924,6 +5457,10 @@ struct Compiler
     DenseHashMap<AstExpr*, Constant> constants;
     DenseHashMap<AstLocal*, Constant> locstants;
     DenseHashMap<AstLocal*, TableConstantKind> tableConstants{nullptr};
+    DenseHashMap<AstLocal*, AstExprTable*> scalarTables{nullptr};
+    DenseHashMap<AstExpr*, AstExprFunction*> libraryFunctions{nullptr};
+    DenseHashSet<AstExprFunction*> libraryFunctionExprs{nullptr};
+    DenseHashMap<AstLocal*, uint8_t> scalarTableRegs{nullptr};
     DenseHashMap<AstExprTable*, TableShape> tableShapes;
     DenseHashMap<AstExprCall*, int> builtins;
     DenseHashMap<AstName, uint8_t> userdataTypes;
@@ -4952,6 +5489,9 @@ struct Compiler
     bool hasMultiRet = false;
     AstExprFunction* currentFunction = nullptr;
 
+    // line of the call that is used for all code inlined from a library function, since that code isn't part of the module source
+    int libraryInlineLine = 0;
+
     size_t blockDepth = 0;
 
     bool getfenvUsed = false;
@@ -4961,6 +5501,7 @@ struct Compiler
     std::vector<AstLocal*> upvals;
     std::vector<LoopJump> loopJumps;
     std::vector<Loop> loops;
+    std::vector<ConcatBuffer> concatBuffers;
     std::vector<InlineFrame> inlineFrames;
     std::vector<Capture> captures;
     std::vector<AstLocal*> exportedLocals;
@@ -4973,6 +5514,85 @@ static void setCompileOptionsForNativeCompilation(CompileOptions& options)
     options.typeInfoLevel = 1;
 }
 
+static AstStatReturn* parseLibraryFunction(const CompileOptions& options, AstName library, AstName member, AstNameTable& names, Allocator& allocator)
+{
+    size_t length = 0;
+    const char* source = options.libraryMemberFunctionCb(library.value, member.value, &length);
+
+    if (!source)
+        return nullptr;
+
+    std::string chunk = "return " + std::string(source, length);
+    ParseResult result = Parser::parse(chunk.c_str(), chunk.size(), names, allocator);
+
+    // malformed sources are ignored and the call is compiled as usual
+    if (!result.errors.empty() || result.root->body.size != 1)
+        return nullptr;
+
+    AstStatReturn* stat = result.root->body.data[0]->as<AstStatReturn>();
+    if (!stat || stat->list.size != 1)
+        return nullptr;
+
+    AstExprFunction* func = stat->list.data[0]->as<AstExprFunction>();
+    if (!func)
+        return nullptr;
+
+    // library functions are only used for inlining and don't get a proto in the module, so they can't create closures of their own
+    std::vector<AstExprFunction*> nested;
+    Compiler::FunctionVisitor visitor(nested);
+    func->body->visit(&visitor);
+
+    if (!nested.empty())
+        return nullptr;
+
+    func->debugname = member;
+    return stat;
+}
+
+// finds calls to library members that have a function provided by libraryMemberFunctionCb; each member is parsed once
+static void loadLibraryFunctions(
+    DenseHashMap<AstExpr*, AstExprFunction*>& result,
+    std::vector<AstStat*>& stats,
+    const CompileOptions& options,
+    AstStatBlock* root,
+    AstNameTable& names,
+    Allocator& allocator
+)
+{
+    Compiler::LibraryCallVisitor visitor(options.librariesWithKnownMembers);
+    root->visit(&visitor);
+
+    std::vector<std::pair<AstExprIndexName*, AstExprFunction*>> loaded;
+
+    for (AstExprIndexName* call : visitor.calls)
+    {
+        AstName library = call->expr->as<AstExprGlobal>()->name;
+
+        auto it = std::find_if(
+            loaded.begin(),
+            loaded.end(),
+            [&](const std::pair<AstExprIndexName*, AstExprFunction*>& p)
+            {
+                return p.first->expr->as<AstExprGlobal>()->name == library && p.first->index == call->index;
+            }
+        );
+
+        if (it == loaded.end())
+        {
+            AstStatReturn* stat = parseLibraryFunction(options, library, call->index, names, allocator);
+
+            if (stat)
+                stats.push_back(stat);
+
+            loaded.push_back({call, stat ? stat->list.data[0]->as<AstExprFunction>() : nullptr});
+            it = loaded.end() - 1;
+        }
+
+        if (it->second)
+            result[call] = it->second;
+    }
+}
+
 void compileOrThrow(BytecodeBuilder& bytecode, const ParseResult& parseResult, AstNameTable& names, const CompileOptions& inputOptions)
 {
     LUAU_TIMETRACE_SCOPE("compileOrThrow", "Compiler");
@@ -4997,28 +5617,55 @@ void compileOrThrow(BytecodeBuilder& bytecode, const ParseResult& parseResult, A
 
     AstStatBlock* root = parseResult.root;
 
+    // library member functions are analyzed together with the module and compiled before it, so that calls to them can be inlined
+    // note: analysisRoot is only traversed by the analysis passes; it's never compiled
+    AstStatBlock* analysisRoot = root;
+
+    Allocator libraryAllocator;
+    DenseHashMap<AstExpr*, AstExprFunction*> libraryFunctions{nullptr};
+    std::vector<AstStat*> libraryStats;
+
+    if (FFlag::LuauCompileInlineLibraryFunctions && options.optimizationLevel >= 2 && options.librariesWithKnownMembers &&
+        options.libraryMemberFunctionCb)
+    {
+        loadLibraryFunctions(libraryFunctions, libraryStats, options, root, names, libraryAllocator);
+
+        if (!libraryStats.empty())
+        {
+            libraryStats.push_back(root);
+
+            analysisRoot = libraryAllocator.alloc<AstStatBlock>(root->location, AstArray<AstStat*>{libraryStats.data(), libraryStats.size()});
+        }
+    }
+
     // gathers all functions with the invariant that all function references are to functions earlier in the list
     // for example, function foo() return function() end end will result in two vector entries, [0] = anonymous and [1] = foo
     std::vector<AstExprFunction*> functions;
     Compiler::FunctionVisitor functionVisitor(functions);
-    root->visit(&functionVisitor);
+    analysisRoot->visit(&functionVisitor);
 
     if (functionVisitor.hasNativeFunction)
         setCompileOptionsForNativeCompilation(options);
 
     Compiler compiler(bytecode, options, names);
 
+    for (auto& [call, func] : libraryFunctions)
+    {
+        compiler.libraryFunctions[call] = func;
+        compiler.libraryFunctionExprs.insert(func);
+    }
+
     // since access to some global objects may result in values that change over time, we block imports from non-readonly tables
     assignMutable(compiler.globals, names, options.mutableGlobals);
 
     // this pass analyzes mutability of locals/globals and associates locals with their initial values
-    trackValues(compiler.globals, compiler.variables, root);
+    trackValues(compiler.globals, compiler.variables, analysisRoot);
 
     // this visitor tracks calls to getfenv/setfenv and disables some optimizations when they are found
     if (options.optimizationLevel >= 1 && (names.get("getfenv").value || names.get("setfenv").value))
     {
         Compiler::FenvVisitor fenvVisitor(compiler.getfenvUsed, compiler.setfenvUsed);
-        root->visit(&fenvVisitor);
+        analysisRoot->visit(&fenvVisitor);
     }
 
     // builtin folding is enabled on optimization level 2 since we can't de-optimize folding at runtime
@@ -5046,10 +5693,10 @@ void compileOrThrow(BytecodeBuilder& bytecode, const ParseResult& parseResult, A
     if (options.optimizationLevel >= 1)
     {
         // this pass tracks which calls are builtins and can be compiled more efficiently
-        analyzeBuiltins(compiler.builtins, compiler.globals, compiler.variables, options, root, names);
+        analyzeBuiltins(compiler.builtins, compiler.globals, compiler.variables, options, analysisRoot, names);
 
         // this pass determines which locals hold constant tables that are never mutated
-        buildTableConstantMap(compiler.tableConstants, compiler.variables, root);
+        buildTableConstantMap(compiler.tableConstants, compiler.variables, analysisRoot);
 
         // this pass analyzes constantness of expressions
         foldConstants(
@@ -5059,13 +5706,17 @@ void compileOrThrow(BytecodeBuilder& bytecode, const ParseResult& parseResult, A
             compiler.builtinsFold,
             compiler.builtinsFoldLibraryK,
             options.libraryMemberConstantCb,
-            root,
+            analysisRoot,
             names,
             compiler.tableConstants
         );
 
         // this pass analyzes table assignments to estimate table shapes for initially empty tables
-        predictTableShapes(compiler.tableShapes, root);
+        predictTableShapes(compiler.tableShapes, analysisRoot);
+
+        // this pass finds tables that never escape and can be replaced with their fields
+        if (FFlag::LuauCompileScalarTables && options.optimizationLevel >= 2)
+            predictScalarTables(compiler.scalarTables, analysisRoot);
     }
 
     if (const char* const* ptr = options.userdataTypes)
@@ -5087,7 +5738,7 @@ void compileOrThrow(BytecodeBuilder& bytecode, const ParseResult& parseResult, A
             compiler.functionTypes,
             compiler.localTypes,
             compiler.exprTypes,
-            root,
+            analysisRoot,
             options.vectorType,
             compiler.userdataTypes,
             compiler.builtinTypes,
@@ -5097,8 +5748,24 @@ void compileOrThrow(BytecodeBuilder& bytecode, const ParseResult& parseResult, A
             bytecode
         );
 
-    for (AstExprFunction* expr : functions)
+    // library functions come first; they are compiled to collect the information that the inliner needs, and their bytecode is discarded
+    size_t libraryFunctionCount = libraryStats.empty() ? 0 : libraryStats.size() - 1;
+
+    for (size_t i = 0; i < libraryFunctionCount; ++i)
+    {
+        LUAU_ASSERT(compiler.libraryFunctionExprs.contains(functions[i]));
+
+        uint8_t protoflags = 0;
+        compiler.compileFunction(functions[i], protoflags);
+    }
+
+    if (libraryFunctionCount != 0)
+        bytecode.discardFunctions();
+
+    for (size_t i = libraryFunctionCount; i < functions.size(); ++i)
     {
+        AstExprFunction* expr = functions[i];
+
         uint8_t protoflags = 0;
         compiler.compileFunction(expr, protoflags);
 
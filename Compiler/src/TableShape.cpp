@@ -1,6 +1,8 @@
 // This file is part of the Luau programming language and is licensed under MIT License; see LICENSE.txt for details
 #include "TableShape.h"
 
+#include <string.h>
+
 namespace Luau
 {
 namespace Compile
@@ -9,6 +11,9 @@ namespace Compile
 // conservative limit for the loop bound that establishes table array size
 static const int kMaxLoopBound = 16;
 
+// limit for the number of fields in a table that can be replaced with registers
+static const size_t kMaxScalarTableFields = 8;
+
 static AstExprTable* getTableHint(AstExpr* expr)
 {
     // unadorned table literal
@@ -148,11 +153,145 @@ struct ShapeVisitor : AstVisitor
     }
 };
 
+struct ScalarTableVisitor : AstVisitor
+{
+    DenseHashMap<AstLocal*, AstExprTable*> tables;
+    DenseHashSet<AstLocal*> escaped;
+
+    ScalarTableVisitor()
+        : tables(nullptr)
+        , escaped(nullptr)
+    {
+    }
+
+    bool isScalarCandidate(AstExprTable* table)
+    {
+        if (table->items.size > kMaxScalarTableFields)
+            return false;
+
+        for (size_t i = 0; i < table->items.size; ++i)
+        {
+            const AstExprTable::Item& item = table->items.data[i];
+
+            if (item.kind != AstExprTable::Item::Kind::Record)
+                return false;
+
+            AstExprConstantString* key = item.key->as<AstExprConstantString>();
+            if (!key)
+                return false;
+
+            // duplicate keys would require us to replicate last-store-wins semantics
+            for (size_t j = 0; j < i; ++j)
+            {
+                AstExprConstantString* other = table->items.data[j].key->as<AstExprConstantString>();
+
+                if (other->value.size == key->value.size && memcmp(other->value.data, key->value.data, key->value.size) == 0)
+                    return false;
+            }
+        }
+
+        return true;
+    }
+
+    void markEscaped(AstExpr* var)
+    {
+        if (AstExprIndexName* index = var->as<AstExprIndexName>())
+            if (AstExprLocal* lv = index->expr->as<AstExprLocal>(); lv && tables.contains(lv->local))
+                escaped.insert(lv->local);
+    }
+
+    bool visit(AstStatLocal* node) override
+    {
+        if (node->vars.size == 1 && node->values.size == 1 && !node->vars.data[0]->isExported)
+            if (AstExprTable* table = node->values.data[0]->as<AstExprTable>(); table && isScalarCandidate(table))
+                tables[node->vars.data[0]] = table;
+
+        return true;
+    }
+
+    bool visit(AstExprLocal* node) override
+    {
+        // any use of the table that isn't a field read lets the table escape
+        if (tables.contains(node->local))
+            escaped.insert(node->local);
+
+        return true;
+    }
+
+    bool visit(AstExprIndexName* node) override
+    {
+        AstExprLocal* lv = node->expr->as<AstExprLocal>();
+        if (!lv)
+            return true;
+
+        AstExprTable** table = tables.find(lv->local);
+        if (!table)
+            return true;
+
+        // note: upvalues are excluded since their registers aren't visible to the nested function
+        if (node->op != '.' || lv->upvalue || getTableRecordIndex(*table, node->index) < 0)
+            escaped.insert(lv->local);
+
+        return false;
+    }
+
+    bool visit(AstStatAssign* node) override
+    {
+        for (size_t i = 0; i < node->vars.size; ++i)
+            markEscaped(node->vars.data[i]);
+
+        return true;
+    }
+
+    bool visit(AstStatCompoundAssign* node) override
+    {
+        markEscaped(node->var);
+
+        return true;
+    }
+
+    bool visit(AstStatFunction* node) override
+    {
+        markEscaped(node->name);
+
+        return true;
+    }
+};
+
 void predictTableShapes(DenseHashMap<AstExprTable*, TableShape>& shapes, AstNode* root)
 {
     ShapeVisitor visitor{shapes};
     root->visit(&visitor);
 }
 
+void predictScalarTables(DenseHashMap<AstLocal*, AstExprTable*>& tables, AstNode* root)
+{
+    ScalarTableVisitor visitor;
+    root->visit(&visitor);
+
+    for (auto& [local, table] : visitor.tables)
+        if (!visitor.escaped.contains(local))
+            tables[local] = table;
+}
+
+int getTableRecordIndex(AstExprTable* table, AstName name)
+{
+    size_t length = strlen(name.value);
+
+    for (size_t i = 0; i < table->items.size; ++i)
+    {
+        const AstExprTable::Item& item = table->items.data[i];
+
+        if (item.kind != AstExprTable::Item::Kind::Record)
+            continue;
+
+        if (AstExprConstantString* key = item.key->as<AstExprConstantString>())
+            if (key->value.size == length && memcmp(key->value.data, name.value, length) == 0)
+                return int(i);
+    }
+
+    return -1;
+}
+
 } // namespace Compile
 } // namespace Luau
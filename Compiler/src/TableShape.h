@@ -17,5 +17,12 @@ struct TableShape
 
 void predictTableShapes(DenseHashMap<AstExprTable*, TableShape>& shapes, AstNode* root);
 
+// finds locals initialized with a table literal that never escapes and is only read through fields present in the literal
+// such tables don't need to be allocated; their fields can be kept in registers instead
+void predictScalarTables(DenseHashMap<AstLocal*, AstExprTable*>& tables, AstNode* root);
+
+// returns the index of the record field with the given name in a table literal, or -1 if it's not present
+int getTableRecordIndex(AstExprTable* table, AstName name);
+
 } // namespace Compile
 } // namespace Luau
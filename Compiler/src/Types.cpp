@@ -742,6 +742,7 @@ struct TypeMapVisitor : AstVisitor
             case LBF_BUFFER_WRITEF32:
             case LBF_BUFFER_WRITEF64:
             case LBF_BUFFER_WRITEINTEGER:
+            case LBF_BUFFER_FIND:
                 break;
             case LBF_MATH_ABS:
             case LBF_MATH_ACOS:
@@ -803,6 +804,8 @@ struct TypeMapVisitor : AstVisitor
             case LBF_VECTOR_MAGNITUDE:
             case LBF_VECTOR_DOT:
             case LBF_MATH_LERP:
+            case LBF_BUFFER_COMPARE:
+            case LBF_BUFFER_HASH:
                 recordResolvedType(node, &builtinTypes.numberType);
                 break;
 
@@ -818,6 +821,7 @@ struct TypeMapVisitor : AstVisitor
             case LBF_MATH_ISINF:
             case LBF_MATH_ISFINITE:
             case LBF_RAWEQUAL:
+            case LBF_BUFFER_EQUAL:
                 recordResolvedType(node, &builtinTypes.booleanType);
                 break;
 
@@ -394,6 +394,7 @@ target_sources(Luau.VM PRIVATE
     VM/src/lgc.cpp
     VM/src/lgcdebug.cpp
     VM/src/linit.cpp
+    VM/src/ljsonlib.cpp
     VM/src/lmathlib.cpp
     VM/src/lmem.cpp
     VM/src/lnumprint.cpp
@@ -458,11 +459,13 @@ if(TARGET Luau.Repl.CLI)
     target_sources(Luau.Repl.CLI PRIVATE
         CLI/include/Luau/Counters.h
         CLI/include/Luau/Coverage.h
+        CLI/include/Luau/OpcodePairs.h
         CLI/include/Luau/Profiler.h
         CLI/include/Luau/ReplRequirer.h
 
         CLI/src/Counters.cpp
         CLI/src/Coverage.cpp
+        CLI/src/OpcodePairs.cpp
         CLI/src/Profiler.cpp
         CLI/src/Repl.cpp
         CLI/src/ReplEntry.cpp
@@ -609,11 +612,13 @@ if(TARGET Luau.CLI.Test)
     target_sources(Luau.CLI.Test PRIVATE
         CLI/include/Luau/Counters.h
         CLI/include/Luau/Coverage.h
+        CLI/include/Luau/OpcodePairs.h
         CLI/include/Luau/Profiler.h
         CLI/include/Luau/ReplRequirer.h
 
         CLI/src/Counters.cpp
         CLI/src/Coverage.cpp
+        CLI/src/OpcodePairs.cpp
         CLI/src/Profiler.cpp
         CLI/src/Repl.cpp
         CLI/src/ReplRequirer.cpp
@@ -238,6 +238,23 @@ LUA_API int lua_setfenv(lua_State* L, int idx);
 ** `load' and `call' functions (load and run Luau bytecode)
 */
 LUA_API int luau_load(lua_State* L, const char* chunkname, const char* data, size_t size, int env);
+// same as luau_load, but nested functions are only decoded when their first closure is created
+// functions that were never instantiated are not visible to breakpoints, coverage and native compilation
+LUA_API int luau_loadlazy(lua_State* L, const char* chunkname, const char* data, size_t size, int env);
+// same as luau_loadlazy, but the state doesn't keep a copy of 'data' and decodes functions directly from it
+// 'data' (usually a memory-mapped image) must stay valid and unchanged until the state is closed
+// decoded functions still own their instructions and line info, since instructions are patched in place during execution
+LUA_API int luau_loadmapped(lua_State* L, const char* chunkname, const char* data, size_t size, int env);
+
+// bytecode that is decoded once and shared by all states that load it; bytecode and line info are not duplicated per state
+// unlike luau_loadmapped, decoded functions reference the shared line info instead of owning a copy
+// memory is managed by 'f' with the same contract as lua_newstate, luau_newsharedbytecode returns NULL when an allocation fails
+// shared bytecode must outlive the states that loaded it
+typedef struct lua_SharedBytecode lua_SharedBytecode;
+
+LUA_API lua_SharedBytecode* luau_newsharedbytecode(const char* data, size_t size, lua_Alloc f, void* ud);
+LUA_API void luau_freesharedbytecode(lua_SharedBytecode* shared);
+LUA_API int luau_loadshared(lua_State* L, const char* chunkname, const lua_SharedBytecode* shared, int env);
 LUA_API void lua_call(lua_State* L, int nargs, int nresults);
 LUA_API int lua_pcall(lua_State* L, int nargs, int nresults, int errfunc);
 LUA_API int lua_cpcall(lua_State* L, lua_CFunction func, void* ud);
@@ -471,6 +488,7 @@ LUA_API const char* lua_getupvalue(lua_State* L, int funcindex, int n);
 LUA_API const char* lua_setupvalue(lua_State* L, int funcindex, int n);
 
 LUA_API void lua_singlestep(lua_State* L, int enabled);
+LUA_API int lua_getopcode(lua_State* L, int level);
 LUA_API int lua_breakpoint(lua_State* L, int funcindex, int line, int enabled);
 
 typedef void (*lua_Coverage)(void* context, const char* function, int linedefined, int depth, const int* hits, size_t size);
@@ -154,6 +154,9 @@ LUALIB_API int luaopen_vector(lua_State* L);
 #define LUA_INTLIBNAME "integer"
 LUALIB_API int luaopen_integer(lua_State* L);
 
+#define LUA_JSONLIBNAME "json"
+LUALIB_API int luaopen_json(lua_State* L);
+
 // open all builtin libraries
 LUALIB_API void luaL_openlibs(lua_State* L);
 
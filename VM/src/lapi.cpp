@@ -854,7 +854,15 @@ int lua_rawget(lua_State* L, int idx)
     luaC_threadbarrier(L);
     StkId t = index2addr(L, idx);
     api_check(L, ttistable(t));
-    setobj2s(L, L->top - 1, luaH_get(hvalue(t), L->top - 1));
+    LuaTable* h = hvalue(t);
+    if (const double* slot = hastypedarray(h) ? luaH_gettyped(h, L->top - 1) : NULL)
+    {
+        setnvalue(L->top - 1, *slot);
+    }
+    else
+    {
+        setobj2s(L, L->top - 1, luaH_get(h, L->top - 1));
+    }
     return ttype(L->top - 1);
 }
 
@@ -864,7 +872,15 @@ int lua_rawgeti(lua_State* L, int idx, int n)
     ensure_stack(L, 1);
     StkId t = index2addr(L, idx);
     api_check(L, ttistable(t));
-    setobj2s(L, L->top, luaH_getnum(hvalue(t), n));
+    LuaTable* h = hvalue(t);
+    if (const double* slot = hastypedarray(h) ? luaH_gettypednum(h, n) : NULL)
+    {
+        setnvalue(L->top, *slot);
+    }
+    else
+    {
+        setobj2s(L, L->top, luaH_getnum(h, n));
+    }
     api_incr_top(L);
     return ttype(L->top - 1);
 }
@@ -1009,8 +1025,11 @@ void lua_rawset(lua_State* L, int idx)
     api_check(L, ttistable(t));
     if (hvalue(t)->readonly)
         luaG_readonlyerror(L);
-    setobj2t(L, luaH_set(L, hvalue(t), L->top - 2), L->top - 1);
-    luaC_barriert(L, hvalue(t), L->top - 1);
+    if (!hastypedarray(hvalue(t)) || !luaH_settyped(L, hvalue(t), L->top - 2, L->top - 1))
+    {
+        setobj2t(L, luaH_set(L, hvalue(t), L->top - 2), L->top - 1);
+        luaC_barriert(L, hvalue(t), L->top - 1);
+    }
     L->top -= 2;
 }
 
@@ -1021,8 +1040,13 @@ void lua_rawseti(lua_State* L, int idx, int n)
     api_check(L, ttistable(o));
     if (hvalue(o)->readonly)
         luaG_readonlyerror(L);
-    setobj2t(L, luaH_setnum(L, hvalue(o), n), L->top - 1);
-    luaC_barriert(L, hvalue(o), L->top - 1);
+    TValue k;
+    setnvalue(&k, cast_num(n));
+    if (!hastypedarray(hvalue(o)) || !luaH_settyped(L, hvalue(o), &k, L->top - 1))
+    {
+        setobj2t(L, luaH_setnum(L, hvalue(o), n), L->top - 1);
+        luaC_barriert(L, hvalue(o), L->top - 1);
+    }
     L->top--;
 }
 
@@ -1414,6 +1438,24 @@ int lua_rawiter(lua_State* L, int idx, int iter)
     LuaTable* h = hvalue(t);
     int sizearray = h->sizearray;
 
+    // typed array part has no holes before its size, and hash elements are numbered after its capacity
+    if (hastypedarray(h))
+    {
+        sizearray = h->typedarray->capacity;
+
+        if (unsigned(iter) < unsigned(h->typedarray->size))
+        {
+            StkId top = L->top;
+            setnvalue(top + 0, double(iter + 1));
+            setnvalue(top + 1, h->typedarray->data[iter]);
+            api_update_top(L, top + 2);
+            return iter + 1;
+        }
+
+        if (unsigned(iter) < unsigned(sizearray))
+            iter = sizearray;
+    }
+
     // first we advance iter through the array portion
     for (; unsigned(iter) < unsigned(sizearray); ++iter)
     {
@@ -22,3 +22,34 @@ void luaB_freebuffer(lua_State* L, Buffer* b, lua_Page* page)
 {
     luaM_freegco(L, b, sizebuffer(b->len), b->memcat, page);
 }
+
+int luaB_find(const char* data, unsigned size, const char* needle, size_t needlesize)
+{
+    if (needlesize == 0)
+        return 0;
+
+    if (needlesize > size)
+        return -1;
+
+    char first = needle[0];
+    char last = needle[needlesize - 1];
+
+    // candidates are located with memchr on the first byte; the last byte is checked before the full comparison
+    const char* p = data;
+    const char* end = data + (size - needlesize) + 1;
+
+    while (p < end)
+    {
+        p = (const char*)memchr(p, first, end - p);
+
+        if (!p)
+            return -1;
+
+        if (p[needlesize - 1] == last && memcmp(p, needle, needlesize) == 0)
+            return int(p - data);
+
+        p++;
+    }
+
+    return -1;
+}
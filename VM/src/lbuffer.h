@@ -11,3 +11,6 @@
 
 LUAI_FUNC Buffer* luaB_newbuffer(lua_State* L, size_t s);
 LUAI_FUNC void luaB_freebuffer(lua_State* L, Buffer* u, struct lua_Page* page);
+
+// returns the offset of the first occurrence of the needle in data, or -1 if there is none
+LUAI_FUNC int luaB_find(const char* data, unsigned size, const char* needle, size_t needlesize);
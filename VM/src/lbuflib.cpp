@@ -2,13 +2,21 @@
 #include "lualib.h"
 
 #include "lcommon.h"
+#include "lapi.h"
 #include "lbuffer.h"
+#include "lgc.h"
+#include "lnumutils.h"
+#include "lstate.h"
+#include "lstring.h"
+#include "ltable.h"
 
 #if defined(LUAU_BIG_ENDIAN)
 #include <endian.h>
 #endif
 
 LUAU_FASTFLAG(LuauIntegerLibrary)
+LUAU_FASTFLAGVARIABLE(LuauBufferBulkOperations)
+LUAU_FASTFLAGVARIABLE(LuauBufferTableArrays)
 
 #include <string.h>
 
@@ -368,6 +376,376 @@ static int buffer_writebits(lua_State* L)
     return 0;
 }
 
+static int buffer_find(lua_State* L)
+{
+    size_t len = 0;
+    void* buf = luaL_checkbuffer(L, 1, &len);
+    int offset = luaL_checkinteger(L, 2);
+
+    size_t needlelen = 0;
+    const char* needle = lua_isbuffer(L, 3) ? (const char*)lua_tobuffer(L, 3, &needlelen) : luaL_checklstring(L, 3, &needlelen);
+
+    int count = luaL_optinteger(L, 4, int(len) - offset);
+
+    if (count < 0)
+        luaL_error(L, "buffer access out of bounds");
+
+    if (isoutofbounds(offset, len, unsigned(count)))
+        luaL_error(L, "buffer access out of bounds");
+
+    int pos = luaB_find((char*)buf + offset, unsigned(count), needle, needlelen);
+
+    if (pos < 0)
+        lua_pushnil(L);
+    else
+        lua_pushnumber(L, double(offset + pos));
+
+    return 1;
+}
+
+// reads the (a, aoffset, b, boffset?, count?) arguments shared by compare and equal
+// without a count, each range extends to the end of its buffer
+static void checkbufferranges(lua_State* L, const char** a, unsigned* asize, const char** b, unsigned* bsize)
+{
+    size_t alen = 0;
+    void* abuf = luaL_checkbuffer(L, 1, &alen);
+    int aoffset = luaL_checkinteger(L, 2);
+
+    size_t blen = 0;
+    void* bbuf = luaL_checkbuffer(L, 3, &blen);
+    int boffset = luaL_optinteger(L, 4, 0);
+
+    if (lua_isnoneornil(L, 5))
+    {
+        if (isoutofbounds(aoffset, alen, 0) || isoutofbounds(boffset, blen, 0))
+            luaL_error(L, "buffer access out of bounds");
+
+        *asize = unsigned(alen) - aoffset;
+        *bsize = unsigned(blen) - boffset;
+    }
+    else
+    {
+        int count = luaL_checkinteger(L, 5);
+
+        if (count < 0)
+            luaL_error(L, "buffer access out of bounds");
+
+        if (isoutofbounds(aoffset, alen, unsigned(count)) || isoutofbounds(boffset, blen, unsigned(count)))
+            luaL_error(L, "buffer access out of bounds");
+
+        *asize = unsigned(count);
+        *bsize = unsigned(count);
+    }
+
+    *a = (char*)abuf + aoffset;
+    *b = (char*)bbuf + boffset;
+}
+
+static int buffer_compare(lua_State* L)
+{
+    const char* a;
+    const char* b;
+    unsigned asize, bsize;
+    checkbufferranges(L, &a, &asize, &b, &bsize);
+
+    int result = memcmp(a, b, asize < bsize ? asize : bsize);
+
+    if (result == 0)
+        result = asize < bsize ? -1 : asize > bsize ? 1 : 0;
+
+    lua_pushinteger(L, result < 0 ? -1 : result > 0 ? 1 : 0);
+    return 1;
+}
+
+static int buffer_equal(lua_State* L)
+{
+    const char* a;
+    const char* b;
+    unsigned asize, bsize;
+    checkbufferranges(L, &a, &asize, &b, &bsize);
+
+    lua_pushboolean(L, asize == bsize && memcmp(a, b, asize) == 0);
+    return 1;
+}
+
+static int buffer_hash(lua_State* L)
+{
+    size_t len = 0;
+    void* buf = luaL_checkbuffer(L, 1, &len);
+    int offset = luaL_optinteger(L, 2, 0);
+    int count = luaL_optinteger(L, 3, int(len) - offset);
+
+    if (count < 0)
+        luaL_error(L, "buffer access out of bounds");
+
+    if (isoutofbounds(offset, len, unsigned(count)))
+        luaL_error(L, "buffer access out of bounds");
+
+    // the wide string hash reads every byte, which the string table hash doesn't do for long strings
+    lua_pushunsigned(L, luaS_hashwide((char*)buf + offset, unsigned(count)));
+    return 1;
+}
+
+// element types accepted by buffer.convert, in the order of 'converters' rows and columns
+static const char* const elementtypes[] = {"i8", "u8", "i16", "u16", "i32", "u32", "f32", "f64", NULL};
+static const unsigned elementsizes[] = {1, 1, 2, 2, 4, 4, 4, 8};
+
+template<typename T>
+inline T loadelement(const char* p)
+{
+    T val;
+
+#if defined(LUAU_BIG_ENDIAN)
+    char tmp[sizeof(T)];
+    for (size_t i = 0; i < sizeof(T); i++)
+        tmp[i] = p[sizeof(T) - 1 - i];
+    memcpy(&val, tmp, sizeof(T));
+#else
+    memcpy(&val, p, sizeof(T));
+#endif
+
+    return val;
+}
+
+template<typename T>
+inline void storeelement(char* p, T val)
+{
+#if defined(LUAU_BIG_ENDIAN)
+    char tmp[sizeof(T)];
+    memcpy(tmp, &val, sizeof(T));
+    for (size_t i = 0; i < sizeof(T); i++)
+        p[i] = tmp[sizeof(T) - 1 - i];
+#else
+    memcpy(p, &val, sizeof(T));
+#endif
+}
+
+// integer targets wrap around like buffer.write*, which goes through the same conversion
+template<typename T>
+inline T fromnumber(double value)
+{
+    unsigned u;
+    luai_num2unsigned(u, value);
+    return T(u);
+}
+
+template<>
+inline float fromnumber<float>(double value)
+{
+    return float(value);
+}
+
+template<>
+inline double fromnumber<double>(double value)
+{
+    return value;
+}
+
+// every element type converts to double exactly, so each element is converted as if by buffer.read* followed by buffer.write*
+template<typename T, typename S>
+static void convertelements(char* target, unsigned tstride, const char* source, unsigned sstride, int count)
+{
+    // contiguous arrays get a loop with constant strides that the compiler can vectorize
+    if (tstride == sizeof(T) && sstride == sizeof(S))
+    {
+        for (int i = 0; i < count; i++)
+            storeelement<T>(target + i * sizeof(T), fromnumber<T>(double(loadelement<S>(source + i * sizeof(S)))));
+    }
+    else
+    {
+        for (int i = 0; i < count; i++)
+            storeelement<T>(target + size_t(i) * tstride, fromnumber<T>(double(loadelement<S>(source + size_t(i) * sstride))));
+    }
+}
+
+typedef void (*ConvertFunction)(char* target, unsigned tstride, const char* source, unsigned sstride, int count);
+
+#define CONVERTROW(T) \
+    { \
+        convertelements<T, int8_t>, convertelements<T, uint8_t>, convertelements<T, int16_t>, convertelements<T, uint16_t>, \
+            convertelements<T, int32_t>, convertelements<T, uint32_t>, convertelements<T, float>, convertelements<T, double>, \
+    }
+
+static const ConvertFunction converters[8][8] = {
+    CONVERTROW(int8_t),
+    CONVERTROW(uint8_t),
+    CONVERTROW(int16_t),
+    CONVERTROW(uint16_t),
+    CONVERTROW(int32_t),
+    CONVERTROW(uint32_t),
+    CONVERTROW(float),
+    CONVERTROW(double),
+};
+
+#undef CONVERTROW
+
+// returns the number of bytes spanned by count elements of the given size placed stride bytes apart, erroring if they don't fit into the buffer
+static unsigned checkelementrange(lua_State* L, size_t len, int offset, int count, unsigned size, unsigned stride)
+{
+    if (count == 0)
+        return 0;
+
+    uint64_t span = uint64_t(unsigned(count) - 1) * stride + size;
+
+    if (uint64_t(unsigned(offset)) + span > uint64_t(len))
+        luaL_error(L, "buffer access out of bounds");
+
+    return unsigned(span);
+}
+
+static int buffer_convert(lua_State* L)
+{
+    size_t tlen = 0;
+    void* tbuf = luaL_checkbuffer(L, 1, &tlen);
+    int toffset = luaL_checkinteger(L, 2);
+    int ttype = luaL_checkoption(L, 3, NULL, elementtypes);
+
+    size_t slen = 0;
+    void* sbuf = luaL_checkbuffer(L, 4, &slen);
+    int soffset = luaL_checkinteger(L, 5);
+    int stype = luaL_checkoption(L, 6, NULL, elementtypes);
+
+    int count = luaL_checkinteger(L, 7);
+    int tstride = luaL_optinteger(L, 8, elementsizes[ttype]);
+    int sstride = luaL_optinteger(L, 9, elementsizes[stype]);
+
+    luaL_argcheck(L, count >= 0, 7, "count");
+    luaL_argcheck(L, tstride >= int(elementsizes[ttype]), 8, "stride is smaller than the element size");
+    luaL_argcheck(L, sstride >= int(elementsizes[stype]), 9, "stride is smaller than the element size");
+
+    unsigned tspan = checkelementrange(L, tlen, toffset, count, elementsizes[ttype], unsigned(tstride));
+    unsigned sspan = checkelementrange(L, slen, soffset, count, elementsizes[stype], unsigned(sstride));
+
+    char* target = (char*)tbuf + toffset;
+    const char* source = (char*)sbuf + soffset;
+
+    // overlapping ranges are converted from a copy of the source, so that results don't depend on the iteration order
+    if (tbuf == sbuf && target < source + sspan && source < target + tspan)
+    {
+        void* copy = lua_newbuffer(L, sspan);
+        memcpy(copy, source, sspan);
+        source = (char*)copy;
+    }
+
+    converters[ttype][stype](target, unsigned(tstride), source, unsigned(sstride), count);
+    return 0;
+}
+
+// integers are stored to integer targets without going through a double, so that values past 2^53 keep their low bits
+template<typename T>
+inline T fromvalue(const TValue* value)
+{
+    return ttisinteger(value) ? T(lvalue(value)) : fromnumber<T>(nvalue(value));
+}
+
+template<typename T>
+static void writeelements(char* target, unsigned stride, const TValue* source, int count)
+{
+    if (stride == sizeof(T))
+    {
+        for (int i = 0; i < count; i++)
+            storeelement<T>(target + i * sizeof(T), fromvalue<T>(&source[i]));
+    }
+    else
+    {
+        for (int i = 0; i < count; i++)
+            storeelement<T>(target + size_t(i) * stride, fromvalue<T>(&source[i]));
+    }
+}
+
+typedef void (*WriteElementsFunction)(char* target, unsigned stride, const TValue* source, int count);
+
+static const WriteElementsFunction elementwriters[8] = {
+    writeelements<int8_t>,
+    writeelements<uint8_t>,
+    writeelements<int16_t>,
+    writeelements<uint16_t>,
+    writeelements<int32_t>,
+    writeelements<uint32_t>,
+    writeelements<float>,
+    writeelements<double>,
+};
+
+// index of 'f64' in elementtypes, which is the element type of the typed array part of a table
+#define ELEMENT_F64 7
+
+// numbers in a buffer take 1-8 bytes each instead of a full TValue, so these move whole numeric arrays between the two representations
+static int buffer_readarray(lua_State* L)
+{
+    size_t len = 0;
+    void* buf = luaL_checkbuffer(L, 1, &len);
+    int offset = luaL_checkinteger(L, 2);
+    int type = luaL_checkoption(L, 3, NULL, elementtypes);
+    int count = luaL_checkinteger(L, 4);
+    int stride = luaL_optinteger(L, 5, elementsizes[type]);
+
+    luaL_argcheck(L, count >= 0, 4, "count");
+    luaL_argcheck(L, stride >= int(elementsizes[type]), 5, "stride is smaller than the element size");
+
+    checkelementrange(L, len, offset, count, elementsizes[type], unsigned(stride));
+
+    // result keeps the numbers unboxed until a value that isn't a number is stored into it
+    LuaTable* t = luaH_newtypedarray(L, count);
+
+    TValue v;
+    sethvalue(L, &v, t);
+    luaA_pushvalue(L, &v);
+
+    converters[ELEMENT_F64][type]((char*)t->typedarray->data, sizeof(double), (char*)buf + offset, unsigned(stride), count);
+    return 1;
+}
+
+static int buffer_writearray(lua_State* L)
+{
+    size_t len = 0;
+    void* buf = luaL_checkbuffer(L, 1, &len);
+    int offset = luaL_checkinteger(L, 2);
+    int type = luaL_checkoption(L, 3, NULL, elementtypes);
+    luaL_checktype(L, 4, LUA_TTABLE);
+    int stride = luaL_optinteger(L, 5, elementsizes[type]);
+
+    luaL_argcheck(L, stride >= int(elementsizes[type]), 5, "stride is smaller than the element size");
+
+    LuaTable* t = hvalue(L->base + 3);
+    int count = luaH_getn(t);
+
+    checkelementrange(L, len, offset, count, elementsizes[type], unsigned(stride));
+
+    // typed array part only holds numbers, so it is converted like a buffer with f64 elements
+    if (hastypedarray(t))
+    {
+        converters[type][ELEMENT_F64]((char*)buf + offset, unsigned(stride), (char*)t->typedarray->data, sizeof(double), count);
+        return 0;
+    }
+
+    // elements are validated before anything is written, so a failed call leaves the buffer unchanged
+    if (count <= t->sizearray)
+    {
+        for (int i = 0; i < count; i++)
+            if (!ttisnumber(&t->array[i]) && !ttisinteger(&t->array[i]))
+                luaL_error(L, "invalid value (at index %d) in table for 'writearray'", i + 1);
+
+        elementwriters[type]((char*)buf + offset, unsigned(stride), t->array, count);
+    }
+    else
+    {
+        for (int i = 1; i <= count; i++)
+        {
+            const TValue* e = luaH_getnum(t, i);
+
+            if (!ttisnumber(e) && !ttisinteger(e))
+                luaL_error(L, "invalid value (at index %d) in table for 'writearray'", i);
+        }
+
+        char* target = (char*)buf + offset;
+
+        for (int i = 0; i < count; i++)
+            elementwriters[type](target + size_t(i) * unsigned(stride), unsigned(stride), luaH_getnum(t, i + 1), 1);
+    }
+
+    return 0;
+}
+
 static const luaL_Reg bufferlib[] = {
     {"create", buffer_create},
     {"fromstring", buffer_fromstring},
@@ -430,6 +808,21 @@ static const luaL_Reg bufferlib_NOINTEGER[] = {
     {NULL, NULL},
 };
 
+static const luaL_Reg bufferlib_bulk[] = {
+    {"find", buffer_find},
+    {"compare", buffer_compare},
+    {"equal", buffer_equal},
+    {"hash", buffer_hash},
+    {"convert", buffer_convert},
+    {NULL, NULL},
+};
+
+static const luaL_Reg bufferlib_arrays[] = {
+    {"readarray", buffer_readarray},
+    {"writearray", buffer_writearray},
+    {NULL, NULL},
+};
+
 int luaopen_buffer(lua_State* L)
 {
     if (FFlag::LuauIntegerLibrary)
@@ -437,5 +830,11 @@ int luaopen_buffer(lua_State* L)
     else
         luaL_register(L, LUA_BUFFERLIBNAME, bufferlib_NOINTEGER);
 
+    if (FFlag::LuauBufferBulkOperations)
+        luaL_register(L, NULL, bufferlib_bulk);
+
+    if (FFlag::LuauBufferTableArrays)
+        luaL_register(L, NULL, bufferlib_arrays);
+
     return 1;
 }
@@ -979,7 +979,7 @@ static int luauF_rawequal(lua_State* L, StkId res, TValue* arg0, int nresults, S
 
 static int luauF_rawget(lua_State* L, StkId res, TValue* arg0, int nresults, StkId args, int nparams)
 {
-    if (nparams >= 2 && nresults <= 1 && ttistable(arg0))
+    if (nparams >= 2 && nresults <= 1 && ttistable(arg0) && !hastypedarray(hvalue(arg0)))
     {
         setobj2s(L, res, luaH_get(hvalue(arg0), args));
         return 1;
@@ -1001,7 +1001,7 @@ static int luauF_rawset(lua_State* L, StkId res, TValue* arg0, int nresults, Stk
             return -1;
 
         LuaTable* t = hvalue(arg0);
-        if (t->readonly)
+        if (t->readonly || hastypedarray(t))
             return -1;
 
         setobj2s(L, res, arg0);
@@ -1018,7 +1018,7 @@ static int luauF_tinsert(lua_State* L, StkId res, TValue* arg0, int nresults, St
     if (nparams == 2 && nresults <= 0 && ttistable(arg0))
     {
         LuaTable* t = hvalue(arg0);
-        if (t->readonly)
+        if (t->readonly || hastypedarray(t))
             return -1;
 
         int pos = luaH_getn(t) + 1;
@@ -2494,6 +2494,136 @@ static int luauF_bufferwritelong(lua_State* L, StkId res, TValue* arg0, int nres
     return -1;
 }
 
+// buffer ranges for bulk operations can be empty, so they are checked with a separate condition from single element accesses
+#define checkrangeoutofbounds(offset, count, len) (count < 0 || uint64_t(unsigned(offset)) + unsigned(count) > uint64_t(len))
+
+static int luauF_bufferfind(lua_State* L, StkId res, TValue* arg0, int nresults, StkId args, int nparams)
+{
+    if (nparams >= 3 && nparams <= 4 && nresults <= 1 && ttisbuffer(arg0) && ttisnumber(args) && (ttisstring(args + 1) || ttisbuffer(args + 1)) &&
+        (nparams < 4 || ttisnumber(args + 2)))
+    {
+        Buffer* b = bufvalue(arg0);
+
+        int offset;
+        luai_num2int(offset, nvalue(args));
+
+        int count = int(b->len) - offset;
+        if (nparams >= 4)
+            luai_num2int(count, nvalue(args + 2));
+
+        if (checkrangeoutofbounds(offset, count, b->len))
+            return -1;
+
+        const char* needle = ttisstring(args + 1) ? getstr(tsvalue(args + 1)) : bufvalue(args + 1)->data;
+        size_t needlelen = ttisstring(args + 1) ? tsvalue(args + 1)->len : bufvalue(args + 1)->len;
+
+        int pos = luaB_find(b->data + offset, unsigned(count), needle, needlelen);
+
+        if (pos < 0)
+            setnilvalue(res);
+        else
+            setnvalue(res, double(offset + pos));
+
+        return 1;
+    }
+
+    return -1;
+}
+
+// reads the (a, aoffset, b, boffset?, count?) arguments of buffer.compare and buffer.equal; returns false if the call needs the library function
+static bool getbufferranges(TValue* arg0, StkId args, int nparams, const char** a, unsigned* asize, const char** b, unsigned* bsize)
+{
+    if (nparams < 3 || nparams > 5 || !ttisbuffer(arg0) || !ttisnumber(args) || !ttisbuffer(args + 1))
+        return false;
+
+    if ((nparams >= 4 && !ttisnumber(args + 2)) || (nparams >= 5 && !ttisnumber(args + 3)))
+        return false;
+
+    Buffer* abuf = bufvalue(arg0);
+    Buffer* bbuf = bufvalue(args + 1);
+
+    int aoffset, boffset = 0;
+    luai_num2int(aoffset, nvalue(args));
+    if (nparams >= 4)
+        luai_num2int(boffset, nvalue(args + 2));
+
+    int acount = int(abuf->len) - aoffset;
+    int bcount = int(bbuf->len) - boffset;
+    if (nparams >= 5)
+    {
+        luai_num2int(acount, nvalue(args + 3));
+        bcount = acount;
+    }
+
+    if (checkrangeoutofbounds(aoffset, acount, abuf->len) || checkrangeoutofbounds(boffset, bcount, bbuf->len))
+        return false;
+
+    *a = abuf->data + aoffset;
+    *asize = unsigned(acount);
+    *b = bbuf->data + boffset;
+    *bsize = unsigned(bcount);
+    return true;
+}
+
+static int luauF_buffercompare(lua_State* L, StkId res, TValue* arg0, int nresults, StkId args, int nparams)
+{
+    const char* a;
+    const char* b;
+    unsigned asize, bsize;
+
+    if (nresults <= 1 && getbufferranges(arg0, args, nparams, &a, &asize, &b, &bsize))
+    {
+        int result = memcmp(a, b, asize < bsize ? asize : bsize);
+
+        if (result == 0)
+            result = asize < bsize ? -1 : asize > bsize ? 1 : 0;
+
+        setnvalue(res, result < 0 ? -1.0 : result > 0 ? 1.0 : 0.0);
+        return 1;
+    }
+
+    return -1;
+}
+
+static int luauF_bufferequal(lua_State* L, StkId res, TValue* arg0, int nresults, StkId args, int nparams)
+{
+    const char* a;
+    const char* b;
+    unsigned asize, bsize;
+
+    if (nresults <= 1 && getbufferranges(arg0, args, nparams, &a, &asize, &b, &bsize))
+    {
+        setbvalue(res, asize == bsize && memcmp(a, b, asize) == 0);
+        return 1;
+    }
+
+    return -1;
+}
+
+static int luauF_bufferhash(lua_State* L, StkId res, TValue* arg0, int nresults, StkId args, int nparams)
+{
+    if (nparams >= 1 && nparams <= 3 && nresults <= 1 && ttisbuffer(arg0) && (nparams < 2 || ttisnumber(args)) && (nparams < 3 || ttisnumber(args + 1)))
+    {
+        Buffer* b = bufvalue(arg0);
+
+        int offset = 0;
+        if (nparams >= 2)
+            luai_num2int(offset, nvalue(args));
+
+        int count = int(b->len) - offset;
+        if (nparams >= 3)
+            luai_num2int(count, nvalue(args + 1));
+
+        if (checkrangeoutofbounds(offset, count, b->len))
+            return -1;
+
+        setnvalue(res, double(luaS_hashwide(b->data + offset, unsigned(count))));
+        return 1;
+    }
+
+    return -1;
+}
+
 static int luauF_missing(lua_State* L, StkId res, TValue* arg0, int nresults, StkId args, int nparams)
 {
     return -1;
@@ -2738,6 +2868,11 @@ const luau_FastFunction luauF_table[256] = {
     luauF_bufferreadlong,
     luauF_bufferwritelong,
 
+    luauF_bufferfind,
+    luauF_buffercompare,
+    luauF_bufferequal,
+    luauF_bufferhash,
+
 // When adding builtins, add them above this line; what follows is 64 "dummy" entries with luauF_missing fallback.
 // This is important so that older versions of the runtime that don't support newer builtins automatically fall back via luauF_missing.
 // Given the builtin addition velocity this should always provide a larger compatibility window than bytecode versions suggest.
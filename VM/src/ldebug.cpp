@@ -462,6 +462,26 @@ void lua_singlestep(lua_State* L, int enabled)
     L->singlestep = bool(enabled);
 }
 
+// returns the opcode of the instruction a Luau function at the given level is executing, or -1 for C functions
+// inside of 'debugstep' callback, level 0 refers to the instruction that is about to be executed
+int lua_getopcode(lua_State* L, int level)
+{
+    if (unsigned(level) >= unsigned(L->ci - L->base_ci))
+        return -1;
+
+    CallInfo* ci = L->ci - level;
+    Proto* p = getluaproto(ci);
+
+    if (!p || !ci->savedpc)
+        return -1;
+
+    int pc = currentpc(L, ci);
+    uint8_t op = LUAU_INSN_OP(p->code[pc]);
+
+    // breakpoints keep the original opcode separately
+    return op == LOP_BREAK && p->debuginsn ? p->debuginsn[pc] : op;
+}
+
 static int getmaxline(Proto* p)
 {
     int result = -1;
@@ -536,6 +556,10 @@ int lua_breakpoint(lua_State* L, int funcindex, int line, int enabled)
 
 static void getcoverage(Proto* p, int depth, int* buffer, size_t size, void* context, lua_Coverage callback)
 {
+    // functions of lazily loaded chunks that were never instantiated have no code or debug information
+    if (p->lazychunk)
+        return;
+
     memset(buffer, -1, size * sizeof(int));
 
     for (int i = 0; i < p->sizecode; ++i)
@@ -5,6 +5,7 @@
 #include "lstate.h"
 #include "lmem.h"
 #include "lgc.h"
+#include "lvm.h"
 
 LUAU_FASTFLAG(LuauCIProto)
 LUAU_FASTINTVARIABLE(LuauInlineHitsThreshold, 32)
@@ -62,10 +63,22 @@ Proto* luaF_newproto(lua_State* L)
     f->deoptimized = nullptr;
     f->cost = 0;
 
+    f->lazychunk = NULL;
+
     return f;
 }
 
 Closure* luaF_newLclosure(lua_State* L, int nelems, LuaTable* e, Proto* p)
+{
+    // functions of lazily loaded chunks are decoded when the first closure is created
+    // decoding doesn't run any code or reallocate the stack, so callers can keep stack pointers across closure creation
+    if (p->lazychunk)
+        luaV_loadproto(L, p, e);
+
+    return luaF_newLclosurelazy(L, nelems, e, p);
+}
+
+Closure* luaF_newLclosurelazy(lua_State* L, int nelems, LuaTable* e, Proto* p)
 {
     Closure* c = luaM_newgco(L, Closure, sizeLclosure(nelems), L->activememcat);
     luaC_init(L, c, LUA_TFUNCTION);
@@ -171,10 +184,13 @@ void luaF_closeupval(lua_State* L, UpVal* uv, bool dead)
 
 void luaF_freeproto(lua_State* L, Proto* f, lua_Page* page)
 {
+    if (f->lazychunk)
+        luaV_freelazyproto(L, f);
+
     luaM_freearray(L, f->code, f->sizecode, Instruction, f->memcat);
     luaM_freearray(L, f->p, f->sizep, Proto*, f->memcat);
     luaM_freearray(L, f->k, f->sizek, TValue, f->memcat);
-    if (f->lineinfo)
+    if (f->lineinfo && f->sizelineinfo != 0)
         luaM_freearray(L, f->lineinfo, f->sizelineinfo, uint8_t, f->memcat);
     luaM_freearray(L, f->locvars, f->sizelocvars, struct LocVar, f->memcat);
     luaM_freearray(L, f->upvalues, f->sizeupvalues, TString*, f->memcat);
@@ -10,6 +10,8 @@
 
 LUAI_FUNC Proto* luaF_newproto(lua_State* L);
 LUAI_FUNC Closure* luaF_newLclosure(lua_State* L, int nelems, LuaTable* e, Proto* p);
+// Doesn't decode the function if it comes from a lazily loaded chunk; used for closure constants
+LUAI_FUNC Closure* luaF_newLclosurelazy(lua_State* L, int nelems, LuaTable* e, Proto* p);
 LUAI_FUNC Closure* luaF_newCclosure(lua_State* L, int nelems, LuaTable* e);
 LUAI_FUNC UpVal* luaF_findupval(lua_State* L, StkId level);
 LUAI_FUNC void luaF_close(lua_State* L, StkId level);
@@ -12,6 +12,7 @@
 #include "ludata.h"
 #include "lbuffer.h"
 #include "lclass.h"
+#include "lvm.h"
 
 #include <string.h>
 
@@ -342,6 +343,7 @@ static int traversetable(global_State* g, LuaTable* h)
 
     if (weakkey && weakvalue)
         return 1;
+    // typed array part only holds numbers, so there is nothing to mark in it
     if (!weakvalue)
     {
         i = h->sizearray;
@@ -400,6 +402,10 @@ static void traverseproto(global_State* g, Proto* f)
 
     if (f->deoptimized)
         markobject(g, f->deoptimized);
+
+    // imports of functions that haven't been decoded yet are resolved against the globals the chunk was loaded with
+    if (f->lazychunk)
+        markobject(g, luaV_lazyprotoenv(f));
 }
 
 static void traverseclosure(global_State* g, Closure* cl)
@@ -504,6 +510,12 @@ static void shrinkstackprotected(lua_State* L)
     LUAU_ASSERT(status == LUA_OK || status == LUA_ERRMEM);
 }
 
+// typed array part is a separate block that isn't covered by 'sizearray'
+static size_t typedarraysize(LuaTable* h)
+{
+    return hastypedarray(h) ? sizetypedarray(h->typedarray->capacity) : 0;
+}
+
 /*
 ** traverse one gray object, turning it to black.
 ** Returns `quantity' traversed.
@@ -523,9 +535,9 @@ static size_t propagatemark(global_State* g)
             black2gray(o);       // keep it gray
 
         if (DFFlag::LuauGcTableStepFix)
-            return sizeof(LuaTable) + sizeof(TValue) * h->sizearray + sizeof(LuaNode) * (h->node == &luaH_dummynode ? 0 : sizenode(h));
+            return sizeof(LuaTable) + sizeof(TValue) * h->sizearray + sizeof(LuaNode) * (h->node == &luaH_dummynode ? 0 : sizenode(h)) + typedarraysize(h);
         else
-            return sizeof(LuaTable) + sizeof(TValue) * h->sizearray + sizeof(LuaNode) * sizenode(h);
+            return sizeof(LuaTable) + sizeof(TValue) * h->sizearray + sizeof(LuaNode) * sizenode(h) + typedarraysize(h);
     }
     case LUA_TFUNCTION:
     {
@@ -660,9 +672,9 @@ static size_t cleartable(lua_State* L, GCObject* l)
         LuaTable* h = gco2h(l);
 
         if (DFFlag::LuauGcTableStepFix)
-            work += sizeof(LuaTable) + sizeof(TValue) * h->sizearray + sizeof(LuaNode) * (h->node == &luaH_dummynode ? 0 : sizenode(h));
+            work += sizeof(LuaTable) + sizeof(TValue) * h->sizearray + sizeof(LuaNode) * (h->node == &luaH_dummynode ? 0 : sizenode(h)) + typedarraysize(h);
         else
-            work += sizeof(LuaTable) + sizeof(TValue) * h->sizearray + sizeof(LuaNode) * sizenode(h);
+            work += sizeof(LuaTable) + sizeof(TValue) * h->sizearray + sizeof(LuaNode) * sizenode(h) + typedarraysize(h);
 
         int i = h->sizearray;
         while (i--)
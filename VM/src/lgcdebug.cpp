@@ -342,6 +342,9 @@ static void dumptable(FILE* f, LuaTable* h)
 {
     size_t size = sizeof(LuaTable) + (h->node == &luaH_dummynode ? 0 : sizenode(h) * sizeof(LuaNode)) + h->sizearray * sizeof(TValue);
 
+    if (hastypedarray(h))
+        size += sizetypedarray(h->typedarray->capacity);
+
     fprintf(f, "{\"type\":\"table\",\"cat\":%d,\"size\":%d", h->memcat, int(size));
 
     if (h->node != &luaH_dummynode)
@@ -751,6 +754,9 @@ static void enumtable(EnumContext* ctx, LuaTable* h)
 {
     size_t size = sizeof(LuaTable) + (h->node == &luaH_dummynode ? 0 : sizenode(h) * sizeof(LuaNode)) + h->sizearray * sizeof(TValue);
 
+    if (hastypedarray(h))
+        size += sizetypedarray(h->typedarray->capacity);
+
     // Provide a name for a special registry table
     enumnode(ctx, obj2gco(h), size, h == hvalue(registry(ctx->L)) ? "registry" : NULL);
 
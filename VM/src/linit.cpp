@@ -7,6 +7,7 @@
 
 LUAU_FASTFLAG(LuauIntegerLibrary)
 LUAU_FASTFLAG(DebugLuauUserDefinedClassesRuntime)
+LUAU_FASTFLAG(LuauJsonLibrary)
 
 static const luaL_Reg lualibs[] = {
     {"", luaopen_base},
@@ -54,6 +55,13 @@ void luaL_openlibs(lua_State* L)
         lua_call(L, 1, 0);
     }
 
+    if (FFlag::LuauJsonLibrary)
+    {
+        lua_pushcfunction(L, luaopen_json, NULL);
+        lua_pushstring(L, LUA_JSONLIBNAME);
+        lua_call(L, 1, 0);
+    }
+
     if (FFlag::DebugLuauUserDefinedClassesRuntime)
     {
         lua_pushcfunction(L, luaopen_class, NULL);
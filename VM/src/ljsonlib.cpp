@@ -0,0 +1,1069 @@
+// This file is part of the Luau programming language and is licensed under MIT License; see LICENSE.txt for details
+#include "lualib.h"
+
+#include "lgc.h"
+#include "lnumutils.h"
+#include "lstate.h"
+#include "lstring.h"
+#include "ltable.h"
+#include "ltm.h"
+
+#include <limits.h>
+#include <math.h>
+#include <string.h>
+
+// SSE2 and NEON are part of the baseline for x64 and AArch64 respectively, so the string scanner doesn't need runtime dispatch
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define LUAU_JSON_SSE2
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define LUAU_JSON_NEON
+#endif
+
+#if defined(_MSC_VER) && (defined(LUAU_JSON_SSE2) || defined(LUAU_JSON_NEON))
+#include <intrin.h>
+#endif
+
+LUAU_FASTFLAGVARIABLE(LuauJsonLibrary)
+
+// maximum nesting depth of arrays and objects, for both encoding and decoding
+#define JSON_MAXDEPTH 200
+// number of array elements or object members that are collected on the stack before they are moved into the table
+#define JSON_CHUNKSIZE 256
+// stack size past which nested arrays and objects move every new element into the table, so that deep nesting can't exhaust the stack
+#define JSON_STACKLIMIT (LUAI_MAXCSTACK / 2)
+// sparse arrays that have more than this many slots and are less than half full are rejected instead of being padded with nulls
+#define JSON_SPARSESAFE 10
+
+#define uchar(c) ((unsigned char)(c))
+
+enum JsonSparse
+{
+    JSON_SPARSE_NULL,   // holes are encoded as null
+    JSON_SPARSE_OBJECT, // sparse arrays are encoded as objects with string keys
+    JSON_SPARSE_ERROR,  // sparse arrays are an error
+};
+
+enum JsonNan
+{
+    JSON_NAN_ERROR,   // NaN and infinities are an error
+    JSON_NAN_NULL,    // NaN and infinities are encoded as null
+    JSON_NAN_LITERAL, // NaN, Infinity and -Infinity literals, which are not part of the JSON standard
+};
+
+static int checkjsonoption(lua_State* L, int arg, const char* name, int def, const char* const list[])
+{
+    if (lua_isnoneornil(L, arg))
+        return def;
+
+    luaL_checktype(L, arg, LUA_TTABLE);
+
+    lua_getfield(L, arg, name);
+    int result = def;
+
+    if (!lua_isnil(L, -1))
+    {
+        const char* value = lua_tostring(L, -1);
+
+        for (result = 0; list[result]; ++result)
+            if (value && strcmp(list[result], value) == 0)
+                break;
+
+        if (!list[result])
+            luaL_error(L, "invalid value for option '%s'", name);
+    }
+
+    lua_pop(L, 1);
+    return result;
+}
+
+// returns the first position at or after s that holds a quote, a backslash or a control character, or e if there is none
+static const char* scanstring(const char* s, const char* e)
+{
+#if defined(LUAU_JSON_SSE2)
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+    const __m128i control = _mm_set1_epi8(0x1f);
+
+    for (; e - s >= 16; s += 16)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i*)s);
+        __m128i special = _mm_or_si128(_mm_cmpeq_epi8(v, quote), _mm_cmpeq_epi8(v, backslash));
+        special = _mm_or_si128(special, _mm_cmpeq_epi8(_mm_min_epu8(v, control), v));
+
+        if (unsigned mask = unsigned(_mm_movemask_epi8(special)))
+        {
+#if defined(_MSC_VER)
+            unsigned long rl;
+            _BitScanForward(&rl, mask);
+            return s + rl;
+#else
+            return s + __builtin_ctz(mask);
+#endif
+        }
+    }
+#elif defined(LUAU_JSON_NEON)
+    const uint8x16_t quote = vdupq_n_u8('"');
+    const uint8x16_t backslash = vdupq_n_u8('\\');
+    const uint8x16_t control = vdupq_n_u8(0x20);
+
+    for (; e - s >= 16; s += 16)
+    {
+        uint8x16_t v = vld1q_u8((const uint8_t*)s);
+        uint8x16_t special = vorrq_u8(vorrq_u8(vceqq_u8(v, quote), vceqq_u8(v, backslash)), vcltq_u8(v, control));
+
+        // 4 bits per byte
+        uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(special), 4)), 0);
+
+        if (mask)
+        {
+#if defined(_MSC_VER)
+            unsigned long rl;
+            _BitScanForward64(&rl, mask);
+            return s + (rl >> 2);
+#else
+            return s + (__builtin_ctzll(mask) >> 2);
+#endif
+        }
+    }
+#endif
+
+    for (; s < e; ++s)
+        if (*s == '"' || *s == '\\' || uchar(*s) < 0x20)
+            return s;
+
+    return e;
+}
+
+/*
+** {======================================================
+** Encoding
+** =======================================================
+*/
+
+struct JsonEncoder
+{
+    lua_State* L;
+    luaL_Strbuf* b;
+
+    int sparse;
+    int nan;
+    int depth;
+};
+
+// most writes are short tokens, so the common case of having enough space is handled without a call
+inline void addjson(luaL_Strbuf* b, const char* s, size_t l)
+{
+    if (size_t(b->end - b->p) >= l)
+    {
+        memcpy(b->p, s, l);
+        b->p += l;
+    }
+    else
+    {
+        luaL_addlstring(b, s, l);
+    }
+}
+
+static void encodestring(JsonEncoder* enc, const char* s, size_t l)
+{
+    static const char hex[] = "0123456789abcdef";
+
+    luaL_Strbuf* b = enc->b;
+    const char* e = s + l;
+
+    luaL_addchar(b, '"');
+
+    while (s < e)
+    {
+        const char* special = scanstring(s, e);
+        addjson(b, s, special - s);
+
+        if (special == e)
+            break;
+
+        char ch = *special;
+
+        switch (ch)
+        {
+        case '"':
+        case '\\':
+            luaL_addchar(b, '\\');
+            luaL_addchar(b, ch);
+            break;
+        case '\b':
+            addjson(b, "\\b", 2);
+            break;
+        case '\f':
+            addjson(b, "\\f", 2);
+            break;
+        case '\n':
+            addjson(b, "\\n", 2);
+            break;
+        case '\r':
+            addjson(b, "\\r", 2);
+            break;
+        case '\t':
+            addjson(b, "\\t", 2);
+            break;
+        default:
+        {
+            char esc[6] = {'\\', 'u', '0', '0', hex[uchar(ch) >> 4], hex[uchar(ch) & 15]};
+            addjson(b, esc, sizeof(esc));
+            break;
+        }
+        }
+
+        s = special + 1;
+    }
+
+    luaL_addchar(b, '"');
+}
+
+static void encodenumber(JsonEncoder* enc, double n)
+{
+    if (n != n || n == HUGE_VAL || n == -HUGE_VAL)
+    {
+        if (enc->nan == JSON_NAN_NULL)
+            addjson(enc->b, "null", 4);
+        else if (enc->nan == JSON_NAN_LITERAL)
+            luaL_addstring(enc->b, n != n ? "NaN" : n > 0 ? "Infinity" : "-Infinity");
+        else
+            luaL_error(enc->L, "cannot encode %s", n != n ? "NaN" : "infinity");
+        return;
+    }
+
+    char buf[LUAI_MAXNUM2STR];
+    char* end;
+
+    // integral values are written without an exponent; -0 keeps its sign
+    if (n >= -9007199254740992.0 && n <= 9007199254740992.0 && n == double(int64_t(n)) && (n != 0 || !signbit(n)))
+        end = luai_int2str(buf, int64_t(n));
+    else
+        end = luai_num2str(buf, n);
+
+    addjson(enc->b, buf, end - buf);
+}
+
+static void encodevalue(JsonEncoder* enc, const TValue* v);
+
+// returns the array index that the key corresponds to, or 0 if it isn't one
+static int arraykey(const TValue* key)
+{
+    if (!ttisnumber(key))
+        return 0;
+
+    double n = nvalue(key);
+    return n >= 1 && n <= double(INT_MAX) && n == double(int(n)) ? int(n) : 0;
+}
+
+static void encodekey(JsonEncoder* enc, const TValue* key)
+{
+    if (ttisstring(key))
+    {
+        encodestring(enc, getstr(tsvalue(key)), tsvalue(key)->len);
+    }
+    else if (ttisnumber(key) && enc->sparse == JSON_SPARSE_OBJECT)
+    {
+        luaL_addchar(enc->b, '"');
+        encodenumber(enc, nvalue(key));
+        luaL_addchar(enc->b, '"');
+    }
+    else
+    {
+        luaL_error(enc->L, "cannot encode table with %s keys", luaT_typenames[ttype(key)]);
+    }
+}
+
+static void encodeobject(JsonEncoder* enc, LuaTable* t)
+{
+    luaL_Strbuf* b = enc->b;
+    bool first = true;
+
+    luaL_addchar(b, '{');
+
+    if (hastypedarray(t))
+    {
+        for (int i = 0; i < t->typedarray->size; ++i)
+        {
+            if (!first)
+                luaL_addchar(b, ',');
+            first = false;
+
+            TValue key;
+            setnvalue(&key, double(i + 1));
+            encodekey(enc, &key);
+            luaL_addchar(b, ':');
+            encodenumber(enc, t->typedarray->data[i]);
+        }
+    }
+
+    for (int i = 0; i < t->sizearray; ++i)
+    {
+        if (ttisnil(&t->array[i]))
+            continue;
+
+        if (!first)
+            luaL_addchar(b, ',');
+        first = false;
+
+        TValue key;
+        setnvalue(&key, double(i + 1));
+        encodekey(enc, &key);
+        luaL_addchar(b, ':');
+        encodevalue(enc, &t->array[i]);
+    }
+
+    for (int i = 0; i < sizenode(t); ++i)
+    {
+        LuaNode* n = gnode(t, i);
+
+        if (ttisnil(gval(n)))
+            continue;
+
+        if (!first)
+            luaL_addchar(b, ',');
+        first = false;
+
+        TValue key;
+        getnodekey(enc->L, &key, n);
+        encodekey(enc, &key);
+        luaL_addchar(b, ':');
+        encodevalue(enc, gval(n));
+    }
+
+    luaL_addchar(b, '}');
+}
+
+static void encodetable(JsonEncoder* enc, LuaTable* t)
+{
+    // classify the keys: tables with only positive integer keys are arrays, tables with only string keys are objects
+    int count = 0;
+    int maxindex = 0;
+    bool haskeys = false;
+
+    // typed array part has no holes
+    if (hastypedarray(t))
+    {
+        count = t->typedarray->size;
+        maxindex = count;
+    }
+
+    for (int i = 0; i < t->sizearray; ++i)
+    {
+        if (!ttisnil(&t->array[i]))
+        {
+            count++;
+            maxindex = i + 1;
+        }
+    }
+
+    for (int i = 0; i < sizenode(t); ++i)
+    {
+        LuaNode* n = gnode(t, i);
+
+        if (ttisnil(gval(n)))
+            continue;
+
+        TValue key;
+        getnodekey(enc->L, &key, n);
+
+        if (int index = arraykey(&key))
+        {
+            count++;
+            maxindex = index > maxindex ? index : maxindex;
+        }
+        else
+        {
+            haskeys = true;
+        }
+    }
+
+    // tables without any keys are written as empty arrays
+    if (haskeys)
+    {
+        if (count != 0 && enc->sparse != JSON_SPARSE_OBJECT)
+            luaL_error(enc->L, "cannot encode table with mixed keys");
+
+        encodeobject(enc, t);
+        return;
+    }
+
+    if (count != maxindex)
+    {
+        if (enc->sparse == JSON_SPARSE_OBJECT)
+        {
+            encodeobject(enc, t);
+            return;
+        }
+
+        if (enc->sparse == JSON_SPARSE_ERROR || (maxindex > JSON_SPARSESAFE && maxindex > count * 2))
+            luaL_error(enc->L, "cannot encode sparse array");
+    }
+
+    luaL_Strbuf* b = enc->b;
+
+    luaL_addchar(b, '[');
+
+    for (int i = 1; i <= maxindex; ++i)
+    {
+        if (i > 1)
+            luaL_addchar(b, ',');
+
+        if (hastypedarray(t) && i <= t->typedarray->size)
+            encodenumber(enc, t->typedarray->data[i - 1]);
+        else
+            encodevalue(enc, i <= t->sizearray ? &t->array[i - 1] : luaH_getnum(t, i));
+    }
+
+    luaL_addchar(b, ']');
+}
+
+static void encodevalue(JsonEncoder* enc, const TValue* v)
+{
+    switch (ttype(v))
+    {
+    case LUA_TNIL:
+        addjson(enc->b, "null", 4);
+        break;
+    case LUA_TBOOLEAN:
+        if (bvalue(v))
+            addjson(enc->b, "true", 4);
+        else
+            addjson(enc->b, "false", 5);
+        break;
+    case LUA_TNUMBER:
+        encodenumber(enc, nvalue(v));
+        break;
+    case LUA_TINTEGER:
+    {
+        char buf[LUAI_MAXINT2STR];
+        char* end = luai_int2str(buf, lvalue(v));
+        addjson(enc->b, buf, end - buf);
+        break;
+    }
+    case LUA_TSTRING:
+        encodestring(enc, getstr(tsvalue(v)), tsvalue(v)->len);
+        break;
+    case LUA_TTABLE:
+        // cycles are caught by the depth limit
+        if (++enc->depth > JSON_MAXDEPTH)
+            luaL_error(enc->L, "cannot encode table nested too deeply");
+
+        encodetable(enc, hvalue(v));
+        enc->depth--;
+        break;
+    default:
+        luaL_error(enc->L, "cannot encode %s", luaT_typenames[ttype(v)]);
+    }
+}
+
+static void encode(lua_State* L, luaL_Strbuf* b)
+{
+    luaL_checkany(L, 1);
+
+    static const char* const sparseoptions[] = {"null", "object", "error", NULL};
+    static const char* const nanoptions[] = {"error", "null", "literal", NULL};
+
+    JsonEncoder enc = {L, b};
+    enc.sparse = checkjsonoption(L, 2, "sparse", JSON_SPARSE_NULL, sparseoptions);
+    enc.nan = checkjsonoption(L, 2, "nan", JSON_NAN_ERROR, nanoptions);
+
+    // tables are read directly, and nothing that runs during encoding can change them
+    const TValue* value = L->base;
+
+    luaL_buffinit(L, b);
+    encodevalue(&enc, value);
+}
+
+static int json_encode(lua_State* L)
+{
+    luaL_Strbuf b;
+    encode(L, &b);
+    luaL_pushresult(&b);
+    return 1;
+}
+
+static int json_encodebuffer(lua_State* L)
+{
+    luaL_Strbuf b;
+    encode(L, &b);
+
+    const char* data = b.storage ? getstr(b.storage) : b.buffer;
+    size_t size = b.p - data;
+
+    memcpy(lua_newbuffer(L, size), data, size);
+    return 1;
+}
+
+// }======================================================
+
+/*
+** {======================================================
+** Decoding
+** =======================================================
+*/
+
+struct JsonDecoder
+{
+    lua_State* L;
+
+    const char* begin;
+    const char* p;
+    const char* end;
+
+    bool literals;
+    int depth;
+};
+
+LUAU_NORETURN static void decodeerror(JsonDecoder* dec, const char* message)
+{
+    luaL_error(dec->L, "%s at position %d", message, int(dec->p - dec->begin) + 1);
+}
+
+static void skipspace(JsonDecoder* dec)
+{
+    const char* p = dec->p;
+
+    while (p < dec->end && (*p == ' ' || *p == '\n' || *p == '\r' || *p == '\t'))
+        p++;
+
+    dec->p = p;
+}
+
+static bool matchword(JsonDecoder* dec, const char* word, size_t len)
+{
+    if (size_t(dec->end - dec->p) < len || memcmp(dec->p, word, len) != 0)
+        return false;
+
+    dec->p += len;
+    return true;
+}
+
+static int hexdigit(char ch)
+{
+    if (ch >= '0' && ch <= '9')
+        return ch - '0';
+    if (ch >= 'a' && ch <= 'f')
+        return ch - 'a' + 10;
+    if (ch >= 'A' && ch <= 'F')
+        return ch - 'A' + 10;
+    return -1;
+}
+
+// reads the 4 hex digits after \u
+static unsigned decodehex4(JsonDecoder* dec)
+{
+    if (dec->end - dec->p < 4)
+        decodeerror(dec, "invalid unicode escape");
+
+    unsigned result = 0;
+
+    for (int i = 0; i < 4; ++i)
+    {
+        int digit = hexdigit(dec->p[i]);
+        if (digit < 0)
+            decodeerror(dec, "invalid unicode escape");
+
+        result = result * 16 + digit;
+    }
+
+    dec->p += 4;
+    return result;
+}
+
+static void addutf8(luaL_Strbuf* b, unsigned cp)
+{
+    if (cp < 0x80)
+    {
+        luaL_addchar(b, char(cp));
+    }
+    else if (cp < 0x800)
+    {
+        luaL_addchar(b, char(0xc0 | (cp >> 6)));
+        luaL_addchar(b, char(0x80 | (cp & 0x3f)));
+    }
+    else if (cp < 0x10000)
+    {
+        luaL_addchar(b, char(0xe0 | (cp >> 12)));
+        luaL_addchar(b, char(0x80 | ((cp >> 6) & 0x3f)));
+        luaL_addchar(b, char(0x80 | (cp & 0x3f)));
+    }
+    else
+    {
+        luaL_addchar(b, char(0xf0 | (cp >> 18)));
+        luaL_addchar(b, char(0x80 | ((cp >> 12) & 0x3f)));
+        luaL_addchar(b, char(0x80 | ((cp >> 6) & 0x3f)));
+        luaL_addchar(b, char(0x80 | (cp & 0x3f)));
+    }
+}
+
+// decodes the string at the opening quote and pushes it
+static void decodestring(JsonDecoder* dec)
+{
+    lua_State* L = dec->L;
+    const char* s = ++dec->p;
+    const char* special = scanstring(s, dec->end);
+
+    // strings without escapes are taken from the input as is
+    if (special < dec->end && *special == '"')
+    {
+        lua_pushlstring(L, s, special - s);
+        dec->p = special + 1;
+        return;
+    }
+
+    luaL_Strbuf b;
+    luaL_buffinit(L, &b);
+
+    for (;;)
+    {
+        luaL_addlstring(&b, s, special - s);
+        dec->p = special;
+
+        if (special == dec->end)
+            decodeerror(dec, "unterminated string");
+
+        if (*special == '"')
+            break;
+
+        if (*special != '\\')
+            decodeerror(dec, "control character in string");
+
+        if (++dec->p == dec->end)
+            decodeerror(dec, "unterminated string");
+
+        char ch = *dec->p++;
+
+        switch (ch)
+        {
+        case '"':
+        case '\\':
+        case '/':
+            luaL_addchar(&b, ch);
+            break;
+        case 'b':
+            luaL_addchar(&b, '\b');
+            break;
+        case 'f':
+            luaL_addchar(&b, '\f');
+            break;
+        case 'n':
+            luaL_addchar(&b, '\n');
+            break;
+        case 'r':
+            luaL_addchar(&b, '\r');
+            break;
+        case 't':
+            luaL_addchar(&b, '\t');
+            break;
+        case 'u':
+        {
+            unsigned cp = decodehex4(dec);
+
+            // characters outside of the basic plane are written as surrogate pairs
+            if (cp >= 0xd800 && cp <= 0xdbff)
+            {
+                if (!matchword(dec, "\\u", 2))
+                    decodeerror(dec, "invalid unicode escape");
+
+                unsigned low = decodehex4(dec);
+                if (low < 0xdc00 || low > 0xdfff)
+                    decodeerror(dec, "invalid unicode escape");
+
+                cp = 0x10000 + ((cp - 0xd800) << 10) + (low - 0xdc00);
+            }
+            else if (cp >= 0xdc00 && cp <= 0xdfff)
+            {
+                decodeerror(dec, "invalid unicode escape");
+            }
+
+            addutf8(&b, cp);
+            break;
+        }
+        default:
+            dec->p--;
+            decodeerror(dec, "invalid escape");
+        }
+
+        s = dec->p;
+        special = scanstring(s, dec->end);
+    }
+
+    dec->p++;
+    luaL_pushresult(&b);
+}
+
+static void decodenumber(JsonDecoder* dec)
+{
+    lua_State* L = dec->L;
+    const char* s = dec->p;
+    const char* p = s;
+    const char* e = dec->end;
+
+    bool negative = p < e && *p == '-';
+    if (negative)
+        p++;
+
+    if (dec->literals && size_t(e - p) >= 8 && memcmp(p, "Infinity", 8) == 0)
+    {
+        dec->p = p + 8;
+        lua_pushnumber(L, negative ? -HUGE_VAL : HUGE_VAL);
+        return;
+    }
+
+    const char* digits = p;
+
+    if (p < e && *p == '0')
+        p++;
+    else if (p < e && *p >= '1' && *p <= '9')
+        while (p < e && *p >= '0' && *p <= '9')
+            p++;
+    else
+        decodeerror(dec, "invalid number");
+
+    int intdigits = int(p - digits);
+    bool integer = true;
+
+    if (p < e && *p == '.')
+    {
+        p++;
+        if (p == e || *p < '0' || *p > '9')
+        {
+            dec->p = p;
+            decodeerror(dec, "invalid number");
+        }
+        while (p < e && *p >= '0' && *p <= '9')
+            p++;
+        integer = false;
+    }
+
+    if (p < e && (*p == 'e' || *p == 'E'))
+    {
+        p++;
+        if (p < e && (*p == '+' || *p == '-'))
+            p++;
+        if (p == e || *p < '0' || *p > '9')
+        {
+            dec->p = p;
+            decodeerror(dec, "invalid number");
+        }
+        while (p < e && *p >= '0' && *p <= '9')
+            p++;
+        integer = false;
+    }
+
+    dec->p = p;
+
+    // integers with up to 15 digits are exact, so they don't need the general conversion
+    if (integer && intdigits <= 15)
+    {
+        int64_t value = 0;
+        for (const char* d = digits; d < p; ++d)
+            value = value * 10 + (*d - '0');
+
+        lua_pushnumber(L, negative ? -double(value) : double(value));
+        return;
+    }
+
+    // the conversion needs a terminated copy, and the token was validated so it can't be read as anything else
+    size_t len = p - s;
+    char buf[64];
+    double value;
+
+    if (len < sizeof(buf))
+    {
+        memcpy(buf, s, len);
+        buf[len] = '\0';
+        value = luai_str2num(buf, NULL);
+    }
+    else
+    {
+        int top = lua_gettop(L);
+        luaL_Strbuf b;
+        char* copy = luaL_buffinitsize(L, &b, len + 1);
+        memcpy(copy, s, len);
+        copy[len] = '\0';
+        value = luai_str2num(copy, NULL);
+        lua_settop(L, top);
+    }
+
+    // out of range literals overflow to infinity, which json.encode only accepts with literals enabled
+    if (!dec->literals && isinf(value))
+    {
+        dec->p = s;
+        decodeerror(dec, "number out of range");
+    }
+
+    lua_pushnumber(L, value);
+}
+
+static void decodevalue(JsonDecoder* dec);
+
+static bool shouldflush(lua_State* L, int tab, int slots)
+{
+    int top = lua_gettop(L);
+    return top - tab >= slots || top >= JSON_STACKLIMIT;
+}
+
+// moves the values above the table at index tab into its array part after the first count elements, and returns the new count
+static int flusharray(lua_State* L, int tab, int count)
+{
+    int pending = lua_gettop(L) - tab;
+
+    if (lua_isnil(L, tab))
+    {
+        lua_createtable(L, pending, 0);
+        lua_replace(L, tab);
+    }
+
+    LuaTable* t = hvalue(L->base + (tab - 1));
+
+    if (t->sizearray < count + pending)
+    {
+        int size = t->sizearray * 2;
+        luaH_resizearray(L, t, size > count + pending ? size : count + pending);
+    }
+
+    StkId values = L->top - pending;
+
+    for (int i = 0; i < pending; ++i)
+        setobj2t(L, &t->array[count + i], values + i);
+
+    luaC_barrierfast(L, t);
+
+    lua_settop(L, tab);
+    return count + pending;
+}
+
+// moves the key/value pairs above the table at index tab into its hash part
+static void flushobject(lua_State* L, int tab)
+{
+    int pending = (lua_gettop(L) - tab) / 2;
+
+    if (lua_isnil(L, tab))
+    {
+        lua_createtable(L, 0, pending);
+        lua_replace(L, tab);
+    }
+
+    LuaTable* t = hvalue(L->base + (tab - 1));
+    StkId pairs = L->top - pending * 2;
+
+    for (int i = 0; i < pending; ++i)
+    {
+        TValue* slot = luaH_setstr(L, t, tsvalue(pairs + i * 2));
+        setobj2t(L, slot, pairs + i * 2 + 1);
+    }
+
+    luaC_barrierfast(L, t);
+
+    lua_settop(L, tab);
+}
+
+static void decodearray(JsonDecoder* dec)
+{
+    lua_State* L = dec->L;
+
+    dec->p++;
+
+    // the table is created once the number of elements is known, or once enough of them are collected on the stack
+    lua_pushnil(L);
+    int tab = lua_gettop(L);
+    int count = 0;
+
+    skipspace(dec);
+
+    if (dec->p < dec->end && *dec->p == ']')
+    {
+        dec->p++;
+        lua_createtable(L, 0, 0);
+        lua_replace(L, tab);
+        return;
+    }
+
+    for (;;)
+    {
+        luaL_checkstack(L, 2, "json nesting");
+        decodevalue(dec);
+
+        if (shouldflush(L, tab, JSON_CHUNKSIZE))
+            count = flusharray(L, tab, count);
+
+        skipspace(dec);
+
+        if (dec->p < dec->end && *dec->p == ',')
+        {
+            dec->p++;
+            skipspace(dec);
+            continue;
+        }
+
+        if (dec->p < dec->end && *dec->p == ']')
+        {
+            dec->p++;
+            break;
+        }
+
+        decodeerror(dec, "expected ',' or ']'");
+    }
+
+    flusharray(L, tab, count);
+}
+
+static void decodeobject(JsonDecoder* dec)
+{
+    lua_State* L = dec->L;
+
+    dec->p++;
+
+    lua_pushnil(L);
+    int tab = lua_gettop(L);
+
+    skipspace(dec);
+
+    if (dec->p < dec->end && *dec->p == '}')
+    {
+        dec->p++;
+        lua_createtable(L, 0, 0);
+        lua_replace(L, tab);
+        return;
+    }
+
+    for (;;)
+    {
+        if (dec->p == dec->end || *dec->p != '"')
+            decodeerror(dec, "expected string key");
+
+        luaL_checkstack(L, 3, "json nesting");
+        decodestring(dec);
+
+        skipspace(dec);
+
+        if (dec->p == dec->end || *dec->p != ':')
+            decodeerror(dec, "expected ':'");
+
+        dec->p++;
+        skipspace(dec);
+
+        decodevalue(dec);
+
+        // members with null values are left out
+        if (lua_isnil(L, -1))
+            lua_pop(L, 2);
+
+        if (shouldflush(L, tab, JSON_CHUNKSIZE * 2))
+            flushobject(L, tab);
+
+        skipspace(dec);
+
+        if (dec->p < dec->end && *dec->p == ',')
+        {
+            dec->p++;
+            skipspace(dec);
+            continue;
+        }
+
+        if (dec->p < dec->end && *dec->p == '}')
+        {
+            dec->p++;
+            break;
+        }
+
+        decodeerror(dec, "expected ',' or '}'");
+    }
+
+    flushobject(L, tab);
+}
+
+static void decodevalue(JsonDecoder* dec)
+{
+    lua_State* L = dec->L;
+
+    if (dec->p == dec->end)
+        decodeerror(dec, "unexpected end of input");
+
+    switch (*dec->p)
+    {
+    case '{':
+    case '[':
+        if (++dec->depth > JSON_MAXDEPTH)
+            decodeerror(dec, "nesting too deep");
+
+        if (*dec->p == '{')
+            decodeobject(dec);
+        else
+            decodearray(dec);
+
+        dec->depth--;
+        break;
+    case '"':
+        decodestring(dec);
+        break;
+    case 't':
+        if (!matchword(dec, "true", 4))
+            decodeerror(dec, "invalid literal");
+        lua_pushboolean(L, 1);
+        break;
+    case 'f':
+        if (!matchword(dec, "false", 5))
+            decodeerror(dec, "invalid literal");
+        lua_pushboolean(L, 0);
+        break;
+    case 'n':
+        if (!matchword(dec, "null", 4))
+            decodeerror(dec, "invalid literal");
+        lua_pushnil(L);
+        break;
+    case 'N':
+        if (!dec->literals || !matchword(dec, "NaN", 3))
+            decodeerror(dec, "invalid literal");
+        lua_pushnumber(L, NAN);
+        break;
+    default:
+        decodenumber(dec);
+        break;
+    }
+}
+
+static int json_decode(lua_State* L)
+{
+    size_t len = 0;
+    const char* data;
+
+    if (lua_isbuffer(L, 1))
+        data = (const char*)lua_tobuffer(L, 1, &len);
+    else
+        data = luaL_checklstring(L, 1, &len);
+
+    static const char* const nanoptions[] = {"error", "null", "literal", NULL};
+
+    JsonDecoder dec = {L, data, data, data + len};
+    dec.literals = checkjsonoption(L, 2, "nan", JSON_NAN_ERROR, nanoptions) == JSON_NAN_LITERAL;
+
+    skipspace(&dec);
+    decodevalue(&dec);
+    skipspace(&dec);
+
+    if (dec.p != dec.end)
+        decodeerror(&dec, "unexpected data after the value");
+
+    return 1;
+}
+
+// }======================================================
+
+static const luaL_Reg jsonlib[] = {
+    {"encode", json_encode},
+    {"encodebuffer", json_encodebuffer},
+    {"decode", json_decode},
+    {NULL, NULL},
+};
+
+int luaopen_json(lua_State* L)
+{
+    luaL_register(L, LUA_JSONLIBNAME, jsonlib);
+
+    return 1;
+}
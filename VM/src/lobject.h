@@ -374,7 +374,7 @@ typedef struct Proto
     int sizelocvars;
     int sizeupvalues;
     int sizek;
-    int sizelineinfo;
+    int sizelineinfo; // 0 when lineinfo is shared between states
     int linegaplog2;
     int linedefined;
     int bytecodeid;
@@ -386,6 +386,8 @@ typedef struct Proto
     Proto* optimized;
     Proto* deoptimized;
     uint64_t cost;
+
+    struct LazyChunk* lazychunk; // set when the function body hasn't been decoded yet, see luau_loadlazy
 } Proto;
 // clang-format on
 
@@ -503,6 +505,15 @@ typedef struct LuaNode
         checkliveness(L->global, i_o); \
     }
 
+// typed array part that stores numbers without tags; elements 1..size are all present
+typedef struct LuaTypedArray
+{
+    int size;
+    int capacity;
+
+    double data[1];
+} LuaTypedArray;
+
 // clang-format off
 typedef struct LuaTable
 {
@@ -522,7 +533,11 @@ typedef struct LuaTable
     };
 
     struct LuaTable* metatable;
-    TValue* array;  // array part
+    union
+    {
+        TValue* array;             // array part
+        LuaTypedArray* typedarray; // typed array part; iff sizearray is 0 and this is not NULL
+    };
     LuaNode* node;
     GCObject* gclist;
 } LuaTable;
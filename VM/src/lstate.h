@@ -22,6 +22,8 @@ typedef struct stringtable
     TString** hash;
     uint32_t nuse; // number of elements
     int size;
+
+    bool widehash; // long strings use luaS_hashwide; selected on state creation as hashes can't change while strings exist
 } stringtable;
 // clang-format on
 
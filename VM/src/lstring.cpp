@@ -7,6 +7,11 @@
 
 #include <string.h>
 
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+LUAU_FASTFLAGVARIABLE(LuauWideStringHash)
 
 unsigned int luaS_hash(const char* str, size_t len)
 {
@@ -43,6 +48,69 @@ unsigned int luaS_hash(const char* str, size_t len)
     return h;
 }
 
+// x*y => 128-bit product, folded to 64 bits
+inline uint64_t hashmix(uint64_t x, uint64_t y)
+{
+#if defined(_MSC_VER) && defined(_M_X64)
+    uint64_t hi;
+    uint64_t lo = _umul128(x, y, &hi);
+    return lo ^ hi;
+#elif defined(__SIZEOF_INT128__)
+    unsigned __int128 r = x;
+    r *= y;
+    return uint64_t(r) ^ uint64_t(r >> 64);
+#else
+    uint32_t x0 = uint32_t(x), x1 = uint32_t(x >> 32);
+    uint32_t y0 = uint32_t(y), y1 = uint32_t(y >> 32);
+    uint64_t p11 = uint64_t(x1) * y1, p01 = uint64_t(x0) * y1;
+    uint64_t p10 = uint64_t(x1) * y0, p00 = uint64_t(x0) * y0;
+    uint64_t mid = p10 + (p00 >> 32) + uint32_t(p01);
+    uint64_t r0 = (mid << 32) | uint32_t(p00);
+    uint64_t r1 = p11 + (mid >> 32) + (p01 >> 32);
+    return r0 ^ r1;
+#endif
+}
+
+unsigned int luaS_hashwide(const char* str, size_t len)
+{
+    // Note that this hashing algorithm is replicated in BytecodeBuilder.cpp, BytecodeBuilder::getStringHash
+    // short strings use the same hash as luaS_hash, as the compiler relies on it to predict hash slots of field names
+    if (len < 32)
+        return luaS_hash(str, len);
+
+    // long strings are mixed in 16b chunks using 64-bit multiplication (wyhash)
+    const uint64_t k0 = 0xa0761d6478bd642full;
+    const uint64_t k1 = 0xe7037ed1a0b428dbull;
+    const uint64_t k2 = 0x8ebc6af09c88c6e3ull;
+
+    const char* end = str + len;
+    uint64_t h = hashmix(uint64_t(len) ^ k0, k1);
+
+    while (len > 16)
+    {
+        // should compile into fast unaligned reads
+        uint64_t block[2];
+        memcpy(block, str, 16);
+
+        h = hashmix(block[0] ^ k1, block[1] ^ h);
+        str += 16;
+        len -= 16;
+    }
+
+    // last chunk may overlap with the previous one since the string is at least 32 bytes long
+    uint64_t block[2];
+    memcpy(block, end - 16, 16);
+
+    h = hashmix(block[0] ^ k2, block[1] ^ h);
+
+    return unsigned(h ^ (h >> 32));
+}
+
+inline unsigned int strhash(global_State* g, const char* str, size_t len)
+{
+    return g->strt.widehash ? luaS_hashwide(str, len) : luaS_hash(str, len);
+}
+
 void luaS_resize(lua_State* L, int newsize)
 {
     TString** newhash = luaM_newarray(L, newsize, TString*, 0);
@@ -113,7 +181,7 @@ TString* luaS_bufstart(lua_State* L, size_t size)
 
 TString* luaS_buffinish(lua_State* L, TString* ts)
 {
-    unsigned int h = luaS_hash(ts->data, ts->len);
+    unsigned int h = strhash(L->global, ts->data, ts->len);
     stringtable* tb = &L->global->strt;
     int bucket = lmod(h, tb->size);
 
@@ -147,7 +215,7 @@ TString* luaS_buffinish(lua_State* L, TString* ts)
 
 TString* luaS_newlstr(lua_State* L, const char* str, size_t l)
 {
-    unsigned int h = luaS_hash(str, l);
+    unsigned int h = strhash(L->global, str, l);
     for (TString* el = L->global->strt.hash[lmod(h, L->global->strt.size)]; el != NULL; el = el->next)
     {
         if (el->len == l && (memcmp(str, getstr(el), l) == 0))
@@ -25,6 +25,7 @@
     }
 
 LUAI_FUNC unsigned int luaS_hash(const char* str, size_t len);
+LUAI_FUNC unsigned int luaS_hashwide(const char* str, size_t len);
 
 LUAI_FUNC void luaS_resize(lua_State* L, int newsize);
 
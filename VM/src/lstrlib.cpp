@@ -2,15 +2,183 @@
 // This code is based on Lua 5.x implementation licensed under MIT License; see lua_LICENSE.txt for details
 #include "lualib.h"
 
+#include "lapi.h"
 #include "lstring.h"
 
 #include <ctype.h>
+#include <locale.h>
 #include <string.h>
 #include <stdio.h>
 
+// SSE2 and NEON are part of the baseline for x64 and AArch64 respectively, so byte scanning kernels don't need runtime dispatch
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define LUAU_STRLIB_SSE2
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define LUAU_STRLIB_NEON
+#endif
+
+#if defined(_MSC_VER) && (defined(LUAU_STRLIB_SSE2) || defined(LUAU_STRLIB_NEON))
+#include <intrin.h>
+#endif
+
+LUAU_FASTFLAGVARIABLE(LuauCompiledPatterns)
+LUAU_FASTFLAGVARIABLE(LuauVectorizedStrings)
+LUAU_FASTFLAGVARIABLE(LuauFormatPrograms)
+
 // macro to `unsign' a character
 #define uchar(c) ((unsigned char)(c))
 
+/*
+** {======================================================
+** Byte scanning kernels
+** =======================================================
+*/
+
+#if defined(LUAU_STRLIB_SSE2) || defined(LUAU_STRLIB_NEON)
+#define LUAU_STRLIB_VECTOR
+
+// kernels process 16 bytes at a time and produce a mask with one set bit per matching byte
+typedef uint64_t ScanMask;
+
+#ifdef LUAU_STRLIB_SSE2
+#define SCANMASK_SHIFT 0
+#else
+#define SCANMASK_SHIFT 2 // NEON masks have 4 bits per byte, only the top one is kept
+#endif
+
+inline int scanfirst(ScanMask m)
+{
+    LUAU_ASSERT(m != 0);
+#if defined(_MSC_VER) && defined(_WIN64)
+    unsigned long rl;
+    _BitScanForward64(&rl, m);
+    return int(rl) >> SCANMASK_SHIFT;
+#elif defined(_MSC_VER)
+    unsigned long rl;
+    if (!_BitScanForward(&rl, uint32_t(m)))
+    {
+        _BitScanForward(&rl, uint32_t(m >> 32));
+        rl += 32;
+    }
+    return int(rl) >> SCANMASK_SHIFT;
+#else
+    return __builtin_ctzll(m) >> SCANMASK_SHIFT;
+#endif
+}
+
+#ifdef LUAU_STRLIB_NEON
+inline ScanMask neonmask(uint8x16_t eq)
+{
+    uint8x8_t nibbles = vshrn_n_u16(vreinterpretq_u16_u8(eq), 4);
+    return vget_lane_u64(vreinterpret_u64_u8(nibbles), 0) & 0x8888888888888888ull;
+}
+#endif
+
+// positions i in [0, 16) where a[i] == ca and b[i] == cb
+inline ScanMask scanpair(const char* a, const char* b, char ca, char cb)
+{
+#ifdef LUAU_STRLIB_SSE2
+    __m128i ea = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)a), _mm_set1_epi8(ca));
+    __m128i eb = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)b), _mm_set1_epi8(cb));
+    return ScanMask(unsigned(_mm_movemask_epi8(_mm_and_si128(ea, eb))));
+#else
+    uint8x16_t ea = vceqq_u8(vld1q_u8((const uint8_t*)a), vdupq_n_u8(uint8_t(ca)));
+    uint8x16_t eb = vceqq_u8(vld1q_u8((const uint8_t*)b), vdupq_n_u8(uint8_t(cb)));
+    return neonmask(vandq_u8(ea, eb));
+#endif
+}
+
+// checks if any of the 16 bytes is one of the pattern SPECIALS
+inline bool scanspecials(const char* p)
+{
+#ifdef LUAU_STRLIB_SSE2
+    __m128i v = _mm_loadu_si128((const __m128i*)p);
+    __m128i r = _mm_cmpeq_epi8(v, _mm_set1_epi8('^'));
+    r = _mm_or_si128(r, _mm_cmpeq_epi8(v, _mm_set1_epi8('$')));
+    r = _mm_or_si128(r, _mm_cmpeq_epi8(v, _mm_set1_epi8('*')));
+    r = _mm_or_si128(r, _mm_cmpeq_epi8(v, _mm_set1_epi8('+')));
+    r = _mm_or_si128(r, _mm_cmpeq_epi8(v, _mm_set1_epi8('?')));
+    r = _mm_or_si128(r, _mm_cmpeq_epi8(v, _mm_set1_epi8('.')));
+    r = _mm_or_si128(r, _mm_cmpeq_epi8(v, _mm_set1_epi8('(')));
+    r = _mm_or_si128(r, _mm_cmpeq_epi8(v, _mm_set1_epi8('[')));
+    r = _mm_or_si128(r, _mm_cmpeq_epi8(v, _mm_set1_epi8('%')));
+    r = _mm_or_si128(r, _mm_cmpeq_epi8(v, _mm_set1_epi8('-')));
+    return _mm_movemask_epi8(r) != 0;
+#else
+    uint8x16_t v = vld1q_u8((const uint8_t*)p);
+    uint8x16_t r = vceqq_u8(v, vdupq_n_u8('^'));
+    r = vorrq_u8(r, vceqq_u8(v, vdupq_n_u8('$')));
+    r = vorrq_u8(r, vceqq_u8(v, vdupq_n_u8('*')));
+    r = vorrq_u8(r, vceqq_u8(v, vdupq_n_u8('+')));
+    r = vorrq_u8(r, vceqq_u8(v, vdupq_n_u8('?')));
+    r = vorrq_u8(r, vceqq_u8(v, vdupq_n_u8('.')));
+    r = vorrq_u8(r, vceqq_u8(v, vdupq_n_u8('(')));
+    r = vorrq_u8(r, vceqq_u8(v, vdupq_n_u8('[')));
+    r = vorrq_u8(r, vceqq_u8(v, vdupq_n_u8('%')));
+    r = vorrq_u8(r, vceqq_u8(v, vdupq_n_u8('-')));
+    return vmaxvq_u8(r) != 0;
+#endif
+}
+
+// flips the case of bytes in [first, last] range; returns false without writing anything if the block has non-ASCII bytes
+inline bool flipcase(char* dst, const char* src, char first, char last)
+{
+#ifdef LUAU_STRLIB_SSE2
+    __m128i v = _mm_loadu_si128((const __m128i*)src);
+    if (_mm_movemask_epi8(v) != 0)
+        return false;
+
+    // all bytes are in [0, 127] so signed comparisons are safe
+    __m128i in = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8(char(first - 1))), _mm_cmplt_epi8(v, _mm_set1_epi8(char(last + 1))));
+    _mm_storeu_si128((__m128i*)dst, _mm_xor_si128(v, _mm_and_si128(in, _mm_set1_epi8(0x20))));
+#else
+    uint8x16_t v = vld1q_u8((const uint8_t*)src);
+    if (vmaxvq_u8(v) >= 0x80)
+        return false;
+
+    uint8x16_t in = vandq_u8(vcgeq_u8(v, vdupq_n_u8(uint8_t(first))), vcleq_u8(v, vdupq_n_u8(uint8_t(last))));
+    vst1q_u8((uint8_t*)dst, veorq_u8(v, vandq_u8(in, vdupq_n_u8(0x20))));
+#endif
+    return true;
+}
+
+static bool isclocale()
+{
+    const char* locale = setlocale(LC_CTYPE, NULL);
+    return locale && (strcmp(locale, "C") == 0 || strcmp(locale, "POSIX") == 0);
+}
+#endif
+
+// in the "C" locale, blocks of ASCII bytes are mapped directly; everything else goes through the C library so that the current locale is respected
+static void casemap(char* dst, const char* src, size_t l, bool upper)
+{
+    size_t i = 0;
+
+#ifdef LUAU_STRLIB_VECTOR
+    // ASCII letters only have a fixed mapping in the "C" locale; in others (e.g. Turkish, where 'i' maps to a non-ASCII letter), flipping
+    // them directly would make the result depend on where the 16-byte blocks start
+    // LC_CTYPE is checked on every call since the host can change it at any time; the lookup is cheap next to the conversion
+    if (l >= 16 && isclocale())
+    {
+        for (; i + 16 <= l; i += 16)
+        {
+            if (flipcase(dst + i, src + i, upper ? 'a' : 'A', upper ? 'z' : 'Z'))
+                continue;
+
+            for (size_t j = i; j < i + 16; j++)
+                dst[j] = char(upper ? toupper(uchar(src[j])) : tolower(uchar(src[j])));
+        }
+    }
+#endif
+
+    for (; i < l; i++)
+        dst[i] = char(upper ? toupper(uchar(src[i])) : tolower(uchar(src[i])));
+}
+
+// }======================================================
+
 static int str_len(lua_State* L)
 {
     size_t l;
@@ -62,8 +230,15 @@ static int str_lower(lua_State* L)
     const char* s = luaL_checklstring(L, 1, &l);
     luaL_Strbuf b;
     char* ptr = luaL_buffinitsize(L, &b, l);
-    for (size_t i = 0; i < l; i++)
-        *ptr++ = tolower(uchar(s[i]));
+    if (FFlag::LuauVectorizedStrings)
+    {
+        casemap(ptr, s, l, /* upper */ false);
+    }
+    else
+    {
+        for (size_t i = 0; i < l; i++)
+            *ptr++ = tolower(uchar(s[i]));
+    }
     luaL_pushresultsize(&b, l);
     return 1;
 }
@@ -74,8 +249,15 @@ static int str_upper(lua_State* L)
     const char* s = luaL_checklstring(L, 1, &l);
     luaL_Strbuf b;
     char* ptr = luaL_buffinitsize(L, &b, l);
-    for (size_t i = 0; i < l; i++)
-        *ptr++ = toupper(uchar(s[i]));
+    if (FFlag::LuauVectorizedStrings)
+    {
+        casemap(ptr, s, l, /* upper */ true);
+    }
+    else
+    {
+        for (size_t i = 0; i < l; i++)
+            *ptr++ = toupper(uchar(s[i]));
+    }
     luaL_pushresultsize(&b, l);
     return 1;
 }
@@ -98,6 +280,13 @@ static int str_rep(lua_State* L)
     luaL_Strbuf b;
     char* ptr = luaL_buffinitsize(L, &b, l * n);
 
+    if (FFlag::LuauVectorizedStrings && l == 1)
+    {
+        memset(ptr, s[0], n);
+        luaL_pushresultsize(&b, n);
+        return 1;
+    }
+
     const char* start = ptr;
 
     size_t left = l * n;
@@ -425,12 +614,8 @@ static const char* match_capture(MatchState* ms, const char* s, int l)
         return NULL;
 }
 
-static const char* match(MatchState* ms, const char* s, const char* p)
+static void matchinterrupt(lua_State* L)
 {
-    if (ms->matchdepth-- == 0)
-        luaL_error(ms->L, "pattern too complex");
-
-    lua_State* L = ms->L;
     void (*interrupt)(lua_State*, int) = L->global->cb.interrupt;
 
     if (LUAU_UNLIKELY(!!interrupt))
@@ -440,6 +625,14 @@ static const char* match(MatchState* ms, const char* s, const char* p)
         interrupt(L, -1);
         L->nCcalls--;
     }
+}
+
+static const char* match(MatchState* ms, const char* s, const char* p)
+{
+    if (ms->matchdepth-- == 0)
+        luaL_error(ms->L, "pattern too complex");
+
+    matchinterrupt(ms->L);
 
 init: // using goto's to optimize tail recursion
     if (p != ms->p_end)
@@ -561,18 +754,721 @@ init: // using goto's to optimize tail recursion
                 case '-': // 0 or more repetitions (minimum)
                     s = min_expand(ms, s, p, ep);
                     break;
-                default: // no suffix
-                    s++;
-                    p = ep;
-                    goto init; // return match(ms, s + 1, ep);
+                default: // no suffix
+                    s++;
+                    p = ep;
+                    goto init; // return match(ms, s + 1, ep);
+                }
+            }
+            break;
+        }
+        }
+    }
+    ms->matchdepth++;
+    return s;
+}
+
+/*
+** Compiled patterns
+**
+** Patterns are translated once into a list of items with precomputed character sets and cached per pattern string.
+** The matcher follows the same steps as match(), but keeps its choice points on an explicit stack: every frame
+** corresponds to a recursive match() call, so depth limits, interrupts and capture state are the same.
+** Patterns that could raise an error while matching are never compiled and are left to match().
+*/
+
+// maximum length of a pattern that is compiled
+#define PATTERN_MAXLENGTH 1024
+// number of compiled patterns kept by the string library
+#define PATTERN_CACHESIZE 64
+
+enum PatternOp
+{
+    PO_CHAR,     // single character, possibly repeated
+    PO_SET,      // character set, possibly repeated
+    PO_STRING,   // sequence of single characters
+    PO_OPEN,     // capture start
+    PO_POSITION, // position capture
+    PO_CLOSE,    // capture end
+    PO_END,      // end of subject anchor
+    PO_BALANCE,  // %b
+    PO_FRONTIER, // %f
+    PO_BACKREF,  // %1-%9
+};
+
+struct PatternItem
+{
+    uint8_t op;
+    uint8_t rep;   // '*', '+', '-', '?' or 0 for a single match
+    uint8_t a;     // character, capture index or the opening character of %b
+    uint8_t b;     // closing character of %b
+    uint32_t data; // offset of the character set or string in the program
+    uint32_t len;  // string length
+};
+
+struct PatternProgram
+{
+    uint32_t itemcount;
+    uint32_t first;  // offset of the character set that every match starts with, or 0 when the match can start anywhere
+    uint8_t anchor;  // pattern starts with '^'
+    uint8_t firstch; // the only character every match starts with, valid when firstop is PO_CHAR
+    uint8_t firstop; // PO_CHAR or PO_SET when the first character is known, 0xff otherwise
+};
+
+#define PATTERN_SETSIZE 32
+
+#define patternitems(prog) ((const PatternItem*)((const char*)(prog) + sizeof(PatternProgram)))
+#define patternset(prog, offset) ((const uint8_t*)(prog) + (offset))
+#define insetbit(set, c) (((set)[(c) >> 3] >> ((c)&7)) & 1)
+
+struct PatternBuilder
+{
+    char* data; // NULL when only measuring the program size
+
+    uint32_t itemcount;
+    uint32_t setcount;
+    uint32_t strsize;
+
+    uint32_t setbase;
+    uint32_t strbase;
+};
+
+static const char* pclassend(const char* p, const char* pe)
+{
+    switch (*p++)
+    {
+    case L_ESC:
+        return p == pe ? NULL : p + 1;
+    case '[':
+        if (*p == '^')
+            p++;
+        do
+        {
+            if (p == pe)
+                return NULL;
+            if (*(p++) == L_ESC && p < pe)
+                p++;
+        } while (*p != ']');
+        return p + 1;
+    default:
+        return p;
+    }
+}
+
+static PatternItem* pushitem(PatternBuilder* pb, uint8_t op)
+{
+    uint32_t index = pb->itemcount++;
+
+    if (!pb->data)
+        return NULL;
+
+    PatternItem* item = (PatternItem*)(pb->data + sizeof(PatternProgram)) + index;
+    memset(item, 0, sizeof(PatternItem));
+    item->op = op;
+    return item;
+}
+
+// computes the set of characters matched by a single character class that starts at p and ends before ep
+static uint32_t pushset(PatternBuilder* pb, const char* p, const char* ep, int frontier, int* single)
+{
+    uint8_t set[PATTERN_SETSIZE] = {};
+    int count = 0;
+    int last = 0;
+
+    for (int c = 0; c < 256; ++c)
+    {
+        int in;
+
+        if (frontier || *p == '[')
+            in = matchbracketclass(c, p, ep - 1);
+        else if (*p == '.')
+            in = 1;
+        else if (*p == L_ESC)
+            in = match_class(c, uchar(*(p + 1)));
+        else
+            in = uchar(*p) == c;
+
+        if (in)
+        {
+            set[c >> 3] |= uint8_t(1 << (c & 7));
+            count++;
+            last = c;
+        }
+    }
+
+    *single = count == 1 ? last : -1;
+
+    // classes that match a single character are stored as that character
+    if (count == 1 && !frontier)
+        return 0;
+
+    uint32_t offset = pb->setbase + pb->setcount++ * PATTERN_SETSIZE;
+
+    if (pb->data)
+        memcpy(pb->data + offset, set, PATTERN_SETSIZE);
+
+    return offset;
+}
+
+// returns false when the pattern may raise an error during matching and has to be interpreted instead
+static bool buildpattern(PatternBuilder* pb, const char* p, const char* pe)
+{
+    int level = 0;
+    uint32_t unfinished = 0;
+    int lastchar = -1; // index of the last item if it can be extended into a string
+
+    while (p < pe)
+    {
+        switch (*p)
+        {
+        case '(':
+        {
+            if (level >= LUA_MAXCAPTURES)
+                return false;
+
+            bool position = *(p + 1) == ')';
+
+            if (PatternItem* item = pushitem(pb, position ? PO_POSITION : PO_OPEN))
+                item->a = uint8_t(level);
+
+            if (!position)
+                unfinished |= 1u << level;
+
+            level++;
+            p += position ? 2 : 1;
+            lastchar = -1;
+            continue;
+        }
+        case ')':
+        {
+            int l = level - 1;
+            while (l >= 0 && !(unfinished & (1u << l)))
+                l--;
+
+            if (l < 0)
+                return false;
+
+            if (PatternItem* item = pushitem(pb, PO_CLOSE))
+                item->a = uint8_t(l);
+
+            unfinished &= ~(1u << l);
+            p++;
+            lastchar = -1;
+            continue;
+        }
+        case '$':
+        {
+            if (p + 1 != pe)
+                break;
+
+            pushitem(pb, PO_END);
+            p++;
+            lastchar = -1;
+            continue;
+        }
+        case L_ESC:
+        {
+            char next = *(p + 1);
+
+            if (next == 'b')
+            {
+                if (p + 2 >= pe - 1)
+                    return false;
+
+                if (PatternItem* item = pushitem(pb, PO_BALANCE))
+                {
+                    item->a = uchar(*(p + 2));
+                    item->b = uchar(*(p + 3));
+                }
+
+                p += 4;
+                lastchar = -1;
+                continue;
+            }
+            else if (next == 'f')
+            {
+                p += 2;
+                if (*p != '[')
+                    return false;
+
+                const char* ep = pclassend(p, pe);
+                if (!ep)
+                    return false;
+
+                int single = 0;
+                uint32_t set = pushset(pb, p, ep, /* frontier= */ 1, &single);
+
+                if (PatternItem* item = pushitem(pb, PO_FRONTIER))
+                    item->data = set;
+
+                p = ep;
+                lastchar = -1;
+                continue;
+            }
+            else if (isdigit(uchar(next)))
+            {
+                int l = next - '1';
+                if (l < 0 || l >= level || (unfinished & (1u << l)))
+                    return false;
+
+                if (PatternItem* item = pushitem(pb, PO_BACKREF))
+                    item->a = uint8_t(l);
+
+                p += 2;
+                lastchar = -1;
+                continue;
+            }
+            break;
+        }
+        }
+
+        // pattern class plus optional suffix
+        const char* ep = pclassend(p, pe);
+        if (!ep)
+            return false;
+
+        uint8_t rep = (ep < pe && (*ep == '*' || *ep == '+' || *ep == '-' || *ep == '?')) ? uint8_t(*ep) : 0;
+
+        int single = 0;
+        uint32_t set = pushset(pb, p, ep, /* frontier= */ 0, &single);
+
+        if (single >= 0 && rep == 0 && lastchar >= 0)
+        {
+            // consecutive single characters are matched together; strings are laid out in pattern order
+            if (pb->data)
+            {
+                PatternItem* item = (PatternItem*)(pb->data + sizeof(PatternProgram)) + lastchar;
+
+                if (item->op == PO_CHAR)
+                {
+                    item->op = PO_STRING;
+                    item->data = pb->strbase + pb->strsize++;
+                    item->len = 1;
+                    pb->data[item->data] = char(item->a);
+                }
+
+                pb->data[item->data + item->len++] = char(single);
+                pb->strsize++;
+            }
+        }
+        else
+        {
+            if (PatternItem* item = pushitem(pb, single >= 0 ? PO_CHAR : PO_SET))
+            {
+                item->rep = rep;
+                item->a = uint8_t(single >= 0 ? single : 0);
+                item->data = set;
+            }
+
+            lastchar = single >= 0 && rep == 0 ? int(pb->itemcount - 1) : -1;
+        }
+
+        p = rep ? ep + 1 : ep;
+    }
+
+    // match results with unfinished captures raise an error
+    return unfinished == 0;
+}
+
+// compiles the pattern into a buffer that is left on the stack; returns NULL and leaves the stack unchanged if the pattern has to be interpreted
+static const PatternProgram* compilepattern(lua_State* L, const char* p, size_t lp)
+{
+    int anchor = (*p == '^');
+    if (anchor)
+    {
+        p++;
+        lp--;
+    }
+
+    PatternBuilder pb = {};
+    if (!buildpattern(&pb, p, p + lp))
+        return NULL;
+
+    // strings can't be longer than the pattern itself
+    uint32_t setbase = uint32_t(sizeof(PatternProgram) + pb.itemcount * sizeof(PatternItem));
+    uint32_t strbase = setbase + pb.setcount * PATTERN_SETSIZE;
+
+    char* data = (char*)lua_newbuffer(L, strbase + lp);
+
+    PatternBuilder fill = {data, 0, 0, 0, setbase, strbase};
+    bool success = buildpattern(&fill, p, p + lp);
+    LUAU_ASSERT(success && fill.itemcount == pb.itemcount && fill.setcount == pb.setcount);
+    (void)success;
+
+    PatternProgram* prog = (PatternProgram*)data;
+    prog->itemcount = pb.itemcount;
+    prog->anchor = uint8_t(anchor);
+    prog->firstop = 0xff;
+
+    // find the character that has to be present at the start of every match, captures don't consume any
+    for (uint32_t i = 0; i < prog->itemcount; ++i)
+    {
+        const PatternItem* item = &patternitems(prog)[i];
+
+        if (item->op == PO_OPEN || item->op == PO_POSITION || item->op == PO_CLOSE)
+            continue;
+
+        if ((item->op == PO_CHAR || item->op == PO_BALANCE) && (item->rep == 0 || item->rep == '+'))
+        {
+            prog->firstop = PO_CHAR;
+            prog->firstch = item->a;
+        }
+        else if (item->op == PO_STRING)
+        {
+            prog->firstop = PO_CHAR;
+            prog->firstch = uchar(data[item->data]);
+        }
+        else if (item->op == PO_SET && (item->rep == 0 || item->rep == '+'))
+        {
+            prog->firstop = PO_SET;
+            prog->first = item->data;
+        }
+        break;
+    }
+
+    return prog;
+}
+
+// looks the string argument up in the cache of compiled programs in the first upvalue; a compiled program is left on the stack
+// once the cache is full it starts over, the number of cached strings is stored in its array part
+static int cachelookup(lua_State* L, int arg, int cachesize)
+{
+    int cache = lua_upvalueindex(1);
+
+    lua_pushvalue(L, arg);
+    int type = lua_rawget(L, cache);
+
+    if (type == LUA_TBUFFER)
+        return type;
+
+    lua_pop(L, 1);
+
+    if (type == LUA_TNIL)
+    {
+        lua_rawgeti(L, cache, 1);
+        int count = lua_tointeger(L, -1);
+        lua_pop(L, 1);
+
+        if (count >= cachesize)
+        {
+            lua_cleartable(L, cache);
+            count = 0;
+        }
+
+        lua_pushinteger(L, count + 1);
+        lua_rawseti(L, cache, 1);
+    }
+
+    return type;
+}
+
+// remembers the program at the top of the stack for the string argument, or that the string can't be compiled
+static void cachestore(lua_State* L, int arg, bool compiled)
+{
+    lua_pushvalue(L, arg);
+    if (compiled)
+        lua_pushvalue(L, -2);
+    else
+        lua_pushboolean(L, 0);
+    lua_rawset(L, lua_upvalueindex(1));
+}
+
+// returns the compiled pattern from the cache in the first upvalue and keeps it alive on the stack, or returns NULL if the pattern has to be
+// interpreted
+static const PatternProgram* getpattern(lua_State* L, int arg, const char* p, size_t lp)
+{
+    // functions registered while LuauCompiledPatterns was off don't have a cache
+    if (lp > PATTERN_MAXLENGTH || curr_func(L)->nupvalues == 0)
+        return NULL;
+
+    int type = cachelookup(L, arg, PATTERN_CACHESIZE);
+
+    if (type == LUA_TBUFFER)
+        return (const PatternProgram*)lua_tobuffer(L, -1, NULL);
+
+    // patterns that can't be compiled are remembered as well
+    if (type == LUA_TBOOLEAN)
+        return NULL;
+
+    const PatternProgram* prog = compilepattern(L, p, lp);
+    cachestore(L, arg, prog != NULL);
+
+    return prog;
+}
+
+// returns the first position at or after s where a match can start, or NULL if there is none
+static const char* pskip(const PatternProgram* prog, const char* s, const char* e)
+{
+    if (prog->firstop == PO_CHAR)
+        return s < e ? (const char*)memchr(s, prog->firstch, e - s) : NULL;
+
+    if (prog->firstop == PO_SET)
+    {
+        const uint8_t* set = patternset(prog, prog->first);
+
+        for (; s < e; ++s)
+            if (insetbit(set, uchar(*s)))
+                return s;
+
+        return NULL;
+    }
+
+    return s;
+}
+
+static int psingle(const PatternProgram* prog, const PatternItem* item, const char* s, const char* e)
+{
+    if (s >= e)
+        return 0;
+
+    int c = uchar(*s);
+    return item->op == PO_CHAR ? c == item->a : insetbit(patternset(prog, item->data), c);
+}
+
+enum PatternFrameKind
+{
+    PF_CAPTURE,  // start_capture
+    PF_CLOSE,    // end_capture
+    PF_OPTIONAL, // '?' that matched
+    PF_MAX,      // max_expand
+    PF_MIN,      // min_expand
+};
+
+struct PatternFrame
+{
+    uint8_t kind;
+    uint8_t capture;
+    uint32_t next; // item that follows the repetition
+    const char* s;
+    ptrdiff_t count;
+};
+
+// every frame corresponds to a nested match() call, so the depth limit and interrupts are the same
+static PatternFrame* pushframe(MatchState* ms, PatternFrame* frames, int& top, uint8_t kind, const char* s, uint32_t next)
+{
+    if (top >= LUAI_MAXCCALLS - 1)
+        luaL_error(ms->L, "pattern too complex");
+
+    matchinterrupt(ms->L);
+
+    PatternFrame* f = &frames[top++];
+    f->kind = kind;
+    f->capture = 0;
+    f->next = next;
+    f->s = s;
+    f->count = 0;
+    return f;
+}
+
+static const char* pmatch(MatchState* ms, const PatternProgram* prog, const char* s)
+{
+    const PatternItem* items = patternitems(prog);
+    const char* end = ms->src_end;
+
+    PatternFrame frames[LUAI_MAXCCALLS - 1];
+    int top = 0;
+    uint32_t pc = 0;
+
+    matchinterrupt(ms->L);
+
+    for (;;)
+    {
+        if (pc == prog->itemcount)
+            return s;
+
+        const PatternItem* item = &items[pc];
+
+        switch (item->op)
+        {
+        case PO_CHAR:
+        case PO_SET:
+        {
+            if (!psingle(prog, item, s, end))
+            {
+                // accept empty?
+                if (item->rep == '*' || item->rep == '?' || item->rep == '-')
+                {
+                    pc++;
+                    continue;
+                }
+                break;
+            }
+
+            switch (item->rep)
+            {
+            case '?':
+                pushframe(ms, frames, top, PF_OPTIONAL, s, pc + 1);
+                s++;
+                pc++;
+                continue;
+            case '+':
+                s++; // 1 match already done
+                LUAU_FALLTHROUGH;
+            case '*':
+            {
+                ptrdiff_t i = 0;
+                while (psingle(prog, item, s + i, end))
+                    i++;
+
+                PatternFrame* f = pushframe(ms, frames, top, PF_MAX, s, pc + 1);
+                f->count = i;
+                s += i;
+                pc++;
+                continue;
+            }
+            case '-':
+                pushframe(ms, frames, top, PF_MIN, s, pc + 1);
+                pc++;
+                continue;
+            default:
+                s++;
+                pc++;
+                continue;
+            }
+        }
+        case PO_STRING:
+        {
+            if (size_t(end - s) >= item->len && memcmp(s, (const char*)prog + item->data, item->len) == 0)
+            {
+                s += item->len;
+                pc++;
+                continue;
+            }
+            break;
+        }
+        case PO_OPEN:
+        case PO_POSITION:
+        {
+            int level = ms->level;
+            ms->capture[level].init = s;
+            ms->capture[level].len = item->op == PO_POSITION ? CAP_POSITION : CAP_UNFINISHED;
+            ms->level = level + 1;
+
+            pushframe(ms, frames, top, PF_CAPTURE, s, pc + 1);
+            pc++;
+            continue;
+        }
+        case PO_CLOSE:
+        {
+            ms->capture[item->a].len = s - ms->capture[item->a].init;
+
+            PatternFrame* f = pushframe(ms, frames, top, PF_CLOSE, s, pc + 1);
+            f->capture = item->a;
+            pc++;
+            continue;
+        }
+        case PO_END:
+        {
+            if (s == end)
+            {
+                pc++;
+                continue;
+            }
+            break;
+        }
+        case PO_BALANCE:
+        {
+            if (uchar(*s) != item->a)
+                break;
+
+            const char* r = s;
+            int cont = 1;
+            while (++r < end)
+            {
+                if (uchar(*r) == item->b)
+                {
+                    if (--cont == 0)
+                        break;
+                }
+                else if (uchar(*r) == item->a)
+                    cont++;
+            }
+
+            if (r < end)
+            {
+                s = r + 1;
+                pc++;
+                continue;
+            }
+            break;
+        }
+        case PO_FRONTIER:
+        {
+            const uint8_t* set = patternset(prog, item->data);
+            int previous = (s == ms->src_init) ? 0 : uchar(*(s - 1));
+
+            if (!insetbit(set, previous) && insetbit(set, uchar(*s)))
+            {
+                pc++;
+                continue;
+            }
+            break;
+        }
+        case PO_BACKREF:
+        {
+            size_t len = ms->capture[item->a].len;
+
+            if (size_t(end - s) >= len && memcmp(ms->capture[item->a].init, s, len) == 0)
+            {
+                s += len;
+                pc++;
+                continue;
+            }
+            break;
+        }
+        }
+
+        // the current item failed to match, resume from the innermost frame that has alternatives left
+        for (;;)
+        {
+            if (top == 0)
+                return NULL;
+
+            PatternFrame* f = &frames[top - 1];
+
+            if (f->kind == PF_CAPTURE)
+            {
+                ms->level--; // undo capture
+            }
+            else if (f->kind == PF_CLOSE)
+            {
+                ms->capture[f->capture].len = CAP_UNFINISHED; // undo capture
+            }
+            else if (f->kind == PF_OPTIONAL)
+            {
+                top--;
+                s = f->s;
+                pc = f->next;
+                break;
+            }
+            else if (f->kind == PF_MAX)
+            {
+                if (f->count > 0)
+                {
+                    matchinterrupt(ms->L);
+
+                    f->count--; // reduce 1 repetition to try again
+                    s = f->s + f->count;
+                    pc = f->next;
+                    break;
+                }
+            }
+            else if (f->kind == PF_MIN)
+            {
+                if (psingle(prog, &items[f->next - 1], f->s, end))
+                {
+                    matchinterrupt(ms->L);
+
+                    f->s++; // try with one more repetition
+                    s = f->s;
+                    pc = f->next;
+                    break;
                 }
             }
-            break;
-        }
+
+            top--;
         }
     }
-    ms->matchdepth++;
-    return s;
 }
 
 static const char* lmemfind(const char* s1, size_t l1, const char* s2, size_t l2)
@@ -583,6 +1479,31 @@ static const char* lmemfind(const char* s1, size_t l1, const char* s2, size_t l2
         return NULL; // avoids a negative `l1'
     else
     {
+#ifdef LUAU_STRLIB_VECTOR
+        // check the first and the last character of `s2' for 16 positions at a time, comparing the rest only on candidates
+        if (FFlag::LuauVectorizedStrings && l2 > 1)
+        {
+            const char* last = s1 + (l1 - l2); // last position where `s2' can start
+
+            while (last - s1 >= 15)
+            {
+                ScanMask m = scanpair(s1, s1 + l2 - 1, s2[0], s2[l2 - 1]);
+
+                while (m)
+                {
+                    const char* init = s1 + scanfirst(m);
+                    if (memcmp(init + 1, s2 + 1, l2 - 2) == 0)
+                        return init;
+                    m &= m - 1;
+                }
+
+                s1 += 16;
+            }
+
+            l1 = last - s1 + l2;
+        }
+#endif
+
         const char* init; // to search for a `*s2' inside `s1'
         l2--;             // 1st char will be checked by `memchr'
         l1 = l1 - l2;     // `s2' cannot be found after that
@@ -635,6 +1556,22 @@ static int push_captures(MatchState* ms, const char* s, const char* e)
 // check whether pattern has no special characters
 static int nospecials(const char* p, size_t l)
 {
+#ifdef LUAU_STRLIB_VECTOR
+    if (FFlag::LuauVectorizedStrings)
+    {
+        size_t i = 0;
+        for (; i + 16 <= l; i += 16)
+            if (scanspecials(p + i))
+                return 0;
+
+        for (; i < l; i++)
+            if (p[i] != 0 && strchr(SPECIALS, p[i]))
+                return 0;
+
+        return 1;
+    }
+#endif
+
     size_t upto = 0;
     do
     {
@@ -689,6 +1626,7 @@ static int str_find_aux(lua_State* L, int find)
     {
         MatchState ms;
         const char* s1 = s + init - 1;
+        const PatternProgram* prog = FFlag::LuauCompiledPatterns ? getpattern(L, 2, p, lp) : NULL;
         int anchor = (*p == '^');
         if (anchor)
         {
@@ -699,8 +1637,10 @@ static int str_find_aux(lua_State* L, int find)
         do
         {
             const char* res;
+            if (prog && !anchor && (s1 = pskip(prog, s1, ms.src_end)) == NULL)
+                break;
             reprepstate(&ms);
-            if ((res = match(&ms, s1, p)) != NULL)
+            if ((res = prog ? pmatch(&ms, prog, s1) : match(&ms, s1, p)) != NULL)
             {
                 if (find)
                 {
@@ -733,13 +1673,16 @@ static int gmatch_aux(lua_State* L)
     size_t ls, lp;
     const char* s = lua_tolstring(L, lua_upvalueindex(1), &ls);
     const char* p = lua_tolstring(L, lua_upvalueindex(2), &lp);
+    const PatternProgram* prog = lua_isbuffer(L, lua_upvalueindex(4)) ? (const PatternProgram*)lua_tobuffer(L, lua_upvalueindex(4), NULL) : NULL;
     const char* src;
     prepstate(&ms, L, s, ls, p, lp);
     for (src = s + (size_t)lua_tointeger(L, lua_upvalueindex(3)); src <= ms.src_end; src++)
     {
         const char* e;
+        if (prog && (src = pskip(prog, src, ms.src_end)) == NULL)
+            break;
         reprepstate(&ms);
-        if ((e = match(&ms, src, p)) != NULL)
+        if ((e = prog ? pmatch(&ms, prog, src) : match(&ms, src, p)) != NULL)
         {
             int newstart = (int)(e - s);
             if (e == src)
@@ -754,11 +1697,16 @@ static int gmatch_aux(lua_State* L)
 
 static int gmatch(lua_State* L)
 {
+    size_t lp;
     luaL_checkstring(L, 1);
-    luaL_checkstring(L, 2);
+    const char* p = luaL_checklstring(L, 2, &lp);
     lua_settop(L, 2);
     lua_pushinteger(L, 0);
-    lua_pushcclosure(L, gmatch_aux, NULL, 3);
+    // '^' is a regular character in gmatch, while compiled patterns treat it as an anchor
+    if (FFlag::LuauCompiledPatterns && *p != '^' && getpattern(L, 2, p, lp))
+        lua_pushcclosure(L, gmatch_aux, NULL, 4);
+    else
+        lua_pushcclosure(L, gmatch_aux, NULL, 3);
     return 1;
 }
 
@@ -840,6 +1788,7 @@ static int str_gsub(lua_State* L)
     MatchState ms;
     luaL_Strbuf b;
     luaL_argexpected(L, tr == LUA_TNUMBER || tr == LUA_TSTRING || tr == LUA_TFUNCTION || tr == LUA_TTABLE, 3, "string/function/table");
+    const PatternProgram* prog = FFlag::LuauCompiledPatterns ? getpattern(L, 2, p, lp) : NULL;
     luaL_buffinit(L, &b);
     if (anchor)
     {
@@ -850,8 +1799,17 @@ static int str_gsub(lua_State* L)
     while (n < max_s)
     {
         const char* e;
+        if (prog && !anchor)
+        {
+            // positions where the pattern can't match are copied as is
+            const char* next = pskip(prog, src, ms.src_end);
+            if (next == NULL)
+                break;
+            luaL_addlstring(&b, src, next - src);
+            src = next;
+        }
         reprepstate(&ms);
-        e = match(&ms, src, p);
+        e = prog ? pmatch(&ms, prog, src) : match(&ms, src, p);
         if (e)
         {
             n++;
@@ -963,6 +1921,413 @@ static void addInt64Format(char form[MAX_FORMAT], char formatIndicator, size_t f
     form[formatItemSize + 3] = 0;
 }
 
+/*
+** Format programs
+** A format string is split once into literal text and conversion items, and the result is cached by string.format
+** the same way compiled patterns are. Integer, character and string conversions with no precision and no flags other
+** than '-' and '0' are written straight into the result buffer; floating point and the remaining conversions still use
+** snprintf, with the specification prepared at compile time.
+** Format strings that raise an error are never compiled, so the interpreter loop reports errors in the same order.
+*/
+
+// maximum length of a format string that is compiled
+#define FORMAT_MAXLENGTH 1024
+// number of compiled format strings kept by string.format
+#define FORMAT_CACHESIZE 64
+
+enum FormatOp
+{
+    FO_TEXT,   // literal text from the format string
+    FO_ANY,    // %*
+    FO_DIRECT, // conversion written without snprintf
+    FO_PRINTF, // conversion written with snprintf
+};
+
+struct FormatItem
+{
+    uint8_t op;
+    char conv;      // conversion character
+    uint8_t left;   // '-' flag
+    uint8_t zero;   // '0' flag
+    uint32_t width; // minimum width of direct conversions
+    uint32_t start; // offset of the literal text in the format string
+    uint32_t len;
+    char form[MAX_FORMAT]; // format specification for snprintf
+};
+
+struct FormatProgram
+{
+    uint32_t itemcount;
+};
+
+#define formatitems(prog) ((const FormatItem*)((const char*)(prog) + sizeof(FormatProgram)))
+
+// parses the format string into items, or only counts them when items is NULL; returns -1 if the format string can't be compiled
+static int buildformat(FormatItem* items, const char* fmt, size_t len)
+{
+    const char* p = fmt;
+    const char* e = fmt + len;
+    int count = 0;
+
+    while (p < e)
+    {
+        if (*p != L_ESC)
+        {
+            const char* text = p;
+            while (p < e && *p != L_ESC)
+                p++;
+
+            if (items)
+            {
+                FormatItem& item = items[count];
+                item.op = FO_TEXT;
+                item.start = uint32_t(text - fmt);
+                item.len = uint32_t(p - text);
+            }
+            count++;
+            continue;
+        }
+
+        const char* spec = ++p;
+
+        if (p < e && *p == L_ESC)
+        {
+            // %% is literal text that consists of the second '%'
+            if (items)
+            {
+                FormatItem& item = items[count];
+                item.op = FO_TEXT;
+                item.start = uint32_t(p - fmt);
+                item.len = 1;
+            }
+            count++;
+            p++;
+            continue;
+        }
+
+        if (p < e && *p == '*')
+        {
+            if (items)
+                items[count].op = FO_ANY;
+            count++;
+            p++;
+            continue;
+        }
+
+        bool left = false, zero = false, otherflags = false;
+        while (p < e && *p != '\0' && strchr(FLAGS, *p) != NULL)
+        {
+            left |= *p == '-';
+            zero |= *p == '0';
+            otherflags |= *p != '-' && *p != '0';
+            p++;
+        }
+        if (size_t(p - spec) >= sizeof(FLAGS))
+            return -1;
+
+        uint32_t width = 0;
+        for (int i = 0; i < 2 && p < e && isdigit(uchar(*p)); ++i)
+            width = width * 10 + (*p++ - '0');
+
+        bool precision = p < e && *p == '.';
+        if (precision)
+        {
+            p++;
+            for (int i = 0; i < 2 && p < e && isdigit(uchar(*p)); ++i)
+                p++;
+        }
+
+        if (p == e || *p == '\0' || isdigit(uchar(*p)) || !strchr("cdiouxXeEfgGqs", *p))
+            return -1;
+
+        char conv = *p++;
+
+        if (items)
+        {
+            FormatItem& item = items[count];
+            item.conv = conv;
+            item.left = left;
+            item.zero = zero && !left;
+            item.width = width;
+
+            bool simple = !otherflags && !precision;
+
+            if (conv == 'q')
+                item.op = FO_DIRECT; // flags are ignored by %q
+            else if (conv == 'c' || conv == 's')
+                item.op = simple && !zero ? FO_DIRECT : FO_PRINTF;
+            else if (strchr("diouxX", conv))
+                item.op = simple ? FO_DIRECT : FO_PRINTF;
+            else
+                item.op = FO_PRINTF;
+
+            // same specification as the one built by scanformat
+            size_t size = p - spec;
+            item.form[0] = '%';
+            memcpy(item.form + 1, spec, size);
+            item.form[size + 1] = '\0';
+
+            if (strchr("diouxX", conv))
+                addInt64Format(item.form, conv, size);
+        }
+        count++;
+    }
+
+    return count;
+}
+
+static const FormatProgram* compileformat(lua_State* L, const char* fmt, size_t len)
+{
+    int count = buildformat(NULL, fmt, len);
+    if (count < 0)
+        return NULL;
+
+    FormatProgram* prog = (FormatProgram*)lua_newbuffer(L, sizeof(FormatProgram) + count * sizeof(FormatItem));
+    prog->itemcount = count;
+
+    int filled = buildformat((FormatItem*)formatitems(prog), fmt, len);
+    LUAU_ASSERT(filled == count);
+    (void)filled;
+
+    return prog;
+}
+
+// returns the compiled format string from the cache in the first upvalue and keeps it alive on the stack, or returns NULL if the format
+// string has to be interpreted
+// the last format string and its program are also kept in the second and third upvalues, since the same call site tends to repeat
+static const FormatProgram* getformat(lua_State* L, int arg, const char* fmt, size_t len)
+{
+    // the check is done on the closure directly because it's on the path of every call
+    Closure* cl = curr_func(L);
+
+    // format registered while LuauFormatPrograms was off doesn't have a cache
+    if (cl->nupvalues == 0)
+        return NULL;
+
+    if (ttisstring(&cl->c.upvals[1]) && tsvalue(&cl->c.upvals[1]) == tsvalue(L->base + (arg - 1)))
+    {
+        luaA_pushvalue(L, &cl->c.upvals[2]);
+        return (const FormatProgram*)bufvalue(&cl->c.upvals[2])->data;
+    }
+
+    if (len > FORMAT_MAXLENGTH)
+        return NULL;
+
+    int type = cachelookup(L, arg, FORMAT_CACHESIZE);
+
+    if (type == LUA_TBOOLEAN)
+        return NULL;
+
+    const FormatProgram* prog = type == LUA_TBUFFER ? (const FormatProgram*)lua_tobuffer(L, -1, NULL) : compileformat(L, fmt, len);
+
+    if (type != LUA_TBUFFER)
+        cachestore(L, arg, prog != NULL);
+
+    if (prog)
+    {
+        lua_pushvalue(L, arg);
+        lua_replace(L, lua_upvalueindex(2));
+        lua_pushvalue(L, -1);
+        lua_replace(L, lua_upvalueindex(3));
+    }
+
+    return prog;
+}
+
+// adds a converted value padded to the item width, zeroes go between the sign and the digits like in printf
+static void addpadded(luaL_Strbuf* b, const FormatItem* item, bool negative, const char* s, size_t l)
+{
+    size_t total = l + negative;
+    size_t pad = item->width > total ? item->width - total : 0;
+
+    if (pad && !item->left && !item->zero)
+    {
+        memset(luaL_prepbuffsize(b, pad), ' ', pad);
+        b->p += pad;
+    }
+
+    if (negative)
+        luaL_addchar(b, '-');
+
+    if (pad && item->zero)
+    {
+        memset(luaL_prepbuffsize(b, pad), '0', pad);
+        b->p += pad;
+    }
+
+    luaL_addlstring(b, s, l);
+
+    if (pad && item->left)
+    {
+        memset(luaL_prepbuffsize(b, pad), ' ', pad);
+        b->p += pad;
+    }
+}
+
+// writes the digits of v backwards from end and returns the first one
+static char* formatdigits(char* end, uint64_t v, unsigned base, const char* digits)
+{
+    do
+    {
+        *--end = digits[v % base];
+        v /= base;
+    } while (v != 0);
+
+    return end;
+}
+
+static void adddirect(lua_State* L, luaL_Strbuf* b, const FormatItem* item, int arg)
+{
+    char buff[32];
+    char* end = buff + sizeof(buff);
+
+    switch (item->conv)
+    {
+    case 'c':
+    {
+        char ch = char((int)luaL_checknumber(L, arg));
+        addpadded(b, item, false, &ch, 1);
+        break;
+    }
+    case 'd':
+    case 'i':
+    {
+        long long value = lua_isinteger64(L, arg) ? luaL_checkinteger64(L, arg) : (int64_t)luaL_checknumber(L, arg);
+        uint64_t magnitude = value < 0 ? ~uint64_t(value) + 1 : uint64_t(value);
+        char* s = formatdigits(end, magnitude, 10, "0123456789");
+        addpadded(b, item, value < 0, s, end - s);
+        break;
+    }
+    case 'o':
+    case 'u':
+    case 'x':
+    case 'X':
+    {
+        uint64_t v;
+        if (lua_isinteger64(L, arg))
+        {
+            v = luaL_checkinteger64(L, arg);
+        }
+        else
+        {
+            double argValue = luaL_checknumber(L, arg);
+            v = (argValue < 0) ? (unsigned long long)(long long)argValue : (unsigned long long)argValue;
+        }
+
+        unsigned base = item->conv == 'o' ? 8 : item->conv == 'u' ? 10 : 16;
+        char* s = formatdigits(end, v, base, item->conv == 'X' ? "0123456789ABCDEF" : "0123456789abcdef");
+        addpadded(b, item, false, s, end - s);
+        break;
+    }
+    case 'q':
+    {
+        addquoted(L, b, arg);
+        break;
+    }
+    case 's':
+    {
+        size_t l;
+        const char* s = luaL_checklstring(L, arg, &l);
+
+        // like snprintf, short strings that are padded stop at the first zero byte
+        if (item->width == 0 && !item->left)
+            luaL_addlstring(b, s, l);
+        else if (l >= 100)
+            luaL_addlstring(b, s, l);
+        else
+            addpadded(b, item, false, s, strlen(s));
+        break;
+    }
+    default:
+        LUAU_ASSERT(!"unexpected conversion");
+    }
+}
+
+static void addprintf(lua_State* L, luaL_Strbuf* b, const FormatItem* item, int arg)
+{
+    char buff[MAX_ITEM]; // to store the formatted item
+
+    switch (item->conv)
+    {
+    case 'c':
+    {
+        int count = snprintf(buff, sizeof(buff), item->form, (int)luaL_checknumber(L, arg));
+        luaL_addlstring(b, buff, count);
+        return;
+    }
+    case 'd':
+    case 'i':
+    {
+        long long value = lua_isinteger64(L, arg) ? luaL_checkinteger64(L, arg) : (int64_t)luaL_checknumber(L, arg);
+        snprintf(buff, sizeof(buff), item->form, value);
+        break;
+    }
+    case 'o':
+    case 'u':
+    case 'x':
+    case 'X':
+    {
+        uint64_t v;
+        if (lua_isinteger64(L, arg))
+        {
+            v = luaL_checkinteger64(L, arg);
+        }
+        else
+        {
+            double argValue = luaL_checknumber(L, arg);
+            v = (argValue < 0) ? (unsigned long long)(long long)argValue : (unsigned long long)argValue;
+        }
+        snprintf(buff, sizeof(buff), item->form, v);
+        break;
+    }
+    case 's':
+    {
+        size_t l;
+        const char* s = luaL_checklstring(L, arg, &l);
+        if (!strchr(item->form, '.') && l >= 100)
+        {
+            luaL_addlstring(b, s, l);
+            return;
+        }
+        snprintf(buff, sizeof(buff), item->form, s);
+        break;
+    }
+    default:
+    {
+        snprintf(buff, sizeof(buff), item->form, (double)luaL_checknumber(L, arg));
+        break;
+    }
+    }
+
+    luaL_addlstring(b, buff, strlen(buff));
+}
+
+static void runformat(lua_State* L, luaL_Strbuf* b, const FormatProgram* prog, const char* strfrmt, int top)
+{
+    int arg = 1;
+
+    for (uint32_t i = 0; i < prog->itemcount; ++i)
+    {
+        const FormatItem* item = &formatitems(prog)[i];
+
+        if (item->op == FO_TEXT)
+        {
+            luaL_addlstring(b, strfrmt + item->start, item->len);
+            continue;
+        }
+
+        if (++arg > top)
+            luaL_error(L, "missing argument #%d", arg);
+
+        if (item->op == FO_ANY)
+            luaL_addvalueany(b, arg);
+        else if (item->op == FO_DIRECT)
+            adddirect(L, b, item, arg);
+        else
+            addprintf(L, b, item, arg);
+    }
+}
+
 static int str_format(lua_State* L)
 {
     int top = lua_gettop(L);
@@ -970,6 +2335,19 @@ static int str_format(lua_State* L)
     size_t sfl;
     const char* strfrmt = luaL_checklstring(L, arg, &sfl);
     const char* strfrmt_end = strfrmt + sfl;
+
+    if (FFlag::LuauFormatPrograms)
+    {
+        if (const FormatProgram* prog = getformat(L, arg, strfrmt, sfl))
+        {
+            luaL_Strbuf b;
+            luaL_buffinit(L, &b);
+            runformat(L, &b, prog, strfrmt, top);
+            luaL_pushresult(&b);
+            return 1;
+        }
+    }
+
     luaL_Strbuf b;
     luaL_buffinit(L, &b);
     while (strfrmt < strfrmt_end)
@@ -1094,6 +2472,25 @@ static int str_split(lua_State* L)
     if (needleLen == 0)
         begin++;
 
+    if (FFlag::LuauVectorizedStrings && needleLen > 0)
+    {
+        // same as the loop below, but uses the substring search to skip over the spans
+        while (const char* iter = lmemfind(spanStart, end - spanStart, needle, needleLen))
+        {
+            lua_pushinteger(L, ++numMatches);
+            lua_pushlstring(L, spanStart, iter - spanStart);
+            lua_settable(L, -3);
+
+            spanStart = iter + needleLen;
+        }
+
+        lua_pushinteger(L, ++numMatches);
+        lua_pushlstring(L, spanStart, end - spanStart);
+        lua_settable(L, -3);
+
+        return 1;
+    }
+
     // Don't iterate the last needleLen - 1 bytes of the string - they are
     // impossible to be splits and would let us memcmp past the end of the
     // buffer.
@@ -1682,6 +3079,40 @@ static void createmetatable(lua_State* L)
 int luaopen_string(lua_State* L)
 {
     luaL_register(L, LUA_STRLIBNAME, strlib);
+
+    if (FFlag::LuauCompiledPatterns)
+    {
+        // pattern matching functions share a cache of compiled patterns
+        static const luaL_Reg patternlib[] = {
+            {"find", str_find},
+            {"gmatch", gmatch},
+            {"gsub", str_gsub},
+            {"match", str_match},
+            {NULL, NULL},
+        };
+
+        lua_createtable(L, 1, 0);
+
+        for (const luaL_Reg* reg = patternlib; reg->name; ++reg)
+        {
+            lua_pushvalue(L, -1);
+            lua_pushcclosure(L, reg->func, reg->name, 1);
+            lua_setfield(L, -3, reg->name);
+        }
+
+        lua_pop(L, 1);
+    }
+
+    if (FFlag::LuauFormatPrograms)
+    {
+        // format keeps its own cache of parsed format strings, followed by the last format string used and its program
+        lua_createtable(L, 1, 0);
+        lua_pushnil(L);
+        lua_pushnil(L);
+        lua_pushcclosure(L, str_format, "format", 3);
+        lua_setfield(L, -2, "format");
+    }
+
     createmetatable(L);
 
     return 1;
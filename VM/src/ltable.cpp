@@ -21,6 +21,12 @@
  * invariant where the boundary must be in the array part - this enforces a consistent iteration order through the
  * prefix of the table when using pairs(), and allows to implement algorithms that access elements in 1..#t range
  * more efficiently.
+ *
+ * Instead of the array part, a table can have a typed array part that stores numbers without tags. Elements 1..size
+ * of a typed array part are all present, and the hash part never has number keys while the table has one. Storing
+ * anything that doesn't fit this shape generalizes the table, which moves the elements into a regular array part.
+ * Traversal numbers hash elements after the capacity of the typed array part, which generalization keeps as the
+ * size of the new array part, so removing elements or generalizing the table doesn't disturb a traversal.
  */
 
 #include "ltable.h"
@@ -198,9 +204,10 @@ static int findindex(lua_State* L, LuaTable* t, StkId key)
     int i;
     if (ttisnil(key))
         return -1; // first iteration
+    int asize = hastypedarray(t) ? t->typedarray->capacity : t->sizearray;
     i = ttisnumber(key) ? arrayindex(nvalue(key)) : -1;
-    if (0 < i && i <= t->sizearray) // is `key' inside array part?
-        return i - 1;               // yes; that's the index (corrected to C)
+    if (0 < i && i <= asize) // is `key' inside array part?
+        return i - 1;        // yes; that's the index (corrected to C)
     else
     {
         LuaNode* n = mainposition(t, key);
@@ -211,7 +218,7 @@ static int findindex(lua_State* L, LuaTable* t, StkId key)
             {
                 i = cast_int(n - gnode(t, 0)); // key index in hash table
                 // hash elements are numbered after array ones
-                return i + t->sizearray;
+                return i + asize;
             }
             if (gnext(n) == 0)
                 break;
@@ -224,16 +231,32 @@ static int findindex(lua_State* L, LuaTable* t, StkId key)
 int luaH_next(lua_State* L, LuaTable* t, StkId key)
 {
     int i = findindex(L, t, key); // find original element
-    for (i++; i < t->sizearray; i++)
-    { // try first array part
-        if (!ttisnil(&t->array[i]))
-        { // a non-nil value?
+    int asize = t->sizearray;
+    if (hastypedarray(t))
+    { // typed array part has no holes before its size
+        asize = t->typedarray->capacity;
+        if (++i < t->typedarray->size)
+        {
             setnvalue(key, cast_num(i + 1));
-            setobj2s(L, key + 1, &t->array[i]);
+            setnvalue(key + 1, t->typedarray->data[i]);
             return 1;
         }
+        if (i < asize)
+            i = asize;
+    }
+    else
+    {
+        for (i++; i < asize; i++)
+        { // try first array part
+            if (!ttisnil(&t->array[i]))
+            { // a non-nil value?
+                setnvalue(key, cast_num(i + 1));
+                setobj2s(L, key + 1, &t->array[i]);
+                return 1;
+            }
+        }
     }
-    for (i -= t->sizearray; i < sizenode(t); i++)
+    for (i -= asize; i < sizenode(t); i++)
     { // then hash part
         if (!ttisnil(gval(gnode(t, i))))
         { // a non-nil value?
@@ -463,6 +486,9 @@ static int adjustasize(LuaTable* t, int size, const TValue* ek)
 
 void luaH_resizearray(lua_State* L, LuaTable* t, int nasize)
 {
+    if (hastypedarray(t))
+        luaH_generalize(L, t);
+
     int nsize = (t->node == dummynode) ? 0 : sizenode(t);
     int asize = adjustasize(t, nasize, NULL);
     resize(L, t, asize, nsize);
@@ -543,7 +569,9 @@ void luaH_free(lua_State* L, LuaTable* t, lua_Page* page)
 {
     if (t->node != dummynode)
         luaM_freearray(L, t->node, sizenode(t), LuaNode, t->memcat);
-    if (t->array)
+    if (hastypedarray(t))
+        luaM_free_(L, t->typedarray, sizetypedarray(t->typedarray->capacity), t->memcat);
+    else if (t->array)
         luaM_freearray(L, t->array, t->sizearray, TValue, t->memcat);
     luaM_freegco(L, t, sizeof(LuaTable), t->memcat, page);
 }
@@ -724,6 +752,10 @@ const TValue* luaH_get(LuaTable* t, const TValue* key)
 
 TValue* luaH_set(lua_State* L, LuaTable* t, const TValue* key)
 {
+    // typed array part can't hold arbitrary values, callers that store numbers go through luaH_settyped first
+    if (ttisnumber(key) && hastypedarray(t))
+        luaH_generalize(L, t);
+
     const TValue* p = luaH_get(t, key);
     invalidateTMcache(t);
     if (p != luaO_nilobject)
@@ -740,11 +772,23 @@ TValue* luaH_newkey(lua_State* L, LuaTable* t, const TValue* key)
         luaG_runerror(L, "table index is NaN");
     else if (ttisvector(key) && luai_vecisnan(vvalue(key)))
         luaG_runerror(L, "table index contains NaN");
+
+    if (ttisnumber(key) && hastypedarray(t))
+    {
+        luaH_generalize(L, t);
+
+        // the key might be located in the new array part
+        return arrayornewkey(L, t, key);
+    }
+
     return newkey(L, t, key);
 }
 
 TValue* luaH_setnum(lua_State* L, LuaTable* t, int key)
 {
+    if (hastypedarray(t))
+        luaH_generalize(L, t);
+
     // (1 <= key && key <= t->sizearray)
     if (unsigned(key) - 1 < unsigned(t->sizearray))
         return &t->array[key - 1];
@@ -812,6 +856,10 @@ static int updateaboundary(LuaTable* t, int boundary)
 */
 int luaH_getn(LuaTable* t)
 {
+    // typed array part has no holes and there are no number keys in the hash part
+    if (hastypedarray(t))
+        return t->typedarray->size;
+
     int boundary = getaboundary(t);
 
     if (boundary > 0)
@@ -874,6 +922,15 @@ LuaTable* luaH_clone(lua_State* L, LuaTable* tt)
 
         memcpy(t->array, tt->array, t->sizearray * sizeof(TValue));
     }
+    else if (hastypedarray(tt))
+    {
+        int size = tt->typedarray->size;
+        LuaTypedArray* ta = cast_to(LuaTypedArray*, luaM_new_(L, sizetypedarray(size), t->memcat));
+        ta->size = size;
+        ta->capacity = size;
+        memcpy(ta->data, tt->typedarray->data, size * sizeof(double));
+        t->typedarray = ta;
+    }
 
     if (tt->node != dummynode)
     {
@@ -896,7 +953,11 @@ void luaH_clear(LuaTable* tt)
         setnilvalue(&tt->array[i]);
     }
 
-    maybesetaboundary(tt, 0);
+    // typed array part keeps its capacity
+    if (hastypedarray(tt))
+        tt->typedarray->size = 0;
+    else
+        maybesetaboundary(tt, 0);
 
     // clear hash part
     if (tt->node != dummynode)
@@ -915,3 +976,127 @@ void luaH_clear(LuaTable* tt)
     // back to empty -> no tag methods present
     tt->tmcache = cast_byte(~0);
 }
+
+LuaTable* luaH_newtypedarray(lua_State* L, int size)
+{
+    if (size > MAXSIZE)
+        luaG_runerror(L, "table overflow");
+
+    LuaTable* t = luaH_new(L, 0, 0);
+
+    LuaTypedArray* ta = cast_to(LuaTypedArray*, luaM_new_(L, sizetypedarray(size), t->memcat));
+    ta->size = size;
+    ta->capacity = size;
+    memset(ta->data, 0, size * sizeof(double));
+    t->typedarray = ta;
+
+    return t;
+}
+
+/*
+** search functions for the typed array part; return NULL when the key is not in it
+*/
+const double* luaH_gettypednum(LuaTable* t, int key)
+{
+    LUAU_ASSERT(hastypedarray(t));
+    LuaTypedArray* ta = t->typedarray;
+
+    // (1 <= key && key <= ta->size)
+    return unsigned(key) - 1 < unsigned(ta->size) ? &ta->data[key - 1] : NULL;
+}
+
+const double* luaH_gettyped(LuaTable* t, const TValue* key)
+{
+    if (!ttisnumber(key))
+        return NULL;
+
+    int k;
+    double n = nvalue(key);
+    luai_num2int(k, n);
+    return luai_numeq(cast_num(k), n) ? luaH_gettypednum(t, k) : NULL;
+}
+
+/*
+** stores a value into the typed array part; returns 0 when the store has to go through the regular path instead,
+** in which case the table was generalized unless the key belongs to the hash part
+*/
+int luaH_settyped(lua_State* L, LuaTable* t, const TValue* key, const TValue* val)
+{
+    LUAU_ASSERT(hastypedarray(t));
+    LuaTypedArray* ta = t->typedarray;
+
+    if (!ttisnumber(key))
+        return 0;
+
+    int k;
+    double n = nvalue(key);
+    luai_num2int(k, n);
+
+    if (luai_numeq(cast_num(k), n))
+    {
+        if (ttisnumber(val))
+        {
+            if (unsigned(k) - 1 < unsigned(ta->size))
+            {
+                ta->data[k - 1] = nvalue(val);
+                return 1;
+            }
+
+            if (k == ta->size + 1)
+            {
+                if (ta->size == ta->capacity)
+                {
+                    int capacity = ta->capacity < 4 ? 4 : ta->capacity * 2;
+                    if (capacity > MAXSIZE)
+                        luaG_runerror(L, "table overflow");
+
+                    ta = cast_to(LuaTypedArray*, luaM_realloc_(L, ta, sizetypedarray(ta->capacity), sizetypedarray(capacity), t->memcat));
+                    ta->capacity = capacity;
+                    t->typedarray = ta;
+                }
+
+                ta->data[ta->size++] = nvalue(val);
+                return 1;
+            }
+        }
+        else if (ttisnil(val))
+        {
+            if (k == ta->size && k > 0)
+            {
+                ta->size--;
+                return 1;
+            }
+
+            // the key is absent, and removing it has no effect
+            if (unsigned(k) - 1 >= unsigned(ta->size))
+                return 1;
+        }
+    }
+
+    luaH_generalize(L, t);
+    return 0;
+}
+
+/*
+** replaces the typed array part with a regular array part, which has the same capacity to keep traversal positions
+*/
+void luaH_generalize(lua_State* L, LuaTable* t)
+{
+    LUAU_ASSERT(hastypedarray(t));
+    LuaTypedArray* ta = t->typedarray;
+    int size = ta->size;
+    int capacity = ta->capacity;
+
+    // the new array is allocated first so that the table stays consistent if that fails
+    TValue* array = capacity > 0 ? luaM_newarray(L, capacity, TValue, t->memcat) : NULL;
+
+    for (int i = 0; i < size; ++i)
+        setnvalue(&array[i], ta->data[i]);
+    for (int i = size; i < capacity; ++i)
+        setnilvalue(&array[i]);
+
+    luaM_free_(L, ta, sizetypedarray(capacity), t->memcat);
+
+    t->array = array;
+    t->sizearray = capacity;
+}
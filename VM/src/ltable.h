@@ -11,6 +11,9 @@
 
 #define gval2slot(t, v) int(cast_to(LuaNode*, static_cast<const TValue*>(v)) - t->node)
 
+#define hastypedarray(t) ((t)->sizearray == 0 && (t)->typedarray != NULL)
+#define sizetypedarray(n) (offsetof(LuaTypedArray, data) + sizeof(double) * (n))
+
 // reset cache of absent metamethods, cache is updated in luaT_gettm
 #define invalidateTMcache(t) t->tmcache = 0
 
@@ -31,6 +34,11 @@ LUAI_FUNC int luaH_next(lua_State* L, LuaTable* t, StkId key);
 LUAI_FUNC int luaH_getn(LuaTable* t);
 LUAI_FUNC LuaTable* luaH_clone(lua_State* L, LuaTable* tt);
 LUAI_FUNC void luaH_clear(LuaTable* tt);
+LUAI_FUNC LuaTable* luaH_newtypedarray(lua_State* L, int size);
+LUAI_FUNC const double* luaH_gettyped(LuaTable* t, const TValue* key);
+LUAI_FUNC const double* luaH_gettypednum(LuaTable* t, int key);
+LUAI_FUNC int luaH_settyped(lua_State* L, LuaTable* t, const TValue* key, const TValue* val);
+LUAI_FUNC void luaH_generalize(lua_State* L, LuaTable* t);
 
 #define luaH_setslot(L, t, slot, key) (invalidateTMcache(t), (slot == luaO_nilobject ? luaH_newkey(L, t, key) : cast_to(TValue*, slot)))
 
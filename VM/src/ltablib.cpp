@@ -10,6 +10,13 @@
 #include "lgc.h"
 #include "ldebug.h"
 #include "lvm.h"
+#include "lmem.h"
+
+#include <string.h>
+
+LUAU_FASTFLAG(LuauDirectConcat)
+LUAU_FASTFLAGVARIABLE(LuauTypedSort)
+LUAU_FASTFLAGVARIABLE(LuauTableBulkCopy)
 
 static int foreachi(lua_State* L)
 {
@@ -55,6 +62,13 @@ static int maxn(lua_State* L)
 
     LuaTable* t = hvalue(L->base);
 
+    // typed array part has no holes and there are no number keys in the hash part
+    if (hastypedarray(t))
+    {
+        lua_pushnumber(L, t->typedarray->size);
+        return 1;
+    }
+
     for (int i = 0; i < t->sizearray; i++)
     {
         if (!ttisnil(&t->array[i]))
@@ -95,13 +109,22 @@ static void moveelements(lua_State* L, int srct, int dstt, int f, int e, int t)
 
     int n = e - f + 1; // number of elements to move
 
+    // elements are read from the regular array part below; destination is generalized by luaH_setnum if needed
+    if (n > 0 && hastypedarray(src))
+        luaH_generalize(L, src);
+
     if (unsigned(f) - 1 < unsigned(src->sizearray) && unsigned(t) - 1 < unsigned(dst->sizearray) &&
         unsigned(f) - 1 + unsigned(n) <= unsigned(src->sizearray) && unsigned(t) - 1 + unsigned(n) <= unsigned(dst->sizearray))
     {
         TValue* srcarray = src->array;
         TValue* dstarray = dst->array;
 
-        if (t > e || t <= f || (dstt != srct && dst != src))
+        if (FFlag::LuauTableBulkCopy)
+        {
+            // memmove handles overlapping ranges within the same table regardless of direction
+            memmove(&dstarray[t - 1], &srcarray[f - 1], n * sizeof(TValue));
+        }
+        else if (t > e || t <= f || (dstt != srct && dst != src))
         {
             for (int i = 0; i < n; ++i)
             {
@@ -122,6 +145,23 @@ static void moveelements(lua_State* L, int srct, int dstt, int f, int e, int t)
 
         luaC_barrierfast(L, dst);
     }
+    else if (FFlag::LuauTableBulkCopy)
+    {
+        bool forward = t > e || t <= f || dst != src;
+
+        for (int k = 0; k < n; ++k)
+        {
+            int i = forward ? k : n - 1 - k;
+
+            // the value is copied out first since setting the destination slot may rehash the source table
+            TValue v;
+            setobj(L, &v, luaH_getnum(src, f + i));
+
+            TValue* d = luaH_setnum(L, dst, t + i);
+            setobj2t(L, d, &v);
+            luaC_barriert(L, dst, &v);
+        }
+    }
     else
     {
         if (t > e || t <= f || dst != src)
@@ -243,6 +283,31 @@ static void addfield(lua_State* L, luaL_Strbuf* b, int i, LuaTable* t)
     }
 }
 
+static void presizeconcat(luaL_Strbuf* b, LuaTable* t, int first, int last, size_t lsep)
+{
+    if (first < 1 || last > t->sizearray)
+        return;
+
+    size_t total = 0;
+
+    for (int i = first; i <= last; i++)
+    {
+        const TValue* v = &t->array[i - 1];
+
+        if (!ttisstring(v))
+            return;
+
+        size_t l = tsvalue(v)->len + (i < last ? lsep : 0);
+
+        if (l > MAXSSIZE - total)
+            return;
+
+        total += l;
+    }
+
+    luaL_prepbuffsize(b, total);
+}
+
 static int tconcat(lua_State* L)
 {
     size_t lsep;
@@ -255,6 +320,11 @@ static int tconcat(lua_State* L)
 
     luaL_Strbuf b;
     luaL_buffinit(L, &b);
+
+    // when the whole range is made of strings in the array part, the result is built in a single allocation of the exact size
+    if (FFlag::LuauDirectConcat && i <= last)
+        presizeconcat(&b, t, i, last, lsep);
+
     for (; i < last; i++)
     {
         addfield(L, &b, i, t);
@@ -274,10 +344,18 @@ static int tpack(lua_State* L)
 
     LuaTable* t = hvalue(L->top - 1);
 
-    for (int i = 0; i < n; ++i)
+    if (FFlag::LuauTableBulkCopy)
+    {
+        if (n > 0)
+            memcpy(t->array, L->base, n * sizeof(TValue));
+    }
+    else
     {
-        TValue* e = &t->array[i];
-        setobj2t(L, e, L->base + i);
+        for (int i = 0; i < n; ++i)
+        {
+            TValue* e = &t->array[i];
+            setobj2t(L, e, L->base + i);
+        }
     }
 
     // t.n = number of elements
@@ -300,8 +378,37 @@ static int tunpack(lua_State* L)
     if (n >= (unsigned int)INT_MAX || !lua_checkstack(L, (int)(++n)))
         luaL_error(L, "too many results to unpack");
 
+    if (FFlag::LuauTableBulkCopy)
+    {
+        if (i >= 1 && e <= t->sizearray)
+        {
+            // fast-path: the entire range is in the array part
+            memcpy(L->top, &t->array[i - 1], n * sizeof(TValue));
+        }
+        else if (hastypedarray(t))
+        {
+            for (unsigned k = 0; k < n; k++)
+            {
+                if (const double* slot = luaH_gettypednum(t, i + int(k)))
+                {
+                    setnvalue(L->top + k, *slot);
+                }
+                else
+                {
+                    setnilvalue(L->top + k);
+                }
+            }
+        }
+        else
+        {
+            // k < n keeps i + k within [i, e] without overflowing
+            for (unsigned k = 0; k < n; k++)
+                setobj2s(L, L->top + k, luaH_getnum(t, i + int(k)));
+        }
+        L->top += n;
+    }
     // fast-path: direct array-to-stack copy
-    if (i == 1 && int(n) <= t->sizearray)
+    else if (i == 1 && int(n) <= t->sizearray)
     {
         for (i = 0; i < int(n); i++)
             setobj2s(L, L->top + i, &t->array[i]);
@@ -472,6 +579,523 @@ static void sort_rec(lua_State* L, LuaTable* t, int l, int u, int limit, SortPre
     }
 }
 
+// Homogeneous arrays of numbers or strings under the default comparator are sorted by extracting the values into a temporary array
+// and sorting it with pattern-defeating quicksort (Orson Peters), which needs no TValue dispatch or predicate calls.
+// The comparators are strict weak orders that can't fail or reenter the VM, so partitioning can run without bounds checks.
+#define SORT_INSERTION_THRESHOLD 24
+#define SORT_NINTHER_THRESHOLD 128
+#define SORT_PARTIAL_INSERTION_LIMIT 8
+#define SORT_BLOCK_SIZE 64
+
+struct SortNumberLess
+{
+    bool operator()(double l, double r) const
+    {
+        return l < r;
+    }
+};
+
+struct SortStringLess
+{
+    bool operator()(const TString* l, const TString* r) const
+    {
+        return luaV_strcmp(l, r) < 0;
+    }
+};
+
+template<typename T>
+inline void sort_swapvalues(T* a, T* b)
+{
+    T temp = *a;
+    *a = *b;
+    *b = temp;
+}
+
+template<typename T, typename Less>
+inline void sort_sort2(T* a, T* b, Less less)
+{
+    if (less(*b, *a))
+        sort_swapvalues(a, b);
+}
+
+template<typename T, typename Less>
+inline void sort_sort3(T* a, T* b, T* c, Less less)
+{
+    sort_sort2(a, b, less);
+    sort_sort2(b, c, less);
+    sort_sort2(a, b, less);
+}
+
+// sorts [begin, end); when 'guarded' is false, the element before begin must not be greater than any element in the range
+template<typename T, typename Less>
+static void sort_insertion(T* begin, T* end, Less less, bool guarded)
+{
+    if (begin == end)
+        return;
+
+    for (T* cur = begin + 1; cur != end; ++cur)
+    {
+        T* sift = cur;
+
+        if (less(*sift, *(sift - 1)))
+        {
+            T temp = *sift;
+
+            do
+            {
+                *sift = *(sift - 1);
+                --sift;
+            } while ((!guarded || sift != begin) && less(temp, *(sift - 1)));
+
+            *sift = temp;
+        }
+    }
+}
+
+// attempts insertion sort and gives up after moving SORT_PARTIAL_INSERTION_LIMIT elements; returns true if the range got sorted
+template<typename T, typename Less>
+static bool sort_partialinsertion(T* begin, T* end, Less less)
+{
+    if (begin == end)
+        return true;
+
+    size_t moves = 0;
+
+    for (T* cur = begin + 1; cur != end; ++cur)
+    {
+        T* sift = cur;
+
+        if (less(*sift, *(sift - 1)))
+        {
+            T temp = *sift;
+
+            do
+            {
+                *sift = *(sift - 1);
+                --sift;
+            } while (sift != begin && less(temp, *(sift - 1)));
+
+            *sift = temp;
+            moves += cur - sift;
+        }
+
+        if (moves > SORT_PARTIAL_INSERTION_LIMIT)
+            return false;
+    }
+
+    return true;
+}
+
+template<typename T, typename Less>
+static void sort_siftdown(T* begin, size_t count, size_t root, Less less)
+{
+    for (;;)
+    {
+        size_t child = root * 2 + 1;
+        if (child >= count)
+            break;
+
+        if (child + 1 < count && less(begin[child], begin[child + 1]))
+            child++;
+
+        if (!less(begin[root], begin[child]))
+            break;
+
+        sort_swapvalues(&begin[root], &begin[child]);
+        root = child;
+    }
+}
+
+template<typename T, typename Less>
+static void sort_heapvalues(T* begin, T* end, Less less)
+{
+    size_t count = end - begin;
+
+    for (size_t i = count / 2; i > 0; --i)
+        sort_siftdown(begin, count, i - 1, less);
+
+    for (size_t i = count - 1; i > 0; --i)
+    {
+        sort_swapvalues(&begin[0], &begin[i]);
+        sort_siftdown(begin, i, 0, less);
+    }
+}
+
+// partitions [begin, end) around the pivot at begin, placing elements equal to the pivot on the left; returns the pivot position
+// used when the pivot is equal to the element before the range, in which case the left side needs no further sorting
+template<typename T, typename Less>
+static T* sort_partitionleft(T* begin, T* end, Less less)
+{
+    T pivot = *begin;
+    T* first = begin;
+    T* last = end;
+
+    while (less(pivot, *--last))
+        ;
+
+    if (last + 1 == end)
+        while (first < last && !less(pivot, *++first))
+            ;
+    else
+        while (!less(pivot, *++first))
+            ;
+
+    while (first < last)
+    {
+        sort_swapvalues(first, last);
+        while (less(pivot, *--last))
+            ;
+        while (!less(pivot, *++first))
+            ;
+    }
+
+    *begin = *last;
+    *last = pivot;
+    return last;
+}
+
+// partitions [begin, end) around the pivot at begin, placing elements equal to the pivot on the right; returns the pivot position
+// the range must have an element that is not less than the pivot at the end, which median selection guarantees
+template<typename T, typename Less>
+static T* sort_partitionright(T* begin, T* end, Less less, bool& alreadypartitioned)
+{
+    T pivot = *begin;
+    T* first = begin;
+    T* last = end;
+
+    while (less(*++first, pivot))
+        ;
+
+    if (first - 1 == begin)
+        while (first < last && !less(*--last, pivot))
+            ;
+    else
+        while (!less(*--last, pivot))
+            ;
+
+    alreadypartitioned = first >= last;
+
+    while (first < last)
+    {
+        sort_swapvalues(first, last);
+        while (less(*++first, pivot))
+            ;
+        while (!less(*--last, pivot))
+            ;
+    }
+
+    T* pivotpos = first - 1;
+    *begin = *pivotpos;
+    *pivotpos = pivot;
+    return pivotpos;
+}
+
+// swaps count pairs of misplaced elements identified by the offset blocks
+// when the counts match, plain swaps are used; otherwise a cyclic permutation needs fewer moves
+template<typename T>
+inline void sort_swapoffsets(T* lbase, T* rbase, const unsigned char* loffsets, const unsigned char* roffsets, size_t count, bool useswaps)
+{
+    if (useswaps)
+    {
+        for (size_t i = 0; i < count; ++i)
+            sort_swapvalues(lbase + loffsets[i], rbase - roffsets[i]);
+    }
+    else if (count > 0)
+    {
+        T* l = lbase + loffsets[0];
+        T* r = rbase - roffsets[0];
+        T temp = *l;
+        *l = *r;
+
+        for (size_t i = 1; i < count; ++i)
+        {
+            l = lbase + loffsets[i];
+            *r = *l;
+            r = rbase - roffsets[i];
+            *l = *r;
+        }
+
+        *r = temp;
+    }
+}
+
+// same contract as sort_partitionright, but comparison results are accumulated into offset blocks without branching on them
+// this is derived from BlockQuicksort (Edelkamp, Weiss) and only pays off when comparisons are cheap
+template<typename T, typename Less>
+static T* sort_partitionrightbranchless(T* begin, T* end, Less less, bool& alreadypartitioned)
+{
+    T pivot = *begin;
+    T* first = begin;
+    T* last = end;
+
+    while (less(*++first, pivot))
+        ;
+
+    if (first - 1 == begin)
+        while (first < last && !less(*--last, pivot))
+            ;
+    else
+        while (!less(*--last, pivot))
+            ;
+
+    alreadypartitioned = first >= last;
+
+    if (!alreadypartitioned)
+    {
+        sort_swapvalues(first, last);
+        ++first;
+
+        unsigned char loffsets[SORT_BLOCK_SIZE];
+        unsigned char roffsets[SORT_BLOCK_SIZE];
+
+        T* lbase = first;
+        T* rbase = last;
+        size_t lcount = 0, rcount = 0, lstart = 0, rstart = 0;
+
+        while (first < last)
+        {
+            // blocks that still have misplaced elements are kept; the remaining unknown elements are split between the empty ones
+            size_t unknown = last - first;
+            size_t lsplit = lcount == 0 ? (rcount == 0 ? unknown / 2 : unknown) : 0;
+            size_t rsplit = rcount == 0 ? unknown - lsplit : 0;
+
+            if (lsplit > SORT_BLOCK_SIZE)
+                lsplit = SORT_BLOCK_SIZE;
+
+            if (rsplit > SORT_BLOCK_SIZE)
+                rsplit = SORT_BLOCK_SIZE;
+
+            for (size_t i = 0; i < lsplit; ++i)
+            {
+                loffsets[lcount] = (unsigned char)i;
+                lcount += !less(*first, pivot);
+                ++first;
+            }
+
+            for (size_t i = 0; i < rsplit;)
+            {
+                roffsets[rcount] = (unsigned char)++i;
+                rcount += less(*--last, pivot);
+            }
+
+            size_t count = lcount < rcount ? lcount : rcount;
+            sort_swapoffsets(lbase, rbase, loffsets + lstart, roffsets + rstart, count, lcount == rcount);
+
+            lcount -= count;
+            rcount -= count;
+            lstart += count;
+            rstart += count;
+
+            if (lcount == 0)
+            {
+                lstart = 0;
+                lbase = first;
+            }
+
+            if (rcount == 0)
+            {
+                rstart = 0;
+                rbase = last;
+            }
+        }
+
+        // one of the blocks may still have misplaced elements, which are moved to the boundary
+        if (lcount)
+        {
+            const unsigned char* offsets = loffsets + lstart;
+            while (lcount--)
+                sort_swapvalues(lbase + offsets[lcount], --last);
+            first = last;
+        }
+
+        if (rcount)
+        {
+            const unsigned char* offsets = roffsets + rstart;
+            while (rcount--)
+            {
+                sort_swapvalues(rbase - offsets[rcount], first);
+                ++first;
+            }
+        }
+    }
+
+    T* pivotpos = first - 1;
+    *begin = *pivotpos;
+    *pivotpos = pivot;
+    return pivotpos;
+}
+
+template<typename T, typename Less, bool Branchless>
+static void sort_pdq(T* begin, T* end, Less less, int badallowed, bool leftmost)
+{
+    for (;;)
+    {
+        size_t size = end - begin;
+
+        if (size < SORT_INSERTION_THRESHOLD)
+        {
+            sort_insertion(begin, end, less, leftmost);
+            return;
+        }
+
+        // the pivot is the median of 3, or the pseudomedian of 9 for larger ranges, and is moved to begin
+        size_t half = size / 2;
+
+        if (size > SORT_NINTHER_THRESHOLD)
+        {
+            sort_sort3(begin, begin + half, end - 1, less);
+            sort_sort3(begin + 1, begin + (half - 1), end - 2, less);
+            sort_sort3(begin + 2, begin + (half + 1), end - 3, less);
+            sort_sort3(begin + (half - 1), begin + half, begin + (half + 1), less);
+            sort_swapvalues(begin, begin + half);
+        }
+        else
+        {
+            sort_sort3(begin + half, begin, end - 1, less);
+        }
+
+        // if the pivot is equal to the element before the range, which was a previous pivot, elements equal to it are already in place
+        if (!leftmost && !less(*(begin - 1), *begin))
+        {
+            begin = sort_partitionleft(begin, end, less) + 1;
+            continue;
+        }
+
+        bool alreadypartitioned = false;
+        T* pivotpos = Branchless ? sort_partitionrightbranchless(begin, end, less, alreadypartitioned)
+                                 : sort_partitionright(begin, end, less, alreadypartitioned);
+
+        size_t lsize = pivotpos - begin;
+        size_t rsize = end - (pivotpos + 1);
+
+        if (lsize < size / 8 || rsize < size / 8)
+        {
+            // too many unbalanced partitions mean the input defeats the pivot selection, so the range falls back to heap sort
+            if (--badallowed == 0)
+            {
+                sort_heapvalues(begin, end, less);
+                return;
+            }
+
+            // otherwise some elements are moved around to break up the pattern
+            if (lsize >= SORT_INSERTION_THRESHOLD)
+            {
+                sort_swapvalues(begin, begin + lsize / 4);
+                sort_swapvalues(pivotpos - 1, pivotpos - lsize / 4);
+
+                if (lsize > SORT_NINTHER_THRESHOLD)
+                {
+                    sort_swapvalues(begin + 1, begin + (lsize / 4 + 1));
+                    sort_swapvalues(begin + 2, begin + (lsize / 4 + 2));
+                    sort_swapvalues(pivotpos - 2, pivotpos - (lsize / 4 + 1));
+                    sort_swapvalues(pivotpos - 3, pivotpos - (lsize / 4 + 2));
+                }
+            }
+
+            if (rsize >= SORT_INSERTION_THRESHOLD)
+            {
+                sort_swapvalues(pivotpos + 1, pivotpos + (1 + rsize / 4));
+                sort_swapvalues(end - 1, end - rsize / 4);
+
+                if (rsize > SORT_NINTHER_THRESHOLD)
+                {
+                    sort_swapvalues(pivotpos + 2, pivotpos + (2 + rsize / 4));
+                    sort_swapvalues(pivotpos + 3, pivotpos + (3 + rsize / 4));
+                    sort_swapvalues(end - 2, end - (1 + rsize / 4));
+                    sort_swapvalues(end - 3, end - (2 + rsize / 4));
+                }
+            }
+        }
+        else if (alreadypartitioned && sort_partialinsertion(begin, pivotpos, less) && sort_partialinsertion(pivotpos + 1, end, less))
+        {
+            // an already partitioned range is likely sorted, which a bounded insertion sort can confirm cheaply
+            return;
+        }
+
+        // the left side is sorted recursively and the right side in the next iteration
+        sort_pdq<T, Less, Branchless>(begin, pivotpos, less, badallowed, leftmost);
+        begin = pivotpos + 1;
+        leftmost = false;
+    }
+}
+
+template<typename T, typename Less, bool Branchless>
+static void sort_values(T* begin, T* end, Less less)
+{
+    int log2 = 0;
+    for (size_t size = end - begin; size > 1; size >>= 1)
+        log2++;
+
+    sort_pdq<T, Less, Branchless>(begin, end, less, log2, true);
+}
+
+// sorts the first n elements of the array part if they are all numbers or all strings; returns false if the generic sort is needed
+static bool sort_typed(lua_State* L, LuaTable* t, int n)
+{
+    if (hastypedarray(t))
+    {
+        double* values = t->typedarray->data;
+
+        for (int i = 0; i < n; ++i)
+            if (values[i] != values[i])
+                return false;
+
+        // typed array part is sorted in place since it holds the values unboxed already
+        sort_values<double, SortNumberLess, true>(values, values + n, SortNumberLess());
+        return true;
+    }
+
+    if (n > t->sizearray)
+        return false;
+
+    TValue* arr = t->array;
+
+    if (ttisnumber(&arr[0]))
+    {
+        // NaN doesn't have a consistent order, so arrays with it keep the generic behavior
+        for (int i = 0; i < n; ++i)
+            if (!ttisnumber(&arr[i]) || nvalue(&arr[i]) != nvalue(&arr[i]))
+                return false;
+
+        double* values = luaM_newarray(L, n, double, L->activememcat);
+
+        // the table can't change after the allocation, which is the only point where GC could run
+        for (int i = 0; i < n; ++i)
+            values[i] = nvalue(&arr[i]);
+
+        sort_values<double, SortNumberLess, true>(values, values + n, SortNumberLess());
+
+        for (int i = 0; i < n; ++i)
+            setnvalue(&arr[i], values[i]);
+
+        luaM_freearray(L, values, n, double, L->activememcat);
+        return true;
+    }
+
+    if (ttisstring(&arr[0]))
+    {
+        for (int i = 0; i < n; ++i)
+            if (!ttisstring(&arr[i]))
+                return false;
+
+        TString** values = luaM_newarray(L, n, TString*, L->activememcat);
+
+        for (int i = 0; i < n; ++i)
+            values[i] = tsvalue(&arr[i]);
+
+        sort_values<TString*, SortStringLess, false>(values, values + n, SortStringLess());
+
+        // no barrier required because the array holds the same strings before and after the sort
+        for (int i = 0; i < n; ++i)
+            setsvalue(L, &arr[i], values[i]);
+
+        luaM_freearray(L, values, n, TString*, L->activememcat);
+        return true;
+    }
+
+    return false;
+}
+
 static int tsort(lua_State* L)
 {
     luaL_checktype(L, 1, LUA_TTABLE);
@@ -488,6 +1112,13 @@ static int tsort(lua_State* L)
     }
     lua_settop(L, 2); // make sure there are two arguments
 
+    if (FFlag::LuauTypedSort && pred == luaV_lessthan && n > 1 && sort_typed(L, t, n))
+        return 0;
+
+    // the generic sort works on the regular array part
+    if (n > 0 && hastypedarray(t))
+        luaH_generalize(L, t);
+
     if (n > 0)
         sort_rec(L, t, 0, n - 1, n, pred);
     return 0;
@@ -506,10 +1137,28 @@ static int tcreate(lua_State* L)
 
         StkId v = L->base + 1;
 
-        for (int i = 0; i < size; ++i)
+        if (FFlag::LuauTableBulkCopy)
         {
-            TValue* e = &t->array[i];
-            setobj2t(L, e, v);
+            if (size > 0)
+            {
+                setobj2t(L, &t->array[0], v);
+
+                // fill the rest by doubling the initialized prefix
+                for (int filled = 1; filled < size;)
+                {
+                    int chunk = filled < size - filled ? filled : size - filled;
+                    memcpy(&t->array[filled], t->array, chunk * sizeof(TValue));
+                    filled += chunk;
+                }
+            }
+        }
+        else
+        {
+            for (int i = 0; i < size; ++i)
+            {
+                TValue* e = &t->array[i];
+                setobj2t(L, e, v);
+            }
         }
     }
     else
@@ -530,6 +1179,29 @@ static int tfind(lua_State* L)
 
     LuaTable* t = hvalue(L->base);
 
+    // elements of the typed array part are numbers, so only a number can be equal to them
+    if (hastypedarray(t))
+    {
+        StkId v = L->base + 1;
+
+        if (ttisnumber(v))
+        {
+            LuaTypedArray* ta = t->typedarray;
+
+            for (int i = init; i <= ta->size; ++i)
+            {
+                if (luai_numeq(ta->data[i - 1], nvalue(v)))
+                {
+                    lua_pushinteger(L, i);
+                    return 1;
+                }
+            }
+        }
+
+        lua_pushnil(L);
+        return 1;
+    }
+
     for (int i = init;; ++i)
     {
         const TValue* e = luaH_getnum(t, i);
@@ -26,7 +26,12 @@ LUAI_FUNC int luaV_tostring(lua_State* L, StkId obj);
 LUAI_FUNC void luaV_gettable(lua_State* L, const TValue* t, TValue* key, StkId val);
 LUAI_FUNC void luaV_settable(lua_State* L, const TValue* t, TValue* key, StkId val);
 LUAI_FUNC void luaV_concat(lua_State* L, int total, int last);
+LUAI_FUNC void luaV_concatappend(lua_State* L, int a, int first, int last, int buf);
+LUAI_FUNC void luaV_concatflush(lua_State* L, int a, int buf);
 LUAI_FUNC void luaV_getimport(lua_State* L, LuaTable* env, TValue* k, StkId res, uint32_t id, bool propagatenil);
+LUAI_FUNC void luaV_loadproto(lua_State* L, Proto* p, LuaTable* env);
+LUAI_FUNC void luaV_freelazyproto(lua_State* L, Proto* p);
+LUAI_FUNC LuaTable* luaV_lazyprotoenv(Proto* p);
 LUAI_FUNC void luaV_prepareFORN(lua_State* L, StkId plimit, StkId pstep, StkId pinit);
 LUAI_FUNC void luaV_callTM(lua_State* L, int nparams, int res);
 LUAI_FUNC void luaV_tryfuncTM(lua_State* L, StkId func);
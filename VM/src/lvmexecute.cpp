@@ -25,6 +25,7 @@ LUAU_FASTFLAGVARIABLE(DebugLuauUserDefinedClassesRuntime)
 LUAU_FASTFLAGVARIABLE(LuauCallFeedback)
 LUAU_FASTFLAGVARIABLE(LuauYieldIter2)
 LUAU_FASTFLAGVARIABLE(LuauPromoteProto)
+LUAU_FASTFLAG(LuauTableBulkCopy)
 
 // Disable c99-designator to avoid the warning in computed goto dispatch table
 #ifdef __clang__
@@ -117,7 +118,8 @@ LUAU_FASTFLAGVARIABLE(LuauPromoteProto)
         VM_DISPATCH_OP(LOP_FASTCALL2), VM_DISPATCH_OP(LOP_FASTCALL2K), VM_DISPATCH_OP(LOP_FORGPREP), VM_DISPATCH_OP(LOP_JUMPXEQKNIL), \
         VM_DISPATCH_OP(LOP_JUMPXEQKB), VM_DISPATCH_OP(LOP_JUMPXEQKN), VM_DISPATCH_OP(LOP_JUMPXEQKS), VM_DISPATCH_OP(LOP_IDIV), \
         VM_DISPATCH_OP(LOP_IDIVK), VM_DISPATCH_OP(LOP_GETUDATAKS), VM_DISPATCH_OP(LOP_SETUDATAKS), VM_DISPATCH_OP(LOP_NAMECALLUDATA), \
-        VM_DISPATCH_OP(LOP_NEWCLASSMEMBER), VM_DISPATCH_OP(LOP_CALLFB), VM_DISPATCH_OP(LOP_CMPPROTO),
+        VM_DISPATCH_OP(LOP_NEWCLASSMEMBER), VM_DISPATCH_OP(LOP_CALLFB), VM_DISPATCH_OP(LOP_CMPPROTO), \
+        VM_DISPATCH_OP(LOP_MOVE2), VM_DISPATCH_OP(LOP_CONCATAPPEND), VM_DISPATCH_OP(LOP_CONCATFLUSH),
 
 #if defined(__GNUC__) || defined(__clang__)
 #define VM_USE_CGOTO 1
@@ -764,6 +766,13 @@ reentry:
                         VM_NEXT();
                     }
 
+                    // elements of the typed array part are never nil, so the metatable doesn't matter
+                    if (hastypedarray(h) && unsigned(index) - 1 < unsigned(h->typedarray->size) && double(index) == indexd)
+                    {
+                        setnvalue(ra, h->typedarray->data[unsigned(index - 1)]);
+                        VM_NEXT();
+                    }
+
                     // fall through to slow path
                 }
 
@@ -795,6 +804,14 @@ reentry:
                         VM_NEXT();
                     }
 
+                    // existing elements of the typed array part can be replaced with numbers without a barrier
+                    if (hastypedarray(h) && ttisnumber(ra) && unsigned(index) - 1 < unsigned(h->typedarray->size) && !h->readonly &&
+                        double(index) == indexd)
+                    {
+                        h->typedarray->data[unsigned(index - 1)] = nvalue(ra);
+                        VM_NEXT();
+                    }
+
                     // fall through to slow path
                 }
 
@@ -821,6 +838,13 @@ reentry:
                         VM_NEXT();
                     }
 
+                    // elements of the typed array part are never nil, so the metatable doesn't matter
+                    if (hastypedarray(h) && unsigned(c) < unsigned(h->typedarray->size))
+                    {
+                        setnvalue(ra, h->typedarray->data[c]);
+                        VM_NEXT();
+                    }
+
                     // fall through to slow path
                 }
 
@@ -850,6 +874,13 @@ reentry:
                         VM_NEXT();
                     }
 
+                    // existing elements of the typed array part can be replaced with numbers without a barrier
+                    if (hastypedarray(h) && ttisnumber(ra) && unsigned(c) < unsigned(h->typedarray->size) && !h->readonly)
+                    {
+                        h->typedarray->data[c] = nvalue(ra);
+                        VM_NEXT();
+                    }
+
                     // fall through to slow path
                 }
 
@@ -2497,8 +2528,17 @@ reentry:
 
                 TValue* array = h->array;
 
-                for (int i = 0; i < c; ++i)
-                    setobj2t(L, &array[index + i - 1], rb + i);
+                if (FFlag::LuauTableBulkCopy)
+                {
+                    // registers and array slots share the TValue layout, so the batch is copied at once; the barrier below covers all of it
+                    if (c > 0)
+                        memcpy(&array[index - 1], rb, c * sizeof(TValue));
+                }
+                else
+                {
+                    for (int i = 0; i < c; ++i)
+                        setobj2t(L, &array[index + i - 1], rb + i);
+                }
 
                 luaC_barrierfast(L, h);
                 VM_NEXT();
@@ -2700,8 +2740,34 @@ reentry:
                         for (int i = 2; i < int(aux); ++i)
                             setnilvalue(ra + 3 + i);
 
+                    // typed array part has no holes before its size, and hash elements are numbered after its capacity
+                    if (LUAU_UNLIKELY(hastypedarray(h)))
+                    {
+                        sizearray = h->typedarray->capacity;
+
+                        if (unsigned(index) < unsigned(h->typedarray->size))
+                        {
+                            setpvalue(ra + 2, reinterpret_cast<void*>(uintptr_t(index + 1)), LU_TAG_ITERATOR);
+                            setnvalue(ra + 3, double(index + 1));
+                            setnvalue(ra + 4, h->typedarray->data[index]);
+
+                            pc += LUAU_INSN_D(insn);
+                            VM_ASSERT_PC(pc);
+                            VM_NEXT();
+                        }
+
+                        // ipairs-style traversal ends with the typed array part
+                        if (int(aux) < 0)
+                        {
+                            pc++;
+                            VM_NEXT();
+                        }
+
+                        if (unsigned(index) < unsigned(sizearray))
+                            index = sizearray;
+                    }
                     // terminate ipairs-style traversal early when encountering nil
-                    if (int(aux) < 0 && (unsigned(index) >= unsigned(sizearray) || ttisnil(&h->array[index])))
+                    else if (int(aux) < 0 && (unsigned(index) >= unsigned(sizearray) || ttisnil(&h->array[index])))
                     {
                         pc++;
                         VM_NEXT();
@@ -2894,6 +2960,10 @@ reentry:
 
                 VM_PROTECT_PC(); // luaF_newLclosure may fail due to OOM
 
+                // closure constants of lazily loaded chunks are created before their function is decoded
+                if (LUAU_UNLIKELY(kcl->l.p->lazychunk != NULL))
+                    luaV_loadproto(L, kcl->l.p, kcl->env);
+
                 // clone closure if the environment is not shared
                 // note: we save closure to stack early in case the code below wants to capture it by value
                 Closure* ncl = (kcl->env == cl->env) ? kcl : luaF_newLclosure(L, kcl->nupvalues, cl->env, FFlag::LuauCIProto ? getproto(kcl) : kcl->l.p);
@@ -3668,6 +3738,39 @@ reentry:
                 VM_NEXT();
             }
 
+            VM_CASE(LOP_MOVE2)
+            {
+                Instruction insn = *pc++;
+                StkId ra = VM_REG(LUAU_INSN_A(insn));
+                StkId rb = VM_REG(LUAU_INSN_B(insn));
+                StkId rc = VM_REG(LUAU_INSN_C(insn));
+
+                // note: second copy has to observe the first one, C may be equal to A
+                setobj2s(L, ra, rb);
+                setobj2s(L, ra + 1, rc);
+                VM_NEXT();
+            }
+
+            VM_CASE(LOP_CONCATAPPEND)
+            {
+                Instruction insn = *pc++;
+                uint32_t aux = *pc++;
+
+                // This call may realloc the stack! So we need to query args further down
+                VM_PROTECT(luaV_concatappend(L, LUAU_INSN_A(insn), LUAU_INSN_B(insn), LUAU_INSN_C(insn), aux));
+                VM_PROTECT(luaC_checkGC(L));
+                VM_NEXT();
+            }
+
+            VM_CASE(LOP_CONCATFLUSH)
+            {
+                Instruction insn = *pc++;
+
+                VM_PROTECT(luaV_concatflush(L, LUAU_INSN_A(insn), LUAU_INSN_B(insn)));
+                VM_PROTECT(luaC_checkGC(L));
+                VM_NEXT();
+            }
+
 #if !VM_USE_CGOTO
         default:
             LUAU_ASSERT(!"Unknown opcode");
@@ -15,6 +15,7 @@
 #include "lapi.h"
 
 #include <string.h>
+#include <stdlib.h>
 
 LUAU_FASTFLAGVARIABLE(LuauUdataDirectAccess6)
 LUAU_FASTFLAG(LuauCallFeedback)
@@ -166,11 +167,12 @@ static uint64_t readVarInt64(const char* data, size_t size, size_t& offset)
     return result;
 }
 
-static TString* readString(TempBuffer<TString*>& strings, const char* data, size_t size, size_t& offset)
+template<typename Source>
+static TString* readString(lua_State* L, Source& source, const char* data, size_t size, size_t& offset)
 {
     unsigned int id = readVarInt(data, size, offset);
 
-    return id == 0 ? NULL : strings[id - 1];
+    return id == 0 ? NULL : source.getstring(L, id - 1);
 }
 
 static void resolveImportSafe(lua_State* L, LuaTable* env, TValue* k, uint32_t id)
@@ -217,6 +219,51 @@ static void resolveImportSafe(lua_State* L, LuaTable* env, TValue* k, uint32_t i
     }
 }
 
+// Resolves an import without calling metamethods, so it can run while the stack can't be reallocated (e.g. during closure creation)
+// __index chains are only followed through tables; anything that would run code leaves the import unresolved for GETIMPORT to look up
+static void resolveImportRaw(lua_State* L, LuaTable* env, TValue* k, uint32_t id, TValue* res)
+{
+    setnilvalue(res);
+
+    if (!env->safeenv)
+        return;
+
+    int count = id >> 30;
+    LUAU_ASSERT(count > 0);
+
+    int ids[3] = {int(id >> 20) & 1023, int(id >> 10) & 1023, int(id) & 1023};
+
+    LuaTable* h = env;
+    const TValue* v = NULL;
+
+    for (int i = 0; i < count; ++i)
+    {
+        if (!h)
+            return;
+
+        v = luaH_get(h, &k[ids[i]]);
+
+        // same loop limit as luaV_gettable
+        for (int loop = 0; ttisnil(v) && loop < 100; ++loop)
+        {
+            const TValue* tm = fasttm(L, h->metatable, TM_INDEX);
+
+            if (!tm || !ttistable(tm))
+                return;
+
+            h = hvalue(tm);
+            v = luaH_get(h, &k[ids[i]]);
+        }
+
+        if (ttisnil(v))
+            return;
+
+        h = ttistable(v) ? hvalue(v) : NULL;
+    }
+
+    setobj(L, res, v);
+}
+
 static void remapUserdataTypes(char* data, size_t size, uint8_t* userdataRemapping, uint32_t count)
 {
     size_t offset = 0;
@@ -271,7 +318,975 @@ static void remapUserdataTypes(char* data, size_t size, uint8_t* userdataRemappi
         }
     }
 
-    LUAU_ASSERT(offset == size);
+    LUAU_ASSERT(offset == size);
+}
+
+enum LoadMode
+{
+    LoadEager,
+    LoadLazy,
+    LoadLazyMapped,
+};
+
+static const uint32_t kUserdataTypeLimit = LBC_TYPE_TAGGED_USERDATA_END - LBC_TYPE_TAGGED_USERDATA_BASE;
+
+// maxstacksize, numparams, nups, is_vararg and flags
+static const size_t kProtoHeaderSize = 5;
+
+struct LazyProto
+{
+    uint32_t offset; // location of the function header in the bytecode
+    Proto* p;        // function that was created but hasn't been decoded yet
+};
+
+// Lazily loaded chunks keep a copy of the bytecode around and decode function bodies on demand
+// The chunk is shared between all functions that haven't been decoded yet and is freed once the last one is decoded or collected
+struct LazyChunk
+{
+    int refs;
+    uint8_t memcat;
+
+    uint8_t version;
+    uint8_t typesversion;
+    bool compact;
+    uint8_t userdataRemapping[kUserdataTypeLimit];
+
+    const char* data;
+    size_t size;
+    bool ownsdata; // mapped bytecode is owned by the caller and is never freed by the chunk
+
+    uint32_t* stringOffsets;
+    unsigned int stringCount;
+
+    const char* numbers; // number constant pool of compact bytecode, points into data
+    unsigned int numberCount;
+
+    LazyProto* protos; // indexed by bytecode id
+    unsigned int protoCount;
+
+    const lua_SharedBytecode* shared;
+
+    LuaTable* importenv; // globals of the loading thread that imports are resolved against, kept alive by functions that use the chunk
+};
+
+// Bytecode and line info decoded once and shared between all states that load it with luau_loadshared
+// Line info doesn't depend on the state and is never modified, unlike code and constants
+struct lua_SharedBytecode
+{
+    char* data;
+    size_t size;
+
+    uint8_t** lineinfo; // indexed by bytecode id, lineinfo is followed by abslineinfo in the same allocation
+    uint32_t* lineinfosize; // follows the lineinfo array in the same allocation
+    unsigned int protoCount;
+
+    lua_Alloc frealloc;
+    void* ud;
+};
+
+static double readPoolNumber(const char* numbers, unsigned int count, unsigned int id)
+{
+    LUAU_ASSERT(id < count);
+
+    double result;
+    memcpy(&result, numbers + id * sizeof(double), sizeof(double));
+    return result;
+}
+
+struct EagerSource
+{
+    TempBuffer<TString*>& strings;
+    TempBuffer<Proto*>& protos;
+
+    const char* numbers;
+    unsigned int numberCount;
+
+    TString* getstring(lua_State* L, unsigned int id)
+    {
+        return strings[id];
+    }
+
+    double getnumber(unsigned int id)
+    {
+        return readPoolNumber(numbers, numberCount, id);
+    }
+
+    Proto* getfunction(lua_State* L, uint32_t fid)
+    {
+        return protos[fid];
+    }
+
+    void getimport(lua_State* L, LuaTable* envt, TValue* k, uint32_t id, TValue* res)
+    {
+        resolveImportSafe(L, envt, k, id);
+        setobj(L, res, L->top - 1);
+        L->top--;
+    }
+
+    uint8_t* getlineinfo(int fid)
+    {
+        return NULL;
+    }
+};
+
+struct LazySource
+{
+    LazyChunk* chunk;
+    TString* source;
+
+    TString* getstring(lua_State* L, unsigned int id)
+    {
+        LUAU_ASSERT(id < chunk->stringCount);
+
+        size_t offset = chunk->stringOffsets[id];
+        unsigned int length = readVarInt(chunk->data, chunk->size, offset);
+
+        return luaS_newlstr(L, chunk->data + offset, length);
+    }
+
+    double getnumber(unsigned int id)
+    {
+        return readPoolNumber(chunk->numbers, chunk->numberCount, id);
+    }
+
+    Proto* getfunction(lua_State* L, uint32_t fid)
+    {
+        LUAU_ASSERT(fid < chunk->protoCount);
+
+        // closure constants and the nested function list refer to the same function
+        if (Proto* p = chunk->protos[fid].p)
+            return p;
+
+        Proto* p = luaF_newproto(L);
+        p->source = source;
+        p->bytecodeid = int(fid);
+        p->funid = L->global->lastprotoid == 0 ? 0 : L->global->lastprotoid++;
+
+        // header is decoded right away since closure creation depends on it
+        size_t offset = chunk->protos[fid].offset;
+        p->maxstacksize = read<uint8_t>(chunk->data, chunk->size, offset);
+        p->numparams = read<uint8_t>(chunk->data, chunk->size, offset);
+        p->nups = read<uint8_t>(chunk->data, chunk->size, offset);
+        p->is_vararg = read<uint8_t>(chunk->data, chunk->size, offset);
+        p->flags = read<uint8_t>(chunk->data, chunk->size, offset);
+
+        p->lazychunk = chunk;
+        chunk->protos[fid].p = p;
+        chunk->refs++;
+
+        return p;
+    }
+
+    void getimport(lua_State* L, LuaTable* envt, TValue* k, uint32_t id, TValue* res)
+    {
+        // functions are decoded during closure creation, where the stack can't be reallocated and no code can run
+        resolveImportRaw(L, chunk->importenv, k, id, res);
+    }
+
+    uint8_t* getlineinfo(int fid)
+    {
+        return chunk->shared && unsigned(fid) < chunk->shared->protoCount ? chunk->shared->lineinfo[fid] : NULL;
+    }
+};
+
+static int getLineInfoIntervals(int sizecode, int linegaplog2)
+{
+    return ((sizecode - 1) >> linegaplog2) + 1;
+}
+
+static int getAbsLineInfoOffset(int sizecode)
+{
+    return (sizecode + 3) & ~3;
+}
+
+static void readLineInfo(const char* data, size_t size, size_t& offset, uint8_t* lineinfo, int* abslineinfo, int sizecode, int intervals)
+{
+    uint8_t lastoffset = 0;
+    for (int j = 0; j < sizecode; ++j)
+    {
+        lastoffset += read<uint8_t>(data, size, offset);
+        lineinfo[j] = lastoffset;
+    }
+
+    int lastline = 0;
+    for (int j = 0; j < intervals; ++j)
+    {
+        lastline += read<int32_t>(data, size, offset);
+        abslineinfo[j] = lastline;
+    }
+}
+
+// Compact line info is a list of runs of instructions that share a line; line tables are rebuilt in the same shape as regular line info
+static void readCompactLineInfo(
+    const char* data,
+    size_t size,
+    size_t& offset,
+    uint8_t* lineinfo,
+    int* abslineinfo,
+    int sizecode,
+    int linegaplog2,
+    int intervals
+)
+{
+    unsigned int runs = readVarInt(data, size, offset);
+    size_t runsOffset = offset;
+
+    // first pass: the baseline of each interval is the smallest line in it
+    for (int j = 0; j < intervals; ++j)
+        abslineinfo[j] = INT_MAX;
+
+    int line = 0;
+    int pc = 0;
+
+    for (unsigned int r = 0; r < runs; ++r)
+    {
+        unsigned int delta = readVarInt(data, size, offset);
+        int length = int(readVarInt(data, size, offset));
+
+        line += int(delta >> 1) ^ -int(delta & 1);
+
+        LUAU_ASSERT(length > 0 && pc + length <= sizecode);
+
+        for (int j = pc >> linegaplog2; j <= (pc + length - 1) >> linegaplog2; ++j)
+            abslineinfo[j] = abslineinfo[j] < line ? abslineinfo[j] : line;
+
+        pc += length;
+    }
+
+    LUAU_ASSERT(pc == sizecode);
+
+    // second pass: instruction lines are stored relative to the baseline
+    offset = runsOffset;
+    line = 0;
+    pc = 0;
+
+    for (unsigned int r = 0; r < runs; ++r)
+    {
+        unsigned int delta = readVarInt(data, size, offset);
+        int length = int(readVarInt(data, size, offset));
+
+        line += int(delta >> 1) ^ -int(delta & 1);
+
+        for (int j = 0; j < length; ++j, ++pc)
+            lineinfo[pc] = uint8_t(line - abslineinfo[pc >> linegaplog2]);
+    }
+}
+
+static void skipLineInfo(const char* data, size_t size, size_t& offset, bool compact, int sizecode, int intervals)
+{
+    if (compact)
+    {
+        unsigned int runs = readVarInt(data, size, offset);
+
+        for (unsigned int r = 0; r < runs * 2; ++r)
+            readVarInt(data, size, offset);
+    }
+    else
+    {
+        offset += sizecode + intervals * sizeof(int32_t);
+    }
+}
+
+// Compact bytecode stores each distinct number constant once per chunk; functions refer to them by index
+static const char* readNumberPool(const char* data, size_t size, size_t& offset, unsigned int& count)
+{
+    count = readVarInt(data, size, offset);
+
+    const char* numbers = data + offset;
+    offset += count * sizeof(double);
+
+    return numbers;
+}
+
+// Constants are decoded here for both loading and skipping, the visitor receives the operands of each constant kind
+template<typename Visitor>
+static void readConstant(const char* data, size_t size, size_t& offset, bool compact, Visitor& visitor)
+{
+    switch (uint8_t kind = read<uint8_t>(data, size, offset))
+    {
+    case LBC_CONSTANT_NIL:
+        break;
+
+    case LBC_CONSTANT_BOOLEAN:
+        visitor.boolean(read<uint8_t>(data, size, offset));
+        break;
+
+    case LBC_CONSTANT_NUMBER:
+        if (compact)
+            visitor.poolnumber(readVarInt(data, size, offset));
+        else
+            visitor.number(read<double>(data, size, offset));
+        break;
+
+    case LBC_CONSTANT_VECTOR:
+    {
+        float x = read<float>(data, size, offset);
+        float y = read<float>(data, size, offset);
+        float z = read<float>(data, size, offset);
+        float w = read<float>(data, size, offset);
+        visitor.vector(x, y, z, w);
+        break;
+    }
+
+    case LBC_CONSTANT_STRING:
+        visitor.string(readVarInt(data, size, offset));
+        break;
+
+    case LBC_CONSTANT_IMPORT:
+        visitor.import(read<uint32_t>(data, size, offset));
+        break;
+
+    case LBC_CONSTANT_TABLE:
+    case LBC_CONSTANT_TABLE_WITH_CONSTANTS:
+    {
+        bool withConstants = kind == LBC_CONSTANT_TABLE_WITH_CONSTANTS;
+        uint32_t keys = readVarInt(data, size, offset);
+        visitor.table(keys, withConstants);
+
+        for (uint32_t i = 0; i < keys; ++i)
+        {
+            int32_t key = readVarInt(data, size, offset);
+            int32_t constantIdx = withConstants ? read<int32_t>(data, size, offset) : -1;
+            visitor.tablekey(key, constantIdx);
+        }
+
+        visitor.tableend();
+        break;
+    }
+
+    case LBC_CONSTANT_CLOSURE:
+        visitor.closure(readVarInt(data, size, offset));
+        break;
+
+    case LBC_CONSTANT_CLASS_SHAPE:
+    {
+        uint32_t cnid = readVarInt(data, size, offset);
+        uint32_t numProperties = readVarInt(data, size, offset);
+        uint32_t numMethods = readVarInt(data, size, offset);
+        visitor.classshape(cnid, numProperties, numMethods);
+
+        for (uint32_t idx = 0; idx < numProperties + numMethods; idx++)
+            visitor.classmember(idx, readVarInt(data, size, offset));
+
+        visitor.classend();
+        break;
+    }
+
+    case LBC_CONSTANT_INTEGER:
+    {
+        bool isNegative = read<uint8_t>(data, size, offset);
+        uint64_t magnitude = readVarInt64(data, size, offset);
+        visitor.integer(isNegative ? (int64_t)(~magnitude + 1) : (int64_t)magnitude);
+        break;
+    }
+
+    default:
+        LUAU_ASSERT(!"Unexpected constant kind");
+    }
+}
+
+struct ConstantSkipper
+{
+    void boolean(uint8_t v) {}
+    void number(double v) {}
+    void poolnumber(unsigned int id) {}
+    void vector(float x, float y, float z, float w) {}
+    void string(unsigned int id) {}
+    void import(uint32_t iid) {}
+    void table(uint32_t keys, bool withConstants) {}
+    void tablekey(int32_t key, int32_t constantIdx) {}
+    void tableend() {}
+    void closure(uint32_t fid) {}
+    void classshape(uint32_t cnid, uint32_t numProperties, uint32_t numMethods) {}
+    void classmember(uint32_t idx, uint32_t mid) {}
+    void classend() {}
+    void integer(int64_t v) {}
+};
+
+// Builds the value of a single constant; constants are pre-initialized to nil so nil constants need no work
+template<typename Source>
+struct ConstantLoader
+{
+    lua_State* L;
+    Proto* p;
+    Source& source;
+    LuaTable* envt;
+    TValue* k;
+
+    LuaTable* h = NULL;
+    TempBuffer<int32_t> nilKeys;
+    size_t nilKeysSize = 0;
+
+    TValue* classname = NULL;
+    uint32_t numProperties = 0;
+    uint32_t numMethods = 0;
+    TString** offsetToMember = NULL;
+    LuaTable* membersToOffset = NULL;
+
+    ConstantLoader(lua_State* L, Proto* p, Source& source, LuaTable* envt, TValue* k)
+        : L(L)
+        , p(p)
+        , source(source)
+        , envt(envt)
+        , k(k)
+    {
+    }
+
+    void boolean(uint8_t v)
+    {
+        setbvalue(k, v);
+    }
+
+    void number(double v)
+    {
+        setnvalue(k, v);
+    }
+
+    void poolnumber(unsigned int id)
+    {
+        setnvalue(k, source.getnumber(id));
+    }
+
+    void vector(float x, float y, float z, float w)
+    {
+        (void)w;
+        setvvalue(k, x, y, z, w);
+    }
+
+    void string(unsigned int id)
+    {
+        TString* v = id == 0 ? NULL : source.getstring(L, id - 1);
+        setsvalue(L, k, v);
+    }
+
+    void import(uint32_t iid)
+    {
+        source.getimport(L, envt, p->k, iid, k);
+    }
+
+    void table(uint32_t keys, bool withConstants)
+    {
+        h = luaH_new(L, 0, keys);
+
+        if (withConstants)
+            nilKeys.allocate(L, keys);
+    }
+
+    void tablekey(int32_t key, int32_t constantIdx)
+    {
+        TValue* val = luaH_set(L, h, &p->k[key]);
+
+        if (constantIdx >= 0)
+        {
+            TValue* constant = &p->k[constantIdx];
+            if (ttisnil(constant))
+            {
+                nilKeys[nilKeysSize++] = key;
+            }
+            else
+            {
+                setobj2t(L, val, constant);
+                luaC_barriert(L, h, constant);
+                return;
+            }
+        }
+
+        setnvalue(val, 0.0);
+    }
+
+    void tableend()
+    {
+        for (size_t idx = 0; idx < nilKeysSize; idx++)
+        {
+            int32_t key = nilKeys[idx];
+            TValue* val = luaH_set(L, h, &p->k[key]);
+            setnilvalue(val);
+        }
+
+        sethvalue(L, k, h);
+    }
+
+    void closure(uint32_t fid)
+    {
+        Proto* pv = source.getfunction(L, fid);
+        Closure* cl = luaF_newLclosurelazy(L, pv->nups, envt, pv);
+        cl->preload = (cl->nupvalues > 0);
+        setclvalue(L, k, cl);
+    }
+
+    void classshape(uint32_t cnid, uint32_t numProperties, uint32_t numMethods)
+    {
+        classname = &p->k[cnid];
+        LUAU_ASSERT(ttisstring(classname));
+
+        this->numProperties = numProperties;
+        this->numMethods = numMethods;
+
+        uint32_t numMembers = numMethods + numProperties;
+        offsetToMember = luaM_newarray(L, numMembers, TString*, L->activememcat);
+        membersToOffset = luaH_new(L, 0, numMembers);
+    }
+
+    void classmember(uint32_t idx, uint32_t mid)
+    {
+        TValue* memberName = &p->k[mid];
+        LUAU_ASSERT(ttisstring(memberName));
+        offsetToMember[idx] = tsvalue(memberName);
+        TValue* val = luaH_setstr(L, membersToOffset, tsvalue(memberName));
+        setnvalue(val, idx);
+    }
+
+    void classend()
+    {
+        membersToOffset->readonly = true;
+
+        LuauClass* lco = luaR_newclass(L, tsvalue(classname), membersToOffset, offsetToMember, numProperties, numMethods);
+        setclassvalue(L, k, lco);
+    }
+
+    void integer(int64_t v)
+    {
+        setlvalue(k, v);
+    }
+};
+
+// Decodes everything that follows the function header: type information, code, constants, nested functions and debug information
+template<typename Source>
+static void loadProtoBody(
+    lua_State* L,
+    Proto* p,
+    Source& source,
+    const char* data,
+    size_t size,
+    size_t& offset,
+    uint8_t version,
+    uint8_t typesversion,
+    bool compact,
+    uint8_t* userdataRemapping,
+    LuaTable* envt
+)
+{
+    if (version >= 4)
+    {
+        if (typesversion == 1)
+        {
+            uint32_t typesize = readVarInt(data, size, offset);
+
+            if (typesize)
+            {
+                uint8_t* types = (uint8_t*)data + offset;
+
+                LUAU_ASSERT(typesize == unsigned(2 + p->numparams));
+                LUAU_ASSERT(types[0] == LBC_TYPE_FUNCTION);
+                LUAU_ASSERT(types[1] == p->numparams);
+
+                // transform v1 into v2 format
+                int headersize = typesize > 127 ? 4 : 3;
+
+                p->typeinfo = luaM_newarray(L, headersize + typesize, uint8_t, p->memcat);
+                p->sizetypeinfo = headersize + typesize;
+
+                if (headersize == 4)
+                {
+                    p->typeinfo[0] = (typesize & 127) | (1 << 7);
+                    p->typeinfo[1] = typesize >> 7;
+                    p->typeinfo[2] = 0;
+                    p->typeinfo[3] = 0;
+                }
+                else
+                {
+                    p->typeinfo[0] = uint8_t(typesize);
+                    p->typeinfo[1] = 0;
+                    p->typeinfo[2] = 0;
+                }
+
+                memcpy(p->typeinfo + headersize, types, typesize);
+            }
+
+            offset += typesize;
+        }
+        else if (typesversion == 2 || typesversion == 3)
+        {
+            uint32_t typesize = readVarInt(data, size, offset);
+
+            if (typesize)
+            {
+                uint8_t* types = (uint8_t*)data + offset;
+
+                p->typeinfo = luaM_newarray(L, typesize, uint8_t, p->memcat);
+                p->sizetypeinfo = typesize;
+                memcpy(p->typeinfo, types, typesize);
+                offset += typesize;
+
+                if (typesversion == 3)
+                {
+                    remapUserdataTypes((char*)(uint8_t*)p->typeinfo, p->sizetypeinfo, userdataRemapping, kUserdataTypeLimit);
+                }
+            }
+        }
+    }
+
+    const int sizecode = readVarInt(data, size, offset);
+    p->code = luaM_newarray(L, sizecode, Instruction, p->memcat);
+    p->sizecode = sizecode;
+
+    for (int j = 0; j < p->sizecode; ++j)
+        p->code[j] = read<uint32_t>(data, size, offset);
+
+    p->codeentry = p->code;
+
+    const int sizek = readVarInt(data, size, offset);
+    p->k = luaM_newarray(L, sizek, TValue, p->memcat);
+    p->sizek = sizek;
+
+    // Initialize the constants to nil to ensure they have a valid state
+    // in the event that some operation in the following loop fails with
+    // an exception.
+    for (int j = 0; j < p->sizek; ++j)
+    {
+        setnilvalue(&p->k[j]);
+    }
+
+    for (int j = 0; j < p->sizek; ++j)
+    {
+        ConstantLoader<Source> loader(L, p, source, envt, &p->k[j]);
+        readConstant(data, size, offset, compact, loader);
+    }
+
+    if (FFlag::LuauUdataDirectAccess6)
+    {
+        for (Instruction* instruction = p->code; instruction < p->code + p->sizecode;)
+        {
+            int targetOp = -1;
+
+            switch (LUAU_INSN_OP(*instruction))
+            {
+            case LOP_GETTABLEKS:
+                targetOp = LOP_GETUDATAKS;
+                break;
+
+            case LOP_SETTABLEKS:
+                targetOp = LOP_SETUDATAKS;
+                break;
+
+            case LOP_NAMECALL:
+                targetOp = LOP_NAMECALLUDATA;
+                break;
+            }
+
+            if (targetOp != -1)
+            {
+                LUAU_ASSERT(instruction[1] < uint32_t(sizek));
+
+                // We take over the upper 16 bits of AUX - so no constants with big indices.
+                if (instruction[1] < 0x10000)
+                {
+                    TValue* k = &p->k[instruction[1]];
+                    TString* s = tsvalue(k);
+
+                    luaS_updateatom(L, s);
+
+                    if (s->atom >= 0)
+                        *instruction = (*instruction & 0xffffff00) | targetOp;
+                }
+            }
+
+            instruction += Luau::getOpLength(LuauOpcode(LUAU_INSN_OP(*instruction)));
+        }
+    }
+
+    const int sizep = readVarInt(data, size, offset);
+    p->p = luaM_newarray(L, sizep, Proto*, p->memcat);
+    p->sizep = sizep;
+
+    // nested functions of a lazily loaded chunk are created here, which can fail
+    for (int j = 0; j < p->sizep; ++j)
+        p->p[j] = NULL;
+
+    for (int j = 0; j < p->sizep; ++j)
+    {
+        uint32_t fid = readVarInt(data, size, offset);
+        p->p[j] = source.getfunction(L, fid);
+    }
+
+    p->linedefined = readVarInt(data, size, offset);
+    p->debugname = readString(L, source, data, size, offset);
+
+    uint8_t lineinfo = read<uint8_t>(data, size, offset);
+
+    if (lineinfo)
+    {
+        p->linegaplog2 = read<uint8_t>(data, size, offset);
+
+        int intervals = getLineInfoIntervals(p->sizecode, p->linegaplog2);
+        int absoffset = getAbsLineInfoOffset(p->sizecode);
+
+        if (uint8_t* shared = source.getlineinfo(p->bytecodeid))
+        {
+            // line info decoded by luau_newsharedbytecode is not owned by the function, which is marked by zero size
+            p->lineinfo = shared;
+            p->abslineinfo = (int*)(p->lineinfo + absoffset);
+
+            skipLineInfo(data, size, offset, compact, p->sizecode, intervals);
+        }
+        else
+        {
+            const int sizelineinfo = absoffset + intervals * sizeof(int);
+            p->lineinfo = luaM_newarray(L, sizelineinfo, uint8_t, p->memcat);
+            p->sizelineinfo = sizelineinfo;
+
+            p->abslineinfo = (int*)(p->lineinfo + absoffset);
+
+            if (compact)
+                readCompactLineInfo(data, size, offset, p->lineinfo, p->abslineinfo, p->sizecode, p->linegaplog2, intervals);
+            else
+                readLineInfo(data, size, offset, p->lineinfo, p->abslineinfo, p->sizecode, intervals);
+        }
+    }
+
+    uint8_t debuginfo = read<uint8_t>(data, size, offset);
+
+    if (debuginfo)
+    {
+        const int sizelocvars = readVarInt(data, size, offset);
+        p->locvars = luaM_newarray(L, sizelocvars, LocVar, p->memcat);
+        p->sizelocvars = sizelocvars;
+
+        // names of lazily decoded functions are created here, which can fail
+        for (int j = 0; j < p->sizelocvars; ++j)
+            p->locvars[j].varname = NULL;
+
+        for (int j = 0; j < p->sizelocvars; ++j)
+        {
+            p->locvars[j].varname = readString(L, source, data, size, offset);
+            p->locvars[j].startpc = readVarInt(data, size, offset);
+            p->locvars[j].endpc = readVarInt(data, size, offset);
+
+            // compact bytecode stores the length of the local range
+            if (compact)
+                p->locvars[j].endpc += p->locvars[j].startpc;
+            p->locvars[j].reg = read<uint8_t>(data, size, offset);
+        }
+
+        const int sizeupvalues = readVarInt(data, size, offset);
+        LUAU_ASSERT(sizeupvalues == p->nups);
+
+        p->upvalues = luaM_newarray(L, sizeupvalues, TString*, p->memcat);
+        p->sizeupvalues = sizeupvalues;
+
+        for (int j = 0; j < p->sizeupvalues; ++j)
+            p->upvalues[j] = NULL;
+
+        for (int j = 0; j < p->sizeupvalues; ++j)
+        {
+            p->upvalues[j] = readString(L, source, data, size, offset);
+        }
+    }
+
+    if (version >= 11)
+    {
+        p->feedbackvecsize = readVarInt(data, size, offset);
+
+        if (p->feedbackvecsize > 0)
+        {
+            p->feedbackvec = luaM_newarray(L, p->feedbackvecsize, FeedbackVectorSlot, p->memcat);
+        }
+        for (uint32_t j = 0; j < p->feedbackvecsize; j++)
+        {
+            uint8_t slottype = read<uint8_t>(data, size, offset);
+            LUAU_ASSERT(slottype == LFT_CALLTARGET);
+            FeedbackVectorSlot& slot = p->feedbackvec[j];
+            slot.kind = static_cast<FeedbackVectorSlotKind>(slottype);
+            slot.call_target.pc = readVarInt(data, size, offset);
+            slot.call_target.proto = 0;
+            slot.call_target.hits = 0;
+        }
+    }
+
+    if (version >= 12)
+    {
+        if ((p->flags & LPF_INLINABLE) != 0)
+            p->cost = readVarInt64(data, size, offset);
+    }
+}
+
+static void freeChunk(lua_State* L, LazyChunk* chunk)
+{
+    if (chunk->ownsdata)
+        luaM_freearray(L, const_cast<char*>(chunk->data), chunk->size, char, chunk->memcat);
+    luaM_freearray(L, chunk->stringOffsets, chunk->stringCount, uint32_t, chunk->memcat);
+    luaM_freearray(L, chunk->protos, chunk->protoCount, LazyProto, chunk->memcat);
+    luaM_freearray(L, chunk, 1, LazyChunk, chunk->memcat);
+}
+
+static void releaseChunk(lua_State* L, LazyChunk* chunk)
+{
+    LUAU_ASSERT(chunk->refs > 0);
+
+    if (--chunk->refs == 0)
+        freeChunk(L, chunk);
+}
+
+// Releases everything but the header from a function which failed to decode
+static void discardProtoBody(lua_State* L, Proto* p)
+{
+    if (p->typeinfo)
+        luaM_freearray(L, p->typeinfo, p->sizetypeinfo, uint8_t, p->memcat);
+    p->typeinfo = NULL;
+    p->sizetypeinfo = 0;
+
+    luaM_freearray(L, p->code, p->sizecode, Instruction, p->memcat);
+    p->code = NULL;
+    p->codeentry = NULL;
+    p->sizecode = 0;
+
+    luaM_freearray(L, p->k, p->sizek, TValue, p->memcat);
+    p->k = NULL;
+    p->sizek = 0;
+
+    luaM_freearray(L, p->p, p->sizep, Proto*, p->memcat);
+    p->p = NULL;
+    p->sizep = 0;
+
+    if (p->lineinfo && p->sizelineinfo != 0)
+        luaM_freearray(L, p->lineinfo, p->sizelineinfo, uint8_t, p->memcat);
+    p->lineinfo = NULL;
+    p->abslineinfo = NULL;
+    p->sizelineinfo = 0;
+
+    luaM_freearray(L, p->locvars, p->sizelocvars, struct LocVar, p->memcat);
+    p->locvars = NULL;
+    p->sizelocvars = 0;
+
+    luaM_freearray(L, p->upvalues, p->sizeupvalues, TString*, p->memcat);
+    p->upvalues = NULL;
+    p->sizeupvalues = 0;
+
+    if (p->feedbackvec)
+        luaM_freearray(L, p->feedbackvec, p->feedbackvecsize, FeedbackVectorSlot, p->memcat);
+    p->feedbackvec = NULL;
+    p->feedbackvecsize = 0;
+}
+
+template<typename Source>
+static void loadUserdataRemapping(lua_State* L, Source& source, const char* data, size_t size, size_t& offset, uint8_t* userdataRemapping)
+{
+    memset(userdataRemapping, LBC_TYPE_USERDATA, kUserdataTypeLimit);
+
+    uint8_t index = read<uint8_t>(data, size, offset);
+
+    while (index != 0)
+    {
+        TString* name = readString(L, source, data, size, offset);
+
+        if (uint32_t(index - 1) < kUserdataTypeLimit)
+        {
+            if (auto cb = L->global->ecb.gettypemapping)
+                userdataRemapping[index - 1] = cb(L, getstr(name), name->len);
+        }
+
+        index = read<uint8_t>(data, size, offset);
+    }
+}
+
+// Only the main function is decoded, other functions are decoded when their first closure is created
+static int loadLazy(
+    lua_State* L,
+    LoadMode mode,
+    const lua_SharedBytecode* shared,
+    LazyChunk*& chunk,
+    const char* chunkname,
+    const char* data,
+    size_t size,
+    int env,
+    size_t offset,
+    uint8_t version,
+    uint8_t typesversion,
+    bool compact
+)
+{
+    // env is 0 for current environment and a stack index otherwise
+    LuaTable* envt = (env == 0) ? L->gt : hvalue(luaA_toobject(L, env));
+
+    TString* source = luaS_new(L, chunkname);
+
+    uint8_t memcat = L->activememcat;
+
+    chunk = luaM_newarray(L, 1, LazyChunk, memcat);
+    memset(chunk, 0, sizeof(LazyChunk));
+    chunk->refs = 1; // released by the loader
+    chunk->memcat = memcat;
+    chunk->version = version;
+    chunk->typesversion = typesversion;
+    chunk->compact = compact;
+    chunk->shared = shared;
+    chunk->importenv = L->gt; // same table the eager loader resolves imports against
+
+    if (mode == LoadLazyMapped)
+    {
+        // mapped bytecode is guaranteed to outlive the state, so functions are decoded straight from it
+        // instructions are still copied because execution patches them, and line info is stored delta-encoded in the bytecode
+        chunk->data = data;
+        chunk->size = size;
+    }
+    else
+    {
+        // caller owns the bytecode buffer, so the chunk needs its own copy
+        char* copy = luaM_newarray(L, size, char, memcat);
+        memcpy(copy, data, size);
+
+        chunk->data = copy;
+        chunk->size = size;
+        chunk->ownsdata = true;
+    }
+
+    // string table; strings are created when the functions that use them are decoded
+    unsigned int stringCount = readVarInt(data, size, offset);
+    chunk->stringOffsets = luaM_newarray(L, stringCount, uint32_t, memcat);
+    chunk->stringCount = stringCount;
+
+    for (unsigned int i = 0; i < stringCount; ++i)
+    {
+        chunk->stringOffsets[i] = uint32_t(offset);
+
+        unsigned int length = readVarInt(data, size, offset);
+        offset += length;
+    }
+
+    LazySource lazy = {chunk, source};
+
+    if (typesversion == 3)
+        loadUserdataRemapping(L, lazy, data, size, offset, chunk->userdataRemapping);
+
+    if (compact)
+        chunk->numbers = readNumberPool(chunk->data, size, offset, chunk->numberCount);
+
+    // proto table; only function locations are recorded
+    unsigned int protoCount = readVarInt(data, size, offset);
+    chunk->protos = luaM_newarray(L, protoCount, LazyProto, memcat);
+    chunk->protoCount = protoCount;
+
+    for (unsigned int i = 0; i < protoCount; ++i)
+    {
+        uint32_t protoSize = readVarInt(data, size, offset);
+
+        chunk->protos[i].offset = uint32_t(offset);
+        chunk->protos[i].p = NULL;
+
+        offset += protoSize;
+    }
+
+    // "main" proto is pushed to Lua stack
+    uint32_t mainid = readVarInt(data, size, offset);
+    Proto* main = lazy.getfunction(L, mainid);
+
+    luaC_threadbarrier(L);
+
+    Closure* cl = luaF_newLclosure(L, 0, envt, main);
+    setclvalue(L, L->top, cl);
+    incr_top(L);
+
+    return 0;
 }
 
 static int loadsafe(
@@ -281,7 +1296,10 @@ static int loadsafe(
     const char* chunkname,
     const char* data,
     size_t size,
-    int env
+    LazyChunk*& chunk,
+    int env,
+    LoadMode mode,
+    const lua_SharedBytecode* shared
 )
 {
     size_t offset = 0;
@@ -323,6 +1341,13 @@ static int loadsafe(
         }
     }
 
+    // version 14 introduced the compact encoding, which all later versions use
+    bool compact = version >= 14;
+
+    // function bodies can only be skipped when their size is known, older bytecode is always decoded eagerly
+    if (mode != LoadEager && version >= 12)
+        return loadLazy(L, mode, shared, chunk, chunkname, data, size, env, offset, version, typesversion, compact);
+
     // env is 0 for current environment and a stack index otherwise
     LuaTable* envt = (env == 0) ? L->gt : hvalue(luaA_toobject(L, env));
 
@@ -340,30 +1365,17 @@ static int loadsafe(
         offset += length;
     }
 
+    EagerSource eager = {strings, protos, NULL, 0};
+
     // userdata type remapping table
     // for unknown userdata types, the entry will remap to common 'userdata' type
-    const uint32_t userdataTypeLimit = LBC_TYPE_TAGGED_USERDATA_END - LBC_TYPE_TAGGED_USERDATA_BASE;
-    uint8_t userdataRemapping[userdataTypeLimit];
+    uint8_t userdataRemapping[kUserdataTypeLimit];
 
     if (typesversion == 3)
-    {
-        memset(userdataRemapping, LBC_TYPE_USERDATA, userdataTypeLimit);
-
-        uint8_t index = read<uint8_t>(data, size, offset);
-
-        while (index != 0)
-        {
-            TString* name = readString(strings, data, size, offset);
-
-            if (uint32_t(index - 1) < userdataTypeLimit)
-            {
-                if (auto cb = L->global->ecb.gettypemapping)
-                    userdataRemapping[index - 1] = cb(L, getstr(name), name->len);
-            }
+        loadUserdataRemapping(L, eager, data, size, offset, userdataRemapping);
 
-            index = read<uint8_t>(data, size, offset);
-        }
-    }
+    if (compact)
+        eager.numbers = readNumberPool(data, size, offset, eager.numberCount);
 
     // proto table
     unsigned int protoCount = readVarInt(data, size, offset);
@@ -386,448 +1398,328 @@ static int loadsafe(
         p->is_vararg = read<uint8_t>(data, size, offset);
 
         if (version >= 4)
-        {
             p->flags = read<uint8_t>(data, size, offset);
 
-            if (typesversion == 1)
-            {
-                uint32_t typesize = readVarInt(data, size, offset);
-
-                if (typesize)
-                {
-                    uint8_t* types = (uint8_t*)data + offset;
-
-                    LUAU_ASSERT(typesize == unsigned(2 + p->numparams));
-                    LUAU_ASSERT(types[0] == LBC_TYPE_FUNCTION);
-                    LUAU_ASSERT(types[1] == p->numparams);
-
-                    // transform v1 into v2 format
-                    int headersize = typesize > 127 ? 4 : 3;
-
-                    p->typeinfo = luaM_newarray(L, headersize + typesize, uint8_t, p->memcat);
-                    p->sizetypeinfo = headersize + typesize;
-
-                    if (headersize == 4)
-                    {
-                        p->typeinfo[0] = (typesize & 127) | (1 << 7);
-                        p->typeinfo[1] = typesize >> 7;
-                        p->typeinfo[2] = 0;
-                        p->typeinfo[3] = 0;
-                    }
-                    else
-                    {
-                        p->typeinfo[0] = uint8_t(typesize);
-                        p->typeinfo[1] = 0;
-                        p->typeinfo[2] = 0;
-                    }
-
-                    memcpy(p->typeinfo + headersize, types, typesize);
-                }
+        loadProtoBody(L, p, eager, data, size, offset, version, typesversion, compact, userdataRemapping, envt);
 
-                offset += typesize;
-            }
-            else if (typesversion == 2 || typesversion == 3)
-            {
-                uint32_t typesize = readVarInt(data, size, offset);
+        if (version >= 12)
+        {
+            // Potantially skipping unknown data at the end of Proto.
+            offset = protoStartOffset + protoSize;
+        }
 
-                if (typesize)
-                {
-                    uint8_t* types = (uint8_t*)data + offset;
+        protos[i] = p;
+    }
 
-                    p->typeinfo = luaM_newarray(L, typesize, uint8_t, p->memcat);
-                    p->sizetypeinfo = typesize;
-                    memcpy(p->typeinfo, types, typesize);
-                    offset += typesize;
+    // "main" proto is pushed to Lua stack
+    uint32_t mainid = readVarInt(data, size, offset);
+    Proto* main = protos[mainid];
 
-                    if (typesversion == 3)
-                    {
-                        remapUserdataTypes((char*)(uint8_t*)p->typeinfo, p->sizetypeinfo, userdataRemapping, userdataTypeLimit);
-                    }
-                }
-            }
-        }
+    luaC_threadbarrier(L);
 
-        const int sizecode = readVarInt(data, size, offset);
-        p->code = luaM_newarray(L, sizecode, Instruction, p->memcat);
-        p->sizecode = sizecode;
+    Closure* cl = luaF_newLclosure(L, 0, envt, main);
+    setclvalue(L, L->top, cl);
+    incr_top(L);
 
-        for (int j = 0; j < p->sizecode; ++j)
-            p->code[j] = read<uint32_t>(data, size, offset);
+    return 0;
+}
 
-        p->codeentry = p->code;
+void luaV_loadproto(lua_State* L, Proto* p, LuaTable* env)
+{
+    LazyChunk* chunk = p->lazychunk;
+    LUAU_ASSERT(chunk && chunk->protos[p->bytecodeid].p == p);
 
-        const int sizek = readVarInt(data, size, offset);
-        p->k = luaM_newarray(L, sizek, TValue, p->memcat);
-        p->sizek = sizek;
+    struct LoadProtoContext
+    {
+        Proto* p;
+        LuaTable* env;
 
-        // Initialize the constants to nil to ensure they have a valid state
-        // in the event that some operation in the following loop fails with
-        // an exception.
-        for (int j = 0; j < p->sizek; ++j)
+        static void run(lua_State* L, void* ud)
         {
-            setnilvalue(&p->k[j]);
-        }
+            LoadProtoContext* ctx = (LoadProtoContext*)ud;
+            Proto* p = ctx->p;
+            LazyChunk* chunk = p->lazychunk;
 
-        for (int j = 0; j < p->sizek; ++j)
-        {
-            switch (read<uint8_t>(data, size, offset))
-            {
-            case LBC_CONSTANT_NIL:
-                // All constants have already been pre-initialized to nil
-                break;
+            // an earlier attempt could have failed with an out of memory error
+            discardProtoBody(L, p);
 
-            case LBC_CONSTANT_BOOLEAN:
-            {
-                uint8_t v = read<uint8_t>(data, size, offset);
-                setbvalue(&p->k[j], v);
-                break;
-            }
+            // function header has been decoded when the function was created
+            size_t offset = chunk->protos[p->bytecodeid].offset + kProtoHeaderSize;
 
-            case LBC_CONSTANT_NUMBER:
-            {
-                double v = read<double>(data, size, offset);
-                setnvalue(&p->k[j], v);
-                break;
-            }
+            LazySource source = {chunk, p->source};
+            loadProtoBody(
+                L, p, source, chunk->data, chunk->size, offset, chunk->version, chunk->typesversion, chunk->compact, chunk->userdataRemapping, ctx->env
+            );
+        }
+    } ctx = {p, env};
 
-            case LBC_CONSTANT_VECTOR:
-            {
-                float x = read<float>(data, size, offset);
-                float y = read<float>(data, size, offset);
-                float z = read<float>(data, size, offset);
-                float w = read<float>(data, size, offset);
-                (void)w;
-                setvvalue(&p->k[j], x, y, z, w);
-                break;
-            }
+    int status;
 
-            case LBC_CONSTANT_STRING:
-            {
-                TString* v = readString(strings, data, size, offset);
-                setsvalue(L, &p->k[j], v);
-                break;
-            }
+    {
+        // pause GC for the duration of decoding - function contents are attached to the function before they are complete
+        // decoding runs protected so that the threshold is restored before an error is propagated
+        const ScopedSetGCThreshold pauseGC{L->global, SIZE_MAX};
 
-            case LBC_CONSTANT_IMPORT:
-            {
-                uint32_t iid = read<uint32_t>(data, size, offset);
-                resolveImportSafe(L, envt, p->k, iid);
-                setobj(L, &p->k[j], L->top - 1);
-                L->top--;
-                break;
-            }
+        status = luaD_rawrunprotected(L, &LoadProtoContext::run, &ctx);
+    }
 
-            case LBC_CONSTANT_TABLE:
-            {
-                int keys = readVarInt(data, size, offset);
-                LuaTable* h = luaH_new(L, 0, keys);
-                for (int i = 0; i < keys; ++i)
-                {
-                    int key = readVarInt(data, size, offset);
-                    TValue* val = luaH_set(L, h, &p->k[key]);
-                    setnvalue(val, 0.0);
-                }
-                sethvalue(L, &p->k[j], h);
-                break;
-            }
+    // decoding doesn't run any code, so this is normally an OOM error; the error object, if any, is already on the stack
+    if (status != LUA_OK)
+        luaD_throw(L, status);
 
-            case LBC_CONSTANT_TABLE_WITH_CONSTANTS:
-            {
-                uint32_t keys = readVarInt(data, size, offset);
-                LuaTable* h = luaH_new(L, 0, keys);
+    chunk->protos[p->bytecodeid].p = NULL;
+    p->lazychunk = NULL;
+    releaseChunk(L, chunk);
 
-                TempBuffer<int32_t> nilKeys;
-                nilKeys.allocate(L, keys);
-                size_t nilKeysSize = 0;
+    // function could have been traversed already, in which case new contents have to be marked
+    if (isblack(obj2gco(p)))
+        luaC_barrierback(L, obj2gco(p), &p->gclist);
+}
 
-                for (uint32_t i = 0; i < keys; ++i)
-                {
-                    int32_t key = readVarInt(data, size, offset);
-                    TValue* val = luaH_set(L, h, &p->k[key]);
-                    int32_t constantIdx = read<int32_t>(data, size, offset);
-                    if (constantIdx >= 0)
-                    {
-                        TValue* constant = &p->k[constantIdx];
-                        if (ttisnil(constant))
-                        {
-                            nilKeys[nilKeysSize++] = key;
-                        }
-                        else
-                        {
-                            setobj2t(L, val, constant);
-                            luaC_barriert(L, h, constant);
-                            continue;
-                        }
-                    }
-                    setnvalue(val, 0.0);
-                }
+LuaTable* luaV_lazyprotoenv(Proto* p)
+{
+    LUAU_ASSERT(p->lazychunk);
+    return p->lazychunk->importenv;
+}
 
-                for (size_t idx = 0; idx < nilKeysSize; idx++)
-                {
-                    int32_t key = nilKeys[idx];
-                    TValue* val = luaH_set(L, h, &p->k[key]);
-                    setnilvalue(val);
-                }
+void luaV_freelazyproto(lua_State* L, Proto* p)
+{
+    LazyChunk* chunk = p->lazychunk;
+    LUAU_ASSERT(chunk && chunk->protos[p->bytecodeid].p == p);
 
-                sethvalue(L, &p->k[j], h);
-                break;
-            }
+    chunk->protos[p->bytecodeid].p = NULL;
+    p->lazychunk = NULL;
+    releaseChunk(L, chunk);
+}
 
-            case LBC_CONSTANT_CLOSURE:
-            {
-                uint32_t fid = readVarInt(data, size, offset);
-                Closure* cl = luaF_newLclosure(L, protos[fid]->nups, envt, protos[fid]);
-                cl->preload = (cl->nupvalues > 0);
-                setclvalue(L, &p->k[j], cl);
-                break;
-            }
+static int load(lua_State* L, const char* chunkname, const char* data, size_t size, int env, LoadMode mode, const lua_SharedBytecode* shared)
+{
+    // we will allocate a fair amount of memory so check GC before we do
+    luaC_checkGC(L);
 
-            case LBC_CONSTANT_CLASS_SHAPE:
-            {
-                uint32_t cnid = readVarInt(data, size, offset);
-                TValue* classname = &p->k[cnid];
-                LUAU_ASSERT(ttisstring(classname));
-                uint32_t numProperties = readVarInt(data, size, offset);
-                uint32_t numMethods = readVarInt(data, size, offset);
-                uint32_t numMembers = numMethods + numProperties;
-                TString** offsetToMember = luaM_newarray(L, numMembers, TString*, L->activememcat);
-                LuaTable* membersToOffset = luaH_new(L, 0, numMembers);
-
-                for (uint32_t idx = 0; idx < numMembers; idx++)
-                {
-                    uint32_t mid = readVarInt(data, size, offset);
-                    TValue* memberName = &p->k[mid];
-                    LUAU_ASSERT(ttisstring(memberName));
-                    offsetToMember[idx] = tsvalue(memberName);
-                    TValue* val = luaH_setstr(L, membersToOffset, tsvalue(memberName));
-                    setnvalue(val, idx);
-                }
+    // pause GC for the duration of deserialization - some objects we're creating aren't rooted
+    const ScopedSetGCThreshold pauseGC{L->global, SIZE_MAX};
 
-                membersToOffset->readonly = true;
+    struct LoadContext
+    {
+        TempBuffer<TString*> strings;
+        TempBuffer<Proto*> protos;
+        LazyChunk* chunk;
+        const char* chunkname;
+        const char* data;
+        size_t size;
+        int env;
+        LoadMode mode;
+        const lua_SharedBytecode* shared;
 
-                LuauClass* lco = luaR_newclass(L, tsvalue(classname), membersToOffset, offsetToMember, numProperties, numMethods);
-                setclassvalue(L, &p->k[j], lco);
-                break;
-            }
+        int result;
 
-            case LBC_CONSTANT_INTEGER:
-            {
-                bool isNegative = read<uint8_t>(data, size, offset);
-                uint64_t magnitude = readVarInt64(data, size, offset);
-                setlvalue(&p->k[j], isNegative ? (int64_t)(~magnitude + 1) : (int64_t)magnitude);
-                break;
-            }
+        static void run(lua_State* L, void* ud)
+        {
+            LoadContext* ctx = (LoadContext*)ud;
 
-            default:
-                LUAU_ASSERT(!"Unexpected constant kind");
-            }
+            ctx->result = loadsafe(L, ctx->strings, ctx->protos, ctx->chunkname, ctx->data, ctx->size, ctx->chunk, ctx->env, ctx->mode, ctx->shared);
         }
+    } ctx = {
+        {},
+        {},
+        NULL,
+        chunkname,
+        data,
+        size,
+        env,
+        mode,
+        shared,
+    };
 
-        if (FFlag::LuauUdataDirectAccess6)
-        {
-            for (Instruction* instruction = p->code; instruction < p->code + p->sizecode;)
-            {
-                int targetOp = -1;
+    int status = luaD_rawrunprotected(L, &LoadContext::run, &ctx);
 
-                switch (LUAU_INSN_OP(*instruction))
-                {
-                case LOP_GETTABLEKS:
-                    targetOp = LOP_GETUDATAKS;
-                    break;
+    // functions that weren't decoded keep the chunk alive, the reference held by the loader is no longer needed
+    if (ctx.chunk)
+        releaseChunk(L, ctx.chunk);
 
-                case LOP_SETTABLEKS:
-                    targetOp = LOP_SETUDATAKS;
-                    break;
+    // load can either succeed or get an OOM error, any other errors should be handled internally
+    LUAU_ASSERT(status == LUA_OK || status == LUA_ERRMEM);
 
-                case LOP_NAMECALL:
-                    targetOp = LOP_NAMECALLUDATA;
-                    break;
-                }
+    if (status == LUA_ERRMEM)
+    {
+        lua_pushstring(L, LUA_MEMERRMSG); // out-of-memory error message doesn't require an allocation
+        return 1;
+    }
 
-                if (targetOp != -1)
-                {
-                    LUAU_ASSERT(instruction[1] < uint32_t(sizek));
+    return ctx.result;
+}
 
-                    // We take over the upper 16 bits of AUX - so no constants with big indices.
-                    if (instruction[1] < 0x10000)
-                    {
-                        TValue* k = &p->k[instruction[1]];
-                        TString* s = tsvalue(k);
+int luau_load(lua_State* L, const char* chunkname, const char* data, size_t size, int env)
+{
+    return load(L, chunkname, data, size, env, LoadEager, NULL);
+}
 
-                        luaS_updateatom(L, s);
+int luau_loadlazy(lua_State* L, const char* chunkname, const char* data, size_t size, int env)
+{
+    return load(L, chunkname, data, size, env, LoadLazy, NULL);
+}
 
-                        if (s->atom >= 0)
-                            *instruction = (*instruction & 0xffffff00) | targetOp;
-                    }
-                }
+int luau_loadmapped(lua_State* L, const char* chunkname, const char* data, size_t size, int env)
+{
+    return load(L, chunkname, data, size, env, LoadLazyMapped, NULL);
+}
 
-                instruction += Luau::getOpLength(LuauOpcode(LUAU_INSN_OP(*instruction)));
-            }
+lua_SharedBytecode* luau_newsharedbytecode(const char* data, size_t size, lua_Alloc f, void* ud)
+{
+    lua_SharedBytecode* shared = (lua_SharedBytecode*)(*f)(ud, NULL, 0, sizeof(lua_SharedBytecode));
+    if (!shared)
+        return NULL;
+
+    shared->data = NULL;
+    shared->size = 0;
+    shared->lineinfo = NULL;
+    shared->lineinfosize = NULL;
+    shared->protoCount = 0;
+    shared->frealloc = f;
+    shared->ud = ud;
+
+    if (size > 0)
+    {
+        shared->data = (char*)(*f)(ud, NULL, 0, size);
+        if (!shared->data)
+        {
+            luau_freesharedbytecode(shared);
+            return NULL;
         }
 
-        const int sizep = readVarInt(data, size, offset);
-        p->p = luaM_newarray(L, sizep, Proto*, p->memcat);
-        p->sizep = sizep;
+        memcpy(shared->data, data, size);
+        shared->size = size;
+    }
 
-        for (int j = 0; j < p->sizep; ++j)
-        {
-            uint32_t fid = readVarInt(data, size, offset);
-            p->p[j] = protos[fid];
-        }
+    size_t offset = 0;
 
-        p->linedefined = readVarInt(data, size, offset);
-        p->debugname = readString(strings, data, size, offset);
+    // line info is only shared for bytecode that can be loaded lazily, other bytecode is just kept around
+    uint8_t version = size > 0 ? read<uint8_t>(data, size, offset) : 0;
+    if (version < 12 || version > LBC_VERSION_MAX)
+        return shared;
 
-        uint8_t lineinfo = read<uint8_t>(data, size, offset);
+    uint8_t typesversion = read<uint8_t>(data, size, offset);
+    if (typesversion < LBC_TYPE_VERSION_MIN || typesversion > LBC_TYPE_VERSION_MAX)
+        return shared;
 
-        if (lineinfo)
-        {
-            p->linegaplog2 = read<uint8_t>(data, size, offset);
+    bool compact = version >= 14;
 
-            int intervals = ((p->sizecode - 1) >> p->linegaplog2) + 1;
-            int absoffset = (p->sizecode + 3) & ~3;
+    unsigned int stringCount = readVarInt(data, size, offset);
 
-            const int sizelineinfo = absoffset + intervals * sizeof(int);
-            p->lineinfo = luaM_newarray(L, sizelineinfo, uint8_t, p->memcat);
-            p->sizelineinfo = sizelineinfo;
+    for (unsigned int i = 0; i < stringCount; ++i)
+    {
+        unsigned int length = readVarInt(data, size, offset);
+        offset += length;
+    }
 
-            p->abslineinfo = (int*)(p->lineinfo + absoffset);
+    if (typesversion == 3)
+    {
+        while (read<uint8_t>(data, size, offset) != 0)
+            readVarInt(data, size, offset);
+    }
 
-            uint8_t lastoffset = 0;
-            for (int j = 0; j < p->sizecode; ++j)
-            {
-                lastoffset += read<uint8_t>(data, size, offset);
-                p->lineinfo[j] = lastoffset;
-            }
+    if (compact)
+    {
+        unsigned int numberCount = 0;
+        readNumberPool(data, size, offset, numberCount);
+    }
 
-            int lastline = 0;
-            for (int j = 0; j < intervals; ++j)
-            {
-                lastline += read<int32_t>(data, size, offset);
-                p->abslineinfo[j] = lastline;
-            }
+    unsigned int protoCount = readVarInt(data, size, offset);
+
+    if (protoCount > 0)
+    {
+        shared->lineinfo = (uint8_t**)(*f)(ud, NULL, 0, protoCount * (sizeof(uint8_t*) + sizeof(uint32_t)));
+        if (!shared->lineinfo)
+        {
+            luau_freesharedbytecode(shared);
+            return NULL;
         }
 
-        uint8_t debuginfo = read<uint8_t>(data, size, offset);
+        shared->lineinfosize = (uint32_t*)(shared->lineinfo + protoCount);
+        shared->protoCount = protoCount;
 
-        if (debuginfo)
+        for (unsigned int i = 0; i < protoCount; ++i)
         {
-            const int sizelocvars = readVarInt(data, size, offset);
-            p->locvars = luaM_newarray(L, sizelocvars, LocVar, p->memcat);
-            p->sizelocvars = sizelocvars;
+            shared->lineinfo[i] = NULL;
+            shared->lineinfosize[i] = 0;
+        }
+    }
 
-            for (int j = 0; j < p->sizelocvars; ++j)
-            {
-                p->locvars[j].varname = readString(strings, data, size, offset);
-                p->locvars[j].startpc = readVarInt(data, size, offset);
-                p->locvars[j].endpc = readVarInt(data, size, offset);
-                p->locvars[j].reg = read<uint8_t>(data, size, offset);
-            }
+    for (unsigned int i = 0; i < protoCount; ++i)
+    {
+        uint32_t protoSize = readVarInt(data, size, offset);
+        size_t protoStartOffset = offset;
 
-            const int sizeupvalues = readVarInt(data, size, offset);
-            LUAU_ASSERT(sizeupvalues == p->nups);
+        offset += kProtoHeaderSize;
 
-            p->upvalues = luaM_newarray(L, sizeupvalues, TString*, p->memcat);
-            p->sizeupvalues = sizeupvalues;
+        uint32_t typesize = readVarInt(data, size, offset);
+        offset += typesize;
 
-            for (int j = 0; j < p->sizeupvalues; ++j)
-            {
-                p->upvalues[j] = readString(strings, data, size, offset);
-            }
-        }
+        int sizecode = readVarInt(data, size, offset);
+        offset += sizecode * sizeof(Instruction);
+
+        int sizek = readVarInt(data, size, offset);
+        ConstantSkipper skipper;
+        for (int j = 0; j < sizek; ++j)
+            readConstant(data, size, offset, compact, skipper);
+
+        int sizep = readVarInt(data, size, offset);
+        for (int j = 0; j < sizep; ++j)
+            readVarInt(data, size, offset);
+
+        readVarInt(data, size, offset); // linedefined
+        readVarInt(data, size, offset); // debugname
 
-        if (version >= 11)
+        if (read<uint8_t>(data, size, offset))
         {
-            p->feedbackvecsize = readVarInt(data, size, offset);
+            int linegaplog2 = read<uint8_t>(data, size, offset);
 
-            if (p->feedbackvecsize > 0)
-            {
-                p->feedbackvec = luaM_newarray(L, p->feedbackvecsize, FeedbackVectorSlot, p->memcat);
-            }
-            for (uint32_t j = 0; j < p->feedbackvecsize; j++)
+            int intervals = getLineInfoIntervals(sizecode, linegaplog2);
+            int absoffset = getAbsLineInfoOffset(sizecode);
+            uint32_t lineinfosize = uint32_t(absoffset + intervals * sizeof(int));
+
+            uint8_t* lineinfo = (uint8_t*)(*f)(ud, NULL, 0, lineinfosize);
+            if (!lineinfo)
             {
-                uint8_t slottype = read<uint8_t>(data, size, offset);
-                LUAU_ASSERT(slottype == LFT_CALLTARGET);
-                FeedbackVectorSlot& slot = p->feedbackvec[j];
-                slot.kind = static_cast<FeedbackVectorSlotKind>(slottype);
-                slot.call_target.pc = readVarInt(data, size, offset);
-                slot.call_target.proto = 0;
-                slot.call_target.hits = 0;
+                luau_freesharedbytecode(shared);
+                return NULL;
             }
-        }
 
-        if (version >= 12)
-        {
-            if ((p->flags & LPF_INLINABLE) != 0)
-                p->cost = readVarInt64(data, size, offset);
-        }
+            if (compact)
+                readCompactLineInfo(data, size, offset, lineinfo, (int*)(lineinfo + absoffset), sizecode, linegaplog2, intervals);
+            else
+                readLineInfo(data, size, offset, lineinfo, (int*)(lineinfo + absoffset), sizecode, intervals);
 
-        if (version >= 12)
-        {
-            // Potantially skipping unknown data at the end of Proto.
-            offset = protoStartOffset + protoSize;
+            shared->lineinfo[i] = lineinfo;
+            shared->lineinfosize[i] = lineinfosize;
         }
 
-        protos[i] = p;
+        offset = protoStartOffset + protoSize;
     }
 
-    // "main" proto is pushed to Lua stack
-    uint32_t mainid = readVarInt(data, size, offset);
-    Proto* main = protos[mainid];
-
-    luaC_threadbarrier(L);
-
-    Closure* cl = luaF_newLclosure(L, 0, envt, main);
-    setclvalue(L, L->top, cl);
-    incr_top(L);
-
-    return 0;
+    return shared;
 }
 
-int luau_load(lua_State* L, const char* chunkname, const char* data, size_t size, int env)
+void luau_freesharedbytecode(lua_SharedBytecode* shared)
 {
-    // we will allocate a fair amount of memory so check GC before we do
-    luaC_checkGC(L);
-
-    // pause GC for the duration of deserialization - some objects we're creating aren't rooted
-    const ScopedSetGCThreshold pauseGC{L->global, SIZE_MAX};
-
-    struct LoadContext
-    {
-        TempBuffer<TString*> strings;
-        TempBuffer<Proto*> protos;
-        const char* chunkname;
-        const char* data;
-        size_t size;
-        int env;
-
-        int result;
+    lua_Alloc f = shared->frealloc;
+    void* ud = shared->ud;
 
-        static void run(lua_State* L, void* ud)
-        {
-            LoadContext* ctx = (LoadContext*)ud;
-
-            ctx->result = loadsafe(L, ctx->strings, ctx->protos, ctx->chunkname, ctx->data, ctx->size, ctx->env);
-        }
-    } ctx = {
-        {},
-        {},
-        chunkname,
-        data,
-        size,
-        env,
-    };
+    for (unsigned int i = 0; i < shared->protoCount; ++i)
+        if (shared->lineinfo[i])
+            (*f)(ud, shared->lineinfo[i], shared->lineinfosize[i], 0);
 
-    int status = luaD_rawrunprotected(L, &LoadContext::run, &ctx);
+    if (shared->lineinfo)
+        (*f)(ud, shared->lineinfo, shared->protoCount * (sizeof(uint8_t*) + sizeof(uint32_t)), 0);
 
-    // load can either succeed or get an OOM error, any other errors should be handled internally
-    LUAU_ASSERT(status == LUA_OK || status == LUA_ERRMEM);
+    if (shared->data)
+        (*f)(ud, shared->data, shared->size, 0);
 
-    if (status == LUA_ERRMEM)
-    {
-        lua_pushstring(L, LUA_MEMERRMSG); // out-of-memory error message doesn't require an allocation
-        return 1;
-    }
+    (*f)(ud, shared, sizeof(lua_SharedBytecode), 0);
+}
 
-    return ctx.result;
+int luau_loadshared(lua_State* L, const char* chunkname, const lua_SharedBytecode* shared, int env)
+{
+    return load(L, chunkname, shared->data, shared->size, env, LoadLazyMapped, shared);
 }
@@ -17,6 +17,10 @@
 #define MAXTAGLOOP 100
 
 LUAU_FASTFLAG(DebugLuauUserDefinedClassesRuntime)
+LUAU_FASTFLAGVARIABLE(LuauDirectConcat)
+
+// number of number operands a single concatenation pass can format without interning them first
+#define MAXCONCATNUMBERS 8
 
 const TValue* luaV_tonumber(const TValue* obj, TValue* n)
 {
@@ -107,6 +111,16 @@ void luaV_gettable(lua_State* L, const TValue* t, TValue* key, StkId val)
         { // `t' is a table?
             LuaTable* h = hvalue(t);
 
+            // elements of the typed array part are never nil, so they don't need to check the metatable
+            if (hastypedarray(h))
+            {
+                if (const double* slot = luaH_gettyped(h, key))
+                {
+                    setnvalue(val, *slot);
+                    return;
+                }
+            }
+
             const TValue* res = luaH_get(h, key); // do a primitive get
 
             if (res != luaO_nilobject)
@@ -188,6 +202,16 @@ void luaV_settable(lua_State* L, const TValue* t, TValue* key, StkId val)
         { // `t' is a table?
             LuaTable* h = hvalue(t);
 
+            // numbers are stored into the typed array part in place, other values generalize the table and take the regular path
+            if (hastypedarray(h) && (luaH_gettyped(h, key) || fasttm(L, h->metatable, TM_NEWINDEX) == NULL))
+            {
+                if (h->readonly)
+                    luaG_readonlyerror(L);
+
+                if (luaH_settyped(L, h, key, val))
+                    return;
+            }
+
             const TValue* oldval = luaH_get(h, key);
 
             // should we assign the key? (if key is valid or __newindex is not set)
@@ -394,13 +418,101 @@ int luaV_equalval(lua_State* L, const TValue* t1, const TValue* t2)
     return !l_isfalse(L->top);
 }
 
+// concatenates as many string or number operands ending at top - 1 as possible into a single string stored at the first of them
+// numbers are formatted straight into the result instead of being converted to temporary interned strings
+static int concatvalues(lua_State* L, StkId top, int total)
+{
+    char numbuf[MAXCONCATNUMBERS][LUAI_MAXNUM2STR];
+    size_t numlen[MAXCONCATNUMBERS];
+    int numcount = 0;
+
+    size_t tl = 0;
+    int n = 0;
+
+    // collect total length; the pass stops early when out of number slots and the rest is handled by the next one
+    for (; n < total; n++)
+    {
+        StkId o = top - n - 1;
+        size_t l;
+
+        if (ttisstring(o))
+        {
+            l = tsvalue(o)->len;
+        }
+        else if (ttisnumber(o) && numcount < MAXCONCATNUMBERS)
+        {
+            char* e = luai_num2str(numbuf[numcount], nvalue(o));
+            LUAU_ASSERT(e < numbuf[numcount] + LUAI_MAXNUM2STR);
+            l = numlen[numcount] = e - numbuf[numcount];
+            numcount++;
+        }
+        else
+        {
+            break;
+        }
+
+        if (l > MAXSSIZE - tl)
+            luaG_runerror(L, "string length overflow");
+        tl += l;
+    }
+
+    LUAU_ASSERT(n >= 2);
+
+    char buf[LUA_BUFFERSIZE];
+    TString* ts = nullptr;
+    char* buffer = buf;
+
+    if (tl >= LUA_BUFFERSIZE)
+    {
+        ts = luaS_bufstart(L, tl);
+        buffer = ts->data;
+    }
+
+    // operands were collected from the top, so formatted numbers are consumed in reverse
+    size_t pos = 0;
+    for (int i = n; i > 0; i--)
+    {
+        StkId o = top - i;
+
+        if (ttisstring(o))
+        {
+            size_t l = tsvalue(o)->len;
+            memcpy(buffer + pos, svalue(o), l);
+            pos += l;
+        }
+        else
+        {
+            numcount--;
+            memcpy(buffer + pos, numbuf[numcount], numlen[numcount]);
+            pos += numlen[numcount];
+        }
+    }
+
+    LUAU_ASSERT(pos == tl && numcount == 0);
+
+    if (ts)
+    {
+        setsvalue(L, top - n, luaS_buffinish(L, ts));
+    }
+    else
+    {
+        setsvalue(L, top - n, luaS_newlstr(L, buffer, tl));
+    }
+
+    return n;
+}
+
 void luaV_concat(lua_State* L, int total, int last)
 {
     do
     {
         StkId top = L->base + last + 1;
         int n = 2; // number of elements handled in this pass (at least 2)
-        if (!(ttisstring(top - 2) || ttisnumber(top - 2)) || !tostring(L, top - 1))
+        if (FFlag::LuauDirectConcat && (ttisstring(top - 2) || ttisnumber(top - 2)) && (ttisstring(top - 1) || ttisnumber(top - 1)))
+        {
+            n = concatvalues(L, top, total);
+        }
+        else if (!(ttisstring(top - 2) || ttisnumber(top - 2)) || !tostring(L, top - 1))
         {
             if (!call_binTM(L, top - 2, top - 1, top - 2, TM_CONCAT))
                 luaG_concaterror(L, top - 2, top - 1);
@@ -457,6 +569,129 @@ void luaV_concat(lua_State* L, int total, int last)
     } while (total > 1); // repeat until only 1 result left
 }
 
+// string buffer accumulation keeps the value in two registers starting from buf: when the second one is nil, the value is still in the target
+// register; when it's a number, the first one holds the buffer storage and the number is the count of bytes used; otherwise the first one holds
+// the value
+static TString* finishconcatbuffer(lua_State* L, StkId buf)
+{
+    TString* storage = tsvalue(buf);
+    size_t used = size_t(nvalue(buf + 1));
+
+    // if the buffer is full, the storage can be converted to a string without a copy
+    return used == storage->len ? luaS_buffinish(L, storage) : luaS_newlstr(L, storage->data, used);
+}
+
+// appends values between first + 1 and last to the value of register a accumulated at register buf
+// values that can't be buffered are concatenated with the accumulated value as usual, using first as a scratch register
+void luaV_concatappend(lua_State* L, int a, int first, int last, int buf)
+{
+    StkId rbuf = L->base + buf;
+    StkId current = ttisnil(rbuf + 1) ? L->base + a : rbuf;
+
+    bool active = ttisnumber(rbuf + 1);
+    bool buffered = active || ttisstring(current);
+    size_t used = active ? size_t(nvalue(rbuf + 1)) : ttisstring(current) ? tsvalue(current)->len : 0;
+
+    // upper bound of the appended length, numbers are formatted straight into the buffer
+    size_t extra = 0;
+
+    for (StkId o = L->base + first + 1; buffered && o <= L->base + last; o++)
+    {
+        if (ttisstring(o))
+            extra += tsvalue(o)->len;
+        else if (ttisnumber(o))
+            extra += LUAI_MAXNUM2STR;
+        else
+            buffered = false;
+    }
+
+    // short strings are cheaper to concatenate directly, and length overflow is reported by the regular path
+    if (buffered && (extra > MAXSSIZE - used || (!active && used + extra < LUA_BUFFERSIZE)))
+        buffered = false;
+
+    if (!buffered)
+    {
+        if (active)
+        {
+            setsvalue(L, L->base + first, finishconcatbuffer(L, rbuf));
+        }
+        else
+        {
+            setobj2s(L, L->base + first, current);
+        }
+
+        // this call may realloc the stack, so registers are addressed through base again
+        luaV_concat(L, last - first + 1, last);
+
+        setobj2s(L, L->base + buf, L->base + first);
+        setbvalue(L->base + buf + 1, true);
+        return;
+    }
+
+    TString* storage = active ? tsvalue(rbuf) : NULL;
+
+    if (!storage || used + extra > storage->len)
+    {
+        size_t capacity = storage ? storage->len : 0;
+        size_t nextsize = capacity + capacity / 2;
+
+        if (nextsize < used + extra)
+            nextsize = used + extra;
+
+        if (nextsize > MAXSSIZE)
+            nextsize = MAXSSIZE;
+
+        TString* newStorage = luaS_bufstart(L, nextsize);
+        memcpy(newStorage->data, storage ? storage->data : svalue(current), used);
+
+        setsvalue(L, rbuf, newStorage);
+        storage = newStorage;
+    }
+
+    char* data = storage->data;
+
+    for (StkId o = L->base + first + 1; o <= L->base + last; o++)
+    {
+        if (ttisstring(o))
+        {
+            size_t l = tsvalue(o)->len;
+            memcpy(data + used, svalue(o), l);
+            used += l;
+        }
+        else
+        {
+            char* e = luai_num2str(data + used, nvalue(o));
+            used = e - data;
+        }
+    }
+
+    LUAU_ASSERT(used <= storage->len);
+    setnvalue(rbuf + 1, double(used));
+}
+
+// stores the value accumulated at register buf into register a and resets the accumulation
+void luaV_concatflush(lua_State* L, int a, int buf)
+{
+    StkId rbuf = L->base + buf;
+
+    // nothing was appended, target register holds the value
+    if (ttisnil(rbuf + 1))
+        return;
+
+    if (ttisnumber(rbuf + 1))
+    {
+        setsvalue(L, L->base + a, finishconcatbuffer(L, rbuf));
+    }
+    else
+    {
+        setobj2s(L, L->base + a, rbuf);
+    }
+
+    // buffer storage can be large, so it shouldn't be kept alive by the register
+    setnilvalue(rbuf);
+    setnilvalue(rbuf + 1);
+}
+
 template<TMS op>
 void luaV_doarithimpl(lua_State* L, StkId ra, const TValue* rb, const TValue* rc)
 {
@@ -0,0 +1,41 @@
+local function prequire(name) local success, result = pcall(require, name); return success and result end
+local bench = script and require(script.Parent.bench_support) or prequire("bench_support") or require("../bench_support")
+
+local records = {}
+for i=1,1000 do
+    records[i] = {
+        id = i,
+        name = "user" .. i,
+        email = "user" .. i .. "@example.com",
+        score = i * 1.25,
+        active = i % 3 == 0,
+        tags = {"alpha", "beta", "gamma"},
+        note = "line one\nline \"two\"",
+    }
+end
+
+local text = json.encode(records)
+
+bench.runCode(function()
+    local n = 0
+    for i=1,50 do
+        n += #json.encode(records)
+    end
+    assert(n == #text * 50)
+end, "json: encode records")
+
+bench.runCode(function()
+    local n = 0
+    for i=1,50 do
+        n += #json.decode(text)
+    end
+    assert(n == 50000)
+end, "json: decode records")
+
+bench.runCode(function()
+    local n = 0
+    for i=1,50 do
+        n += buffer.len(json.encodebuffer(records))
+    end
+    assert(n == #text * 50)
+end, "json: encode records into buffer")
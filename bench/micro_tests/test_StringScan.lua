@@ -0,0 +1,47 @@
+local function prequire(name) local success, result = pcall(require, name); return success and result end
+local bench = script and require(script.Parent.bench_support) or prequire("bench_support") or require("../bench_support")
+
+local text = string.rep("GET /index.html HTTP/1.1\r\nHost: example.com\r\nAccept: */*\r\n", 200)
+
+bench.runCode(function()
+    local n = 0
+    for i=1,2000 do
+        n += string.find(text, "Content-Length:", 1, true) or 0
+        n += string.find(text, "example.org", 1, true) or 0
+    end
+    assert(n == 0)
+end, "string: find plain (miss)")
+
+bench.runCode(function()
+    local n = 0
+    for i=1,2000 do
+        n += string.find(text, "\r\n\r\n") or 0
+    end
+    assert(n == 0)
+end, "string: find without specials")
+
+bench.runCode(function()
+    local str = ""
+    for i=1,2000 do
+        str = string.upper(text)
+        str = string.lower(str)
+    end
+    assert(#str == #text)
+end, "string: upper/lower")
+
+bench.runCode(function()
+    local n = 0
+    for i=1,500 do
+        n += #string.split(text, "\r\n")
+        n += #string.split(text, " ")
+    end
+    assert(n > 0)
+end, "string: split")
+
+bench.runCode(function()
+    local str = ""
+    for i=1,10000 do
+        str = string.rep("-", 1000)
+    end
+    assert(#str == 1000)
+end, "string: rep (fill)")
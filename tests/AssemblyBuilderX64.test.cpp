@@ -508,6 +508,11 @@ TEST_CASE_FIXTURE(AssemblyBuilderX64Fixture, "AVXBinaryInstructionForms")
     SINGLE_COMPARE(vmulps(xmm8, xmm10, xmm14), 0xc4, 0x41, 0x28, 0x59, 0xc6);
     SINGLE_COMPARE(vdivps(xmm8, xmm10, xmm14), 0xc4, 0x41, 0x28, 0x5e, 0xc6);
 
+    SINGLE_COMPARE(vsubpd(xmm8, xmm10, xmm14), 0xc4, 0x41, 0x29, 0x5c, 0xc6);
+    SINGLE_COMPARE(vmulpd(xmm8, xmm10, xmm14), 0xc4, 0x41, 0x29, 0x59, 0xc6);
+    SINGLE_COMPARE(vmulpd(ymm8, ymm10, ymmword[r9]), 0xc4, 0x41, 0x2d, 0x59, 0x01);
+    SINGLE_COMPARE(vdivpd(xmm8, xmm10, xmm14), 0xc4, 0x41, 0x29, 0x5e, 0xc6);
+
     SINGLE_COMPARE(vorpd(xmm8, xmm10, xmm14), 0xc4, 0x41, 0x29, 0x56, 0xc6);
     SINGLE_COMPARE(vxorpd(xmm8, xmm10, xmm14), 0xc4, 0x41, 0x29, 0x57, 0xc6);
     SINGLE_COMPARE(vorps(xmm8, xmm10, xmm14), 0xc4, 0x41, 0x28, 0x56, 0xc6);
@@ -524,6 +529,9 @@ TEST_CASE_FIXTURE(AssemblyBuilderX64Fixture, "AVXBinaryInstructionForms")
     SINGLE_COMPARE(vmaxps(xmm8, xmm10, xmm14), 0xc4, 0x41, 0x28, 0x5f, 0xc6);
     SINGLE_COMPARE(vminps(xmm8, xmm10, xmm14), 0xc4, 0x41, 0x28, 0x5d, 0xc6);
 
+    SINGLE_COMPARE(vmaxpd(xmm8, xmm10, xmm14), 0xc4, 0x41, 0x29, 0x5f, 0xc6);
+    SINGLE_COMPARE(vminpd(xmm8, xmm10, xmm14), 0xc4, 0x41, 0x29, 0x5d, 0xc6);
+
     SINGLE_COMPARE(vcmpeqsd(xmm8, xmm10, xmm14), 0xc4, 0x41, 0x2b, 0xc2, 0xc6, 0x00);
     SINGLE_COMPARE(vcmpltsd(xmm8, xmm10, xmm14), 0xc4, 0x41, 0x2b, 0xc2, 0xc6, 0x01);
 }
@@ -585,6 +593,13 @@ TEST_CASE_FIXTURE(AssemblyBuilderX64Fixture, "AVXConversionInstructionForms")
     SINGLE_COMPARE(vcvtsd2ss(xmm6, xmm11, qword[rcx + rdx]), 0xc4, 0xe1, 0xa3, 0x5a, 0x34, 0x11);
     SINGLE_COMPARE(vcvtss2sd(xmm3, xmm8, xmm12), 0xc4, 0xc1, 0x3a, 0x5a, 0xdc);
     SINGLE_COMPARE(vcvtss2sd(xmm4, xmm9, dword[rcx + rsi]), 0xc4, 0xe1, 0x32, 0x5a, 0x24, 0x31);
+    SINGLE_COMPARE(vcvtps2pd(xmm8, xmm10), 0xc4, 0x41, 0x78, 0x5a, 0xc2);
+    SINGLE_COMPARE(vcvtps2pd(ymm8, xmm10), 0xc4, 0x41, 0x7c, 0x5a, 0xc2);
+    SINGLE_COMPARE(vcvtps2pd(ymm8, xmmword[r9]), 0xc4, 0x41, 0x7c, 0x5a, 0x01);
+    SINGLE_COMPARE(vcvtpd2ps(xmm8, xmm10), 0xc4, 0x41, 0x79, 0x5a, 0xc2);
+    SINGLE_COMPARE(vcvtpd2ps(xmm8, ymm10), 0xc4, 0x41, 0x7d, 0x5a, 0xc2);
+    SINGLE_COMPARE(vcvtpd2ps(xmm8, ymmword[r9]), 0xc4, 0x41, 0x7d, 0x5a, 0x01);
+    SINGLE_COMPARE(vcvtpd2ps(xmm8, xmmword[r9]), 0xc4, 0x41, 0x79, 0x5a, 0x01);
 }
 
 TEST_CASE_FIXTURE(AssemblyBuilderX64Fixture, "AVXTernaryInstructionForms")
@@ -17,6 +17,7 @@
 #include <string.h>
 
 LUAU_FASTFLAG(LuauCodegenProtectData)
+LUAU_FASTFLAG(LuauCodegenReclaimCode)
 
 using namespace Luau::CodeGen;
 
@@ -279,6 +280,151 @@ TEST_CASE("CodeAllocationProtectDataWithUnwindCallbacks")
     CHECK(info.destroyCalled);
 }
 
+TEST_CASE("CodeAllocationReuseFreedRanges")
+{
+    ScopedFastFlag luauCodegenReclaimCode{FFlag::LuauCodegenReclaimCode, true};
+
+    size_t blockSize = 1024 * 1024;
+    size_t maxTotalSize = 1024 * 1024;
+    CodeAllocator allocator(blockSize, maxTotalSize);
+
+    std::vector<uint8_t> code(300 * 1024);
+
+    CodeAllocationData result1 = allocator.allocate(nullptr, 0, code.data(), code.size());
+    CodeAllocationData result2 = allocator.allocate(nullptr, 0, code.data(), code.size());
+    CodeAllocationData result3 = allocator.allocate(nullptr, 0, code.data(), code.size());
+    REQUIRE(result1.start);
+    REQUIRE(result2.start);
+    REQUIRE(result3.start);
+
+    // block is full
+    CodeAllocationData result4 = allocator.allocate(nullptr, 0, code.data(), code.size());
+    CHECK(!result4.start);
+
+    // freed range in the middle of the block is reused
+    allocator.deallocate(result2);
+
+    CodeAllocatorStats stats = allocator.getStats();
+    CHECK(stats.blockCount == 1);
+    CHECK(stats.liveAllocations == 2);
+    CHECK(stats.usedBytes == result1.allocationSize + result3.allocationSize);
+    CHECK(stats.largestFreeRange >= result2.allocationSize);
+
+    result4 = allocator.allocate(nullptr, 0, code.data(), code.size());
+    REQUIRE(result4.start);
+    CHECK(result4.allocationStart == result2.allocationStart);
+
+    // adjacent freed ranges are coalesced
+    code.resize(400 * 1024);
+
+    allocator.deallocate(result3);
+    allocator.deallocate(result4);
+
+    stats = allocator.getStats();
+    CHECK(stats.liveAllocations == 1);
+    CHECK(stats.freeBytes == blockSize - result1.allocationSize);
+    CHECK(stats.freeRangeCount == 1);
+    CHECK(stats.largestFreeRange == stats.freeBytes);
+
+    CodeAllocationData result5 = allocator.allocate(nullptr, 0, code.data(), code.size());
+    REQUIRE(result5.start);
+    CHECK(result5.allocationStart == result2.allocationStart);
+
+    // once the block is empty, it can hold an allocation of any size again
+    allocator.deallocate(result1);
+    allocator.deallocate(result5);
+
+    code.resize(blockSize / 2 + 64 * 1024);
+
+    CodeAllocationData result6 = allocator.allocate(nullptr, 0, code.data(), code.size());
+    REQUIRE(result6.start);
+    CHECK(result6.allocationStart == result1.allocationStart);
+
+    allocator.deallocate(result6);
+
+    stats = allocator.getStats();
+    CHECK(stats.liveAllocations == 0);
+    CHECK(stats.usedBytes == 0);
+    CHECK(stats.freeBytes == blockSize);
+}
+
+TEST_CASE("CodeAllocationReleaseEmptyBlocks")
+{
+    ScopedFastFlag luauCodegenReclaimCode{FFlag::LuauCodegenReclaimCode, true};
+
+    struct Info
+    {
+        size_t createCount = 0;
+        size_t destroyCount = 0;
+        size_t bytesFreed = 0;
+    };
+    Info info;
+
+    const auto allocationCallback = [](void* context, void* oldPointer, size_t oldSize, void* newPointer, size_t newSize)
+    {
+        if (oldPointer != nullptr)
+            static_cast<Info*>(context)->bytesFreed += oldSize;
+    };
+
+    size_t blockSize = 1024 * 1024;
+    size_t maxTotalSize = 2 * 1024 * 1024;
+
+    {
+        CodeAllocator allocator(blockSize, maxTotalSize, allocationCallback, &info);
+
+        allocator.context = &info;
+        allocator.createBlockUnwindInfo = [](void* context, uint8_t* block, size_t blockSize, size_t& beginOffset) -> void*
+        {
+            Info& info = *(Info*)context;
+
+            beginOffset = 8;
+            info.createCount++;
+
+            return new int(7);
+        };
+        allocator.destroyBlockUnwindInfo = [](void* context, void* unwindData)
+        {
+            Info& info = *(Info*)context;
+
+            info.destroyCount++;
+
+            CHECK(*(int*)unwindData == 7);
+            delete (int*)unwindData;
+        };
+
+        std::vector<uint8_t> code(600 * 1024);
+
+        CodeAllocationData result1 = allocator.allocate(nullptr, 0, code.data(), code.size());
+        CodeAllocationData result2 = allocator.allocate(nullptr, 0, code.data(), code.size());
+        REQUIRE(result1.start);
+        REQUIRE(result2.start);
+        CHECK(info.createCount == 2);
+
+        // limit is reached
+        CodeAllocationData result3 = allocator.allocate(nullptr, 0, code.data(), code.size());
+        CHECK(!result3.start);
+
+        // first block is not used for new allocations, so it's released together with its unwind information
+        allocator.deallocate(result1);
+        CHECK(info.destroyCount == 1);
+        CHECK(info.bytesFreed == blockSize);
+        CHECK(allocator.getStats().blockCount == 1);
+
+        result3 = allocator.allocate(nullptr, 0, code.data(), code.size());
+        REQUIRE(result3.start);
+        CHECK(info.createCount == 3);
+
+        // unwind information at the start of the reused range is preserved
+        CHECK(result3.start == result3.allocationStart + kCodeAlignment);
+
+        allocator.deallocate(result2);
+        allocator.deallocate(result3);
+    }
+
+    CHECK(info.destroyCount == 3);
+    CHECK(info.bytesFreed == 3 * blockSize);
+}
+
 #if !defined(LUAU_BIG_ENDIAN)
 TEST_CASE("WindowsUnwindCodesX64")
 {
@@ -22,16 +22,25 @@ LUAU_FASTINT(LuauCompileInlineThreshold)
 LUAU_FASTINT(LuauCompileInlineThresholdMaxBoost)
 LUAU_FASTINT(LuauCompileLoopUnrollThreshold)
 LUAU_FASTINT(LuauCompileLoopUnrollThresholdMaxBoost)
+LUAU_FASTINT(LuauCompileLoopUnrollFactor)
 LUAU_FASTINT(LuauRecursionLimit)
 LUAU_FASTFLAG(LuauIntegerType2)
 LUAU_FASTFLAG(LuauIntegerFastcalls)
 LUAU_FASTFLAG(LuauIntegerBufferFastcalls)
+LUAU_FASTFLAG(LuauBufferBulkFastcalls)
 LUAU_FASTFLAG(LuauCompileStringInterpTargetTop)
 LUAU_FASTFLAG(LuauExportValueSyntax)
 LUAU_FASTFLAG(DebugLuauNoInline)
 LUAU_FASTFLAG(LuauEmitCallFeedback)
 LUAU_FASTFLAG(LuauCompileNewTableMutationTracker)
 LUAU_FASTFLAG(LuauCompileInlineTableFunctions)
+LUAU_FASTFLAG(LuauCompileFoldVectorLib)
+LUAU_FASTFLAG(LuauCompileScalarTables)
+LUAU_FASTFLAG(LuauCompileInlineLibraryFunctions)
+LUAU_FASTFLAG(LuauCompilePartialLoopUnroll)
+LUAU_FASTFLAG(LuauCompileFoldMoves)
+LUAU_FASTFLAG(LuauCompileMove2)
+LUAU_FASTFLAG(LuauCompileConcatBuffer)
 
 using namespace Luau;
 
@@ -500,6 +509,170 @@ RETURN R3 1
 )");
 }
 
+TEST_CASE("ConcatBufferLoops")
+{
+    ScopedFastFlag luauCompileConcatBuffer{FFlag::LuauCompileConcatBuffer, true};
+    ScopedFastFlag luauCompileMove2{FFlag::LuauCompileMove2, false};
+
+    // appended values are accumulated in a pair of registers allocated before the loop
+    CHECK_EQ(
+        "\n" + compileFunction(
+                   R"(
+local t = ...
+local s = ""
+for _, v in t do
+    s = s .. v .. ","
+end
+return s
+)",
+                   0,
+                   2
+               ),
+        R"(
+GETVARARGS R0 1
+LOADK R1 K0 ['']
+LOADNIL R2
+LOADNIL R3
+MOVE R4 R0
+LOADNIL R5
+LOADNIL R6
+FORGPREP R4 L1
+L0: MOVE R10 R8
+LOADK R11 K1 [',']
+CONCATAPPEND R1 R9 R11 R2
+L1: FORGLOOP R4 L0 2
+CONCATFLUSH R1 R2
+RETURN R1 1
+)"
+    );
+
+    // compound assignments and loop exits that skip the rest of the body
+    CHECK_EQ(
+        "\n" + compileFunction(
+                   R"(
+local t = ...
+local s, n = "", 0
+while n < #t do
+    n += 1
+    if t[n] == "" then break end
+    s ..= t[n]
+end
+return s
+)",
+                   0,
+                   2
+               ),
+        R"(
+GETVARARGS R0 1
+LOADK R1 K0 ['']
+LOADN R2 0
+LOADNIL R3
+LOADNIL R4
+L0: LENGTH R5 R0
+JUMPIFNOTLT R2 R5 L1
+ADDK R2 R2 K1 [1]
+GETTABLE R5 R0 R2
+JUMPXEQKS R5 K0 L1 ['']
+GETTABLE R6 R0 R2
+CONCATAPPEND R1 R5 R6 R3
+JUMPBACK L0
+L1: CONCATFLUSH R1 R3
+RETURN R1 1
+)"
+    );
+
+    // locals that are prepended to, read in the loop or captured use regular concatenation
+    CHECK_EQ(
+        "\n" + compileFunction(
+                   R"(
+local t = ...
+local a, b, c = "", "", ""
+for _, v in t do
+    a ..= v
+    b = v .. b
+    c ..= #c
+    local f = function() return a end
+end
+return a, b, c
+)",
+                   1,
+                   2
+               ),
+        R"(
+GETVARARGS R0 1
+LOADK R1 K0 ['']
+LOADK R2 K0 ['']
+LOADK R3 K0 ['']
+MOVE R4 R0
+LOADNIL R5
+LOADNIL R6
+FORGPREP R4 L1
+L0: MOVE R9 R1
+MOVE R10 R8
+CONCAT R1 R9 R10
+MOVE R9 R8
+MOVE R10 R2
+CONCAT R2 R9 R10
+MOVE R9 R3
+LENGTH R10 R3
+CONCAT R3 R9 R10
+NEWCLOSURE R9 P0
+CAPTURE REF R1
+L1: FORGLOOP R4 L0 2
+CLOSEUPVALS R1
+RETURN R1 3
+)"
+    );
+
+    // nested loops buffer the locals that are declared before each of them
+    CHECK_EQ(
+        "\n" + compileFunction(
+                   R"(
+local t = ...
+local s = ""
+for _, v in t do
+    local inner = ""
+    for _, w in v do
+        s = s .. w
+        inner ..= w
+    end
+    t[1] = inner
+end
+return s
+)",
+                   0,
+                   2
+               ),
+        R"(
+GETVARARGS R0 1
+LOADK R1 K0 ['']
+LOADNIL R2
+LOADNIL R3
+MOVE R4 R0
+LOADNIL R5
+LOADNIL R6
+FORGPREP R4 L3
+L0: LOADK R9 K0 ['']
+LOADNIL R10
+LOADNIL R11
+MOVE R12 R8
+LOADNIL R13
+LOADNIL R14
+FORGPREP R12 L2
+L1: MOVE R18 R16
+CONCATAPPEND R1 R17 R18 R2
+MOVE R18 R16
+CONCATAPPEND R9 R17 R18 R10
+L2: FORGLOOP R12 L1 2
+CONCATFLUSH R9 R10
+SETTABLEN R9 R0 1
+L3: FORGLOOP R4 L0 2
+CONCATFLUSH R1 R2
+RETURN R1 1
+)"
+    );
+}
+
 TEST_CASE("RepeatLocals")
 {
     CHECK_EQ("\n" + compileFunction0("repeat local a a = 5 until a - 4 < 0 or a - 4 >= 0"), R"(
@@ -1697,6 +1870,9 @@ RETURN R0 1
 
 TEST_CASE("ConstantFoldVectorArith")
 {
+    // redundant loads are kept in this test
+    ScopedFastFlag luauCompileFoldMoves{FFlag::LuauCompileFoldMoves, false};
+
     CHECK_EQ("\n" + compileFunction("local n = 2; local a, b = vector.create(1, 2, 3), vector.create(2, 4, 8); return a + b", 0, 2), R"(
 LOADK R0 K0 [3, 6, 11]
 RETURN R0 1
@@ -3929,6 +4105,9 @@ RETURN R4 1
 
 TEST_CASE("CostModelRemarks")
 {
+    // loops that can't be fully unrolled are kept as is in this test
+    ScopedFastFlag luauCompilePartialLoopUnroll{FFlag::LuauCompilePartialLoopUnroll, false};
+
     CHECK_EQ(
         compileWithRemarks(R"(
 local a, b = ...
@@ -5985,6 +6164,9 @@ RETURN R0 0
 
 TEST_CASE("LoopUnrollNested")
 {
+    // redundant loads are kept in this test
+    ScopedFastFlag luauCompileFoldMoves{FFlag::LuauCompileFoldMoves, false};
+
     // we can unroll nested loops just fine
     CHECK_EQ(
         "\n" + compileFunction(
@@ -6328,6 +6510,9 @@ RETURN R0 0
 
 TEST_CASE("LoopUnrollCost")
 {
+    // loops that can't be fully unrolled are kept as is in this test
+    ScopedFastFlag luauCompilePartialLoopUnroll{FFlag::LuauCompilePartialLoopUnroll, false};
+
     ScopedFastInt sfis[] = {
         {FInt::LuauCompileLoopUnrollThreshold, 25},
         {FInt::LuauCompileLoopUnrollThresholdMaxBoost, 300},
@@ -6529,6 +6714,134 @@ L1: RETURN R0 0
     );
 }
 
+TEST_CASE("LoopUnrollPartial")
+{
+    // register moves are not fused in this test
+    ScopedFastFlag luauCompileMove2{FFlag::LuauCompileMove2, false};
+
+    ScopedFastFlag luauCompilePartialLoopUnroll{FFlag::LuauCompilePartialLoopUnroll, true};
+
+    // loops with a runtime limit are unrolled into a loop over several iterations at once, followed by a loop over the remainder
+    CHECK_EQ(
+        "\n" + compileFunction(
+                   R"(
+local t, n = ...
+local s = 0
+for i = 1, n do
+    s += t[i]
+end
+return s
+)",
+                   0,
+                   2
+               ),
+        R"(
+GETVARARGS R0 2
+LOADN R2 0
+LOADN R5 1
+MOVE R3 R1
+LOADN R4 1
+FORNPREP R3 L3
+MOVE R8 R5
+SUBK R6 R3 K0 [3]
+LOADN R7 4
+FORNPREP R6 L1
+L0: GETTABLE R9 R0 R8
+ADD R2 R2 R9
+ADDK R9 R8 K1 [1]
+GETTABLE R10 R0 R9
+ADD R2 R2 R10
+ADDK R9 R8 K2 [2]
+GETTABLE R10 R0 R9
+ADD R2 R2 R10
+ADDK R9 R8 K0 [3]
+GETTABLE R10 R0 R9
+ADD R2 R2 R10
+FORNLOOP R6 L0
+L1: MOVE R5 R8
+JUMPIFLT R3 R5 L3
+L2: GETTABLE R9 R0 R5
+ADD R2 R2 R9
+FORNLOOP R3 L2
+L3: RETURN R2 1
+)"
+    );
+
+    // loops with a runtime step are kept as is
+    CHECK_EQ(
+        "\n" + compileFunction(
+                   R"(
+local t, n, k = ...
+local s = 0
+for i = 1, n, k do
+    s += t[i]
+end
+return s
+)",
+                   0,
+                   2
+               ),
+        R"(
+GETVARARGS R0 3
+LOADN R3 0
+LOADN R6 1
+MOVE R4 R1
+MOVE R5 R2
+FORNPREP R4 L1
+L0: GETTABLE R7 R0 R6
+ADD R3 R3 R7
+FORNLOOP R4 L0
+L1: RETURN R3 1
+)"
+    );
+}
+
+TEST_CASE("LoopUnrollPartialLimits")
+{
+    ScopedFastFlag luauCompilePartialLoopUnroll{FFlag::LuauCompilePartialLoopUnroll, true};
+    ScopedFastInt sfis[] = {
+        {FInt::LuauCompileLoopUnrollThreshold, 10000},
+        {FInt::LuauCompileLoopUnrollFactor, 64},
+    };
+
+    // the step of the unrolled loop has to fit into LOADN, which limits the factor to 31 for a step of 1024
+    std::string large = compileFunction(
+        R"(
+local n = ...
+local s = 0
+for i = 1, n, 1024 do
+    s += i
+end
+return s
+)",
+        0,
+        2
+    );
+
+    CHECK(large.find(" 31744\n") != std::string::npos);
+    CHECK(large.find(" 32768\n") == std::string::npos);
+
+    // the unrolled loop needs new constants for its index offsets, so the loop is kept as is when they wouldn't fit
+    std::string source = "local t, n = ...\n";
+    for (int i = 0; i < 254; ++i)
+        source += "t[1] = " + std::to_string(i) + ".5\n";
+    source += "local s = 0\nfor i = 1, n do\n    s += t[i]\nend\nreturn s\n";
+
+    std::string remarks = compileWithRemarks(source.c_str());
+    CHECK(remarks.find("partial loop unroll failed: too many constants") != std::string::npos);
+
+    // constants added by the loop body don't take the place of the index offsets
+    ScopedFastInt sfi{FInt::LuauCompileLoopUnrollFactor, 4};
+
+    std::string body = "local t, n = ...\n";
+    for (int i = 0; i < 126; ++i)
+        body += "t.k" + std::to_string(i) + " = " + std::to_string(i) + ".5\n";
+    body += "for i = 1, n do\n    t[i] = i * 1.25 + 7.75 - 3.125\nend\n";
+
+    std::string bodyRemarks = compileWithRemarks(body.c_str());
+    CHECK(bodyRemarks.find("partial loop unroll succeeded") != std::string::npos);
+}
+
 TEST_CASE("LoopUnrollCostBuiltins")
 {
     ScopedFastInt sfis[] = {
@@ -7168,6 +7481,9 @@ RETURN R1 1
 
 TEST_CASE("InlineCapture")
 {
+    // register moves are not fused in this test
+    ScopedFastFlag luauCompileMove2{FFlag::LuauCompileMove2, false};
+
     // if the argument is captured by a nested closure, normally we can rely on capture by value
     CHECK_EQ(
         "\n" + compileFunction(
@@ -8105,6 +8421,9 @@ RETURN R1 1
 
 TEST_CASE("InlineNonConstInitializers")
 {
+    // register moves are not fused in this test
+    ScopedFastFlag luauCompileMove2{FFlag::LuauCompileMove2, false};
+
     ScopedFastFlag emitCallFb{FFlag::LuauEmitCallFeedback, true};
 
     CHECK_EQ(
@@ -8712,6 +9031,8 @@ TEST_CASE("InlineTableFunction")
 {
     ScopedFastFlag luauCompileNewTableMutationTracker{FFlag::LuauCompileNewTableMutationTracker, true};
     ScopedFastFlag luauCompileInlineTableFunctions{FFlag::LuauCompileInlineTableFunctions, true};
+    // tables in these tests would otherwise be replaced with their fields
+    ScopedFastFlag luauCompileScalarTables{FFlag::LuauCompileScalarTables, false};
 
     CHECK_EQ(
         "\n" + compileFunction(
@@ -9313,6 +9634,119 @@ RETURN R0 59
     );
 }
 
+TEST_CASE("BuiltinFoldingVector")
+{
+    ScopedFastFlag luauCompileFoldVectorLib{FFlag::LuauCompileFoldVectorLib, true};
+
+    CHECK_EQ(
+        "\n" + compileFunction(
+                   R"(
+return
+    vector.magnitude(vector.create(3, 4, 0)),
+    vector.normalize(vector.create(0, 3, 4)),
+    vector.cross(vector.create(1, 0, 0), vector.create(0, 1, 0)),
+    vector.dot(vector.create(1, 2, 3), vector.create(4, 5, 6)),
+    vector.floor(vector.create(1.5, -1.5, 2)),
+    vector.ceil(vector.create(1.5, -1.5, 2)),
+    vector.abs(vector.create(-1, 2, -3)),
+    vector.sign(vector.create(-5, 0, 5)),
+    vector.clamp(vector.create(-2, 0.5, 2), vector.create(-1, -1, -1), vector.create(1, 1, 1)),
+    vector.min(vector.create(1, 5, 3), vector.create(4, 2, 6), vector.create(7, 8, 0)),
+    vector.max(vector.create(1, 5, 3), vector.create(4, 2, 6)),
+    vector.lerp(vector.create(0, 2, 4), vector.create(2, 4, 8), 0.5)
+)",
+                   0,
+                   2
+               ),
+        R"(
+LOADN R0 5
+LOADK R1 K0 [0, 0.600000024, 0.800000012]
+LOADK R2 K1 [0, 0, 1]
+LOADN R3 32
+LOADK R4 K2 [1, -2, 2]
+LOADK R5 K3 [2, -1, 2]
+LOADK R6 K4 [1, 2, 3]
+LOADK R7 K5 [-1, 0, 1]
+LOADK R8 K6 [-1, 0.5, 1]
+LOADK R9 K7 [1, 2, 0]
+LOADK R10 K8 [4, 5, 6]
+LOADK R11 K9 [1, 3, 6]
+RETURN R0 12
+)"
+    );
+
+    // W component is folded for vectors that use it
+    CHECK_EQ(
+        "\n" + compileFunction(
+                   R"(
+return
+    vector.floor(vector.create(1.5, -1.5, 2, -0.5)),
+    vector.max(vector.create(1, 5, 3, 1), vector.create(4, 2, 6, 2)),
+    vector.lerp(vector.create(0, 2, 4, 6), vector.create(2, 4, 8, 10), 0.5)
+)",
+                   0,
+                   2
+               ),
+        R"(
+LOADK R0 K0 [1, -2, 2, -1]
+LOADK R1 K1 [4, 5, 6, 2]
+LOADK R2 K2 [1, 3, 6, 8]
+RETURN R0 3
+)"
+    );
+}
+
+TEST_CASE("BuiltinFoldingVectorProhibited")
+{
+    ScopedFastFlag luauCompileFoldVectorLib{FFlag::LuauCompileFoldVectorLib, true};
+
+    // dot product and magnitude depend on the VM vector size when W is used
+    // zero vector normalization and infinite interpolation would introduce a non-zero W
+    // invalid clamp ranges are a runtime error
+    CHECK_EQ(
+        "\n" + compileFunction(
+                   R"(
+return
+    vector.dot(vector.create(1, 2, 3, 4), vector.create(1, 1, 1, 1)),
+    vector.magnitude(vector.create(0, 0, 0, 1)),
+    vector.normalize(vector.create(0, 0, 0)),
+    vector.lerp(vector.create(0, 0, 0), vector.create(1, 1, 1), math.huge),
+    vector.clamp(vector.create(0, 0, 0), vector.create(1, 1, 1), vector.create(0, 0, 0))
+)",
+                   0,
+                   2
+               ),
+        R"(
+LOADK R1 K0 [1, 2, 3, 4]
+FASTCALL2K 81 R1 K1 L0 [1, 1, 1, 1]
+LOADK R2 K1 [1, 1, 1, 1]
+GETIMPORT R0 4 [vector.dot]
+CALL R0 2 1
+L0: LOADK R2 K5 [0, 0, 0, 1]
+FASTCALL1 78 R2 L1
+GETIMPORT R1 7 [vector.magnitude]
+CALL R1 1 1
+L1: LOADK R3 K8 [0, 0, 0]
+FASTCALL1 79 R3 L2
+GETIMPORT R2 10 [vector.normalize]
+CALL R2 1 1
+L2: LOADK R4 K8 [0, 0, 0]
+LOADK R5 K11 [1, 1, 1]
+LOADK R6 K12 [inf]
+FASTCALL 90 L3
+GETIMPORT R3 14 [vector.lerp]
+CALL R3 3 1
+L3: LOADK R5 K8 [0, 0, 0]
+LOADK R6 K11 [1, 1, 1]
+LOADK R7 K8 [0, 0, 0]
+FASTCALL 86 L4
+GETIMPORT R4 16 [vector.clamp]
+CALL R4 3 1
+L4: RETURN R0 5
+)"
+    );
+}
+
 TEST_CASE("BuiltinFoldingProhibited")
 {
     CHECK_EQ(
@@ -9982,6 +10416,9 @@ L3: RETURN R0 0
 
 TEST_CASE("BuiltinArity")
 {
+    // register moves are not fused in this test
+    ScopedFastFlag luauCompileMove2{FFlag::LuauCompileMove2, false};
+
     // by default we can't assume that we know parameter/result count for builtins as they can be overridden at runtime
     CHECK_EQ(
         "\n" + compileFunction(
@@ -10835,6 +11272,9 @@ RETURN R1 8
 
 TEST_CASE("NumericLoopTypeRevk")
 {
+    // register moves are not fused in this test
+    ScopedFastFlag luauCompileMove2{FFlag::LuauCompileMove2, false};
+
     CHECK_EQ(
         "\n" + compileFunction(
                    R"(
@@ -10873,6 +11313,9 @@ L1: RETURN R0 0
 
 TEST_CASE("ConstStringFolding")
 {
+    // register moves are not fused in this test
+    ScopedFastFlag luauCompileMove2{FFlag::LuauCompileMove2, false};
+
     ScopedFastFlag emitCallFb{FFlag::LuauEmitCallFeedback, true};
     ScopedFastFlag luauCompileStringInterpTempReg{FFlag::LuauCompileStringInterpTargetTop, true};
 
@@ -11860,6 +12303,28 @@ L0: RETURN R0 0
     );
 }
 
+TEST_CASE("BufferBulkFastcall")
+{
+    ScopedFastFlag luauBufferBulkFastcalls{FFlag::LuauBufferBulkFastcalls, true};
+
+    CHECK_EQ(
+        "\n" + compileFunction0(R"(
+local a, b = ...
+return buffer.equal(a, 0, b)
+)"),
+        R"(
+GETVARARGS R0 2
+LOADN R4 0
+FASTCALL3 135 R0 R4 R1 L0
+MOVE R3 R0
+MOVE R5 R1
+GETIMPORT R2 2 [buffer.equal]
+CALL R2 3 -1
+L0: RETURN R2 -1
+)"
+    );
+}
+
 TEST_CASE("ExportLocalBytecode")
 {
     ScopedFastFlag sffs[] = {{FFlag::LuauExportValueSyntax, true}};
@@ -12041,4 +12506,437 @@ RETURN R3 1
     );
 }
 
+TEST_CASE("ScalarTables")
+{
+    // register moves are not fused in this test
+    ScopedFastFlag luauCompileMove2{FFlag::LuauCompileMove2, false};
+
+    ScopedFastFlag luauCompileScalarTables{FFlag::LuauCompileScalarTables, true};
+
+    // table that is only read through its fields doesn't need to be allocated
+    CHECK_EQ(
+        "\n" + compileFunction(
+                   R"(
+local a, b = ...
+local p = {x = a, y = b}
+return p.x + p.y
+)",
+                   0,
+                   2
+               ),
+        R"(
+GETVARARGS R0 2
+MOVE R2 R0
+MOVE R3 R1
+ADD R4 R2 R3
+RETURN R4 1
+)"
+    );
+
+    // fields can be read inside loops and nested blocks
+    CHECK_EQ(
+        "\n" + compileFunction(
+                   R"(
+local s = 0
+for i = 1, ... do
+    local v = {x = i, y = i * 2}
+    if v.x > 1 then
+        s += v.y
+    end
+end
+return s
+)",
+                   0,
+                   2
+               ),
+        R"(
+LOADN R0 0
+LOADN R3 1
+GETVARARGS R1 1
+LOADN R2 1
+FORNPREP R1 L2
+L0: MOVE R4 R3
+MULK R5 R3 K0 [2]
+LOADN R6 1
+JUMPIFNOTLT R6 R4 L1
+ADD R0 R0 R5
+L1: FORNLOOP R1 L0
+L2: RETURN R0 1
+)"
+    );
+
+    // the optimization requires optimization level 2
+    CHECK_EQ(
+        "\n" + compileFunction(
+                   R"(
+local a, b = ...
+local p = {x = a, y = b}
+return p.x + p.y
+)",
+                   0,
+                   1
+               ),
+        R"(
+GETVARARGS R0 2
+DUPTABLE R2 2
+SETTABLEKS R0 R2 K0 ['x']
+SETTABLEKS R1 R2 K1 ['y']
+GETTABLEKS R4 R2 K0 ['x']
+GETTABLEKS R5 R2 K1 ['y']
+ADD R3 R4 R5
+RETURN R3 1
+)"
+    );
+}
+
+TEST_CASE("ScalarTablesEscape")
+{
+    ScopedFastFlag luauCompileScalarTables{FFlag::LuauCompileScalarTables, true};
+
+    // all of these uses require a real table
+    const char* escapes[] = {
+        "local p = {x = ...} print(p) return p.x",
+        "local p = {x = ...} return p.x, p.y",
+        "local p = {x = ...} p.x = 2 return p.x",
+        "local p = {x = ...} p.x += 2 return p.x",
+        "local p = {x = ...} return p:x()",
+        "local p = {x = ...} local q = p return q.x",
+        "local p = {x = ..., x = 2} return p.x",
+        "local p = {..., x = 1} return p.x",
+        "local p = {[...] = 1, x = 1} return p.x",
+        "local p = setmetatable({x = ...}, {}) return p.x",
+        "local p = {x = ...} p = {x = 2} return p.x",
+    };
+
+    for (const char* source : escapes)
+    {
+        INFO(std::string(source));
+
+        std::string bc = compileFunction(source, 0, 2);
+        CHECK((bc.find("NEWTABLE") != std::string::npos || bc.find("DUPTABLE") != std::string::npos));
+    }
+
+    // tables used from nested functions are kept as well
+    const char* nested[] = {
+        "local p = {x = ...} function p.f() end return p.x",
+        "local p = {x = ...} return function() return p.x end",
+    };
+
+    for (const char* source : nested)
+    {
+        INFO(std::string(source));
+
+        std::string bc = compileFunction(source, 1, 2);
+        CHECK(bc.find("DUPTABLE") != std::string::npos);
+    }
+}
+
+static const char* luauLibraryFunctionLookup(const char* library, const char* member, size_t* length)
+{
+    const char* source = nullptr;
+
+    if (strcmp(library, "test") == 0)
+    {
+        if (strcmp(member, "add") == 0)
+            source = "function(a, b) return a + b end";
+        else if (strcmp(member, "clamp01") == 0)
+            source = "function(x) return math.clamp(x, 0, 1) end";
+        else if (strcmp(member, "lerp") == 0)
+            source = "function(a, b, t)\n    local d = b - a\n    return a + d * t\nend";
+        else if (strcmp(member, "closure") == 0)
+            source = "function(a) return function() return a end end";
+        else if (strcmp(member, "broken") == 0)
+            source = "function(a, b) return a +";
+        else if (strcmp(member, "notfunction") == 0)
+            source = "42";
+    }
+
+    if (source)
+        *length = strlen(source);
+
+    return source;
+}
+
+static std::string compileWithLibraryFunctions(const char* source, uint32_t dumpFlags = Luau::BytecodeBuilder::Dump_Code)
+{
+    Luau::BytecodeBuilder bcb;
+    bcb.setDumpFlags(dumpFlags);
+
+    static const char* kLibraries[] = {"test", nullptr};
+
+    Luau::CompileOptions options;
+    options.optimizationLevel = 2;
+    options.librariesWithKnownMembers = kLibraries;
+    options.libraryMemberFunctionCb = luauLibraryFunctionLookup;
+
+    Luau::compileOrThrow(bcb, source, options);
+
+    return bcb.dumpEverything();
+}
+
+TEST_CASE("InlineLibraryFunctions")
+{
+    ScopedFastFlag luauCompileInlineLibraryFunctions{FFlag::LuauCompileInlineLibraryFunctions, true};
+
+    // library functions are only used for inlining, so the module doesn't carry any of their bytecode
+    CHECK_EQ(
+        "\n" + compileWithLibraryFunctions(R"(
+local a, b = ...
+return test.add(a, b)
+)"),
+        R"(
+Function 0 (??):
+GETVARARGS R0 2
+ADD R2 R0 R1
+RETURN R2 1
+
+)"
+    );
+
+    // constant arguments are folded through the inlined body
+    CHECK_EQ(
+        "\n" + compileWithLibraryFunctions(R"(
+return test.add(1, 2), test.clamp01(2)
+)"),
+        R"(
+Function 0 (??):
+LOADN R0 3
+LOADN R1 1
+RETURN R0 2
+
+)"
+    );
+
+    // inlined code uses the line of the call in the module, since the library source isn't part of it
+    CHECK_EQ(
+        "\n" + compileWithLibraryFunctions(
+                   R"(
+local a, b, t = ...
+
+return test.lerp(a, b, t)
+)",
+                   Luau::BytecodeBuilder::Dump_Code | Luau::BytecodeBuilder::Dump_Lines
+               ),
+        R"(
+Function 0 (??):
+2: GETVARARGS R0 3
+4: SUB R4 R1 R0
+4: MUL R5 R4 R2
+4: ADD R3 R0 R5
+4: RETURN R3 1
+
+)"
+    );
+}
+
+TEST_CASE("InlineLibraryFunctionsFallback")
+{
+    ScopedFastFlag luauCompileInlineLibraryFunctions{FFlag::LuauCompileInlineLibraryFunctions, true};
+
+    // unknown members, invalid sources and functions that create closures result in a regular call
+    CHECK_EQ(
+        "\n" + compileWithLibraryFunctions(R"(
+return test.sub(1, 2), test.broken(1, 2), test.closure(1), test.notfunction()
+)"),
+        R"(
+Function 0 (??):
+GETIMPORT R0 2 [test.sub]
+LOADN R1 1
+LOADN R2 2
+CALL R0 2 1
+GETIMPORT R1 4 [test.broken]
+LOADN R2 1
+LOADN R3 2
+CALL R1 2 1
+GETIMPORT R2 6 [test.closure]
+LOADN R3 1
+CALL R2 1 1
+GETIMPORT R3 8 [test.notfunction]
+CALL R3 0 -1
+RETURN R0 -1
+
+)"
+    );
+
+    // library that is replaced by the module can't be trusted
+    CHECK_EQ(
+        "\n" + compileWithLibraryFunctions(R"(
+test = ...
+return test.add(1, 2)
+)"),
+        R"(
+Function 0 (??):
+GETVARARGS R0 1
+SETGLOBAL R0 K0 ['test']
+GETGLOBAL R0 K0 ['test']
+GETTABLEKS R0 R0 K1 ['add']
+LOADN R1 1
+LOADN R2 2
+CALL R0 2 -1
+RETURN R0 -1
+
+)"
+    );
+}
+
+TEST_CASE("FoldMoves")
+{
+    ScopedFastFlag luauCompileFoldMoves{FFlag::LuauCompileFoldMoves, true};
+    ScopedFastFlag luauCompileMove2{FFlag::LuauCompileMove2, false};
+
+    // constant loads into a register that already holds the constant are removed
+    CHECK_EQ(
+        "\n" + compileFunction(
+                   R"(
+local t = {}
+t[1] = 0
+t[2] = 0
+t[3] = 0
+return t
+)",
+                   0,
+                   2
+               ),
+        R"(
+NEWTABLE R0 0 3
+LOADN R1 0
+SETTABLEN R1 R0 1
+SETTABLEN R1 R0 2
+SETTABLEN R1 R0 3
+RETURN R0 1
+)"
+    );
+
+    // copies of a value that is already in the register are removed, including ones skipped by FASTCALL
+    CHECK_EQ(
+        "\n" + compileFunction(
+                   R"(
+local a = ...
+local s = {a, a}
+return bit32.bnot(a), s
+)",
+                   0,
+                   2
+               ),
+        R"(
+GETVARARGS R0 1
+NEWTABLE R1 0 2
+MOVE R2 R0
+MOVE R3 R0
+SETLIST R1 R2 2 [1]
+FASTCALL1 30 R0 L0
+GETIMPORT R2 2 [bit32.bnot]
+CALL R2 1 1
+L0: MOVE R3 R1
+RETURN R2 2
+)"
+    );
+
+    // jump offsets are adjusted for removed instructions, loads that follow conditional jumps are also removed
+    CHECK_EQ(
+        "\n" + compileFunction(
+                   R"(
+local a, b = ...
+return a == 1 and b == 2 and a ~= b
+)",
+                   0,
+                   2
+               ),
+        R"(
+GETVARARGS R0 2
+LOADB R2 0
+JUMPXEQKN R0 K0 L1 NOT [1]
+JUMPXEQKN R1 K1 L1 NOT [2]
+JUMPIFNOTEQ R0 R1 L0
+LOADB R2 0 +1
+L0: LOADB R2 1
+L1: RETURN R2 1
+)"
+    );
+
+    // concatenation overwrites its source registers, so copies into them after CONCAT are kept
+    CHECK_EQ(
+        "\n" + compileFunction(
+                   R"(
+local a, b, c = ...
+local x, y
+x = a .. b .. c
+y = a .. b .. c
+return x, y
+)",
+                   0,
+                   2
+               ),
+        R"(
+GETVARARGS R0 3
+LOADNIL R3
+LOADNIL R4
+MOVE R5 R0
+MOVE R6 R1
+MOVE R7 R2
+CONCAT R3 R5 R7
+MOVE R5 R0
+MOVE R6 R1
+MOVE R7 R2
+CONCAT R4 R5 R7
+RETURN R3 2
+)"
+    );
+}
+
+
+TEST_CASE("FuseMoves")
+{
+    ScopedFastFlag luauCompileMove2{FFlag::LuauCompileMove2, true};
+
+    // copies into consecutive registers on the same line are combined; moves on different lines are kept to preserve line info
+    CHECK_EQ(
+        "\n" + compileFunction(
+                   R"(
+local a, b = ...
+g(a, b)
+local c = if a then b else a
+h(c,
+  a)
+)",
+                   0,
+                   2
+               ),
+        R"(
+GETVARARGS R0 2
+GETIMPORT R2 1 [g]
+MOVE2 R3 R0 R1
+CALL R2 2 0
+AND R2 R0 R1
+GETIMPORT R3 3 [h]
+MOVE R4 R2
+MOVE R5 R0
+CALL R3 2 0
+RETURN R0 0
+)"
+    );
+
+    // sources can come in any order
+    CHECK_EQ(
+        "\n" + compileFunction(
+                   R"(
+local a, b = ...
+return g(b, a), h(a, b)
+)",
+                   0,
+                   2
+               ),
+        R"(
+GETVARARGS R0 2
+GETIMPORT R2 1 [g]
+MOVE2 R3 R1 R0
+CALL R2 2 1
+GETIMPORT R3 3 [h]
+MOVE2 R4 R0 R1
+CALL R3 2 -1
+RETURN R2 -1
+)"
+    );
+}
+
 TEST_SUITE_END();
@@ -26,6 +26,7 @@
 #include <string>
 #include <unordered_map>
 #include <vector>
+#include <locale.h>
 #include <math.h>
 
 #include <sys/stat.h>
@@ -68,6 +69,24 @@ LUAU_FASTFLAG(LuauCustomYieldablePcalls)
 LUAU_FASTFLAG(DebugLuauUserDefinedClassesRuntime)
 LUAU_FASTFLAG(LuauAutoStack)
 LUAU_FASTFLAG(LuauUdataMetatablePinned)
+LUAU_FASTFLAG(LuauBytecodeCostModel)
+LUAU_FASTFLAG(LuauCompiledPatterns)
+LUAU_FASTFLAG(LuauVectorizedStrings)
+LUAU_FASTFLAG(LuauWideStringHash)
+LUAU_FASTFLAG(LuauDirectConcat)
+LUAU_FASTFLAG(LuauCompileConcatBuffer)
+LUAU_FASTFLAG(LuauFormatPrograms)
+LUAU_FASTFLAG(LuauJsonLibrary)
+LUAU_FASTFLAG(LuauBufferBulkOperations)
+LUAU_FASTFLAG(LuauBufferTableArrays)
+LUAU_FASTFLAG(LuauBufferBulkFastcalls)
+LUAU_FASTFLAG(LuauTypedSort)
+LUAU_FASTFLAG(LuauTableBulkCopy)
+LUAU_FASTFLAG(LuauCompileWideStringHash)
+LUAU_FASTFLAG(LuauCompileFoldMoves)
+
+// when set, conformance scripts are loaded with luau_loadlazy
+static bool lazyLoad = false;
 LUAU_DYNAMIC_FASTFLAG(LuauGcTableStepFix)
 
 #ifndef LUAU_CONFORMANCE_SOURCE_DIR
@@ -340,7 +359,8 @@ static StateRef runConformance(
 
     size_t bytecodeSize = 0;
     char* bytecode = luau_compile(source.data(), source.size(), &opts, &bytecodeSize);
-    int result = luau_load(L, chunkname.c_str(), bytecode, bytecodeSize, 0);
+    int result = lazyLoad ? luau_loadlazy(L, chunkname.c_str(), bytecode, bytecodeSize, 0)
+                          : luau_load(L, chunkname.c_str(), bytecode, bytecodeSize, 0);
     free(bytecode);
 
     Luau::CodeGen::CompilationOptions nativeOpts = codegenOptions ? *codegenOptions : defaultCodegenOptions();
@@ -1235,6 +1255,10 @@ TEST_CASE("Basic")
 
 TEST_CASE("Buffers")
 {
+    ScopedFastFlag luauBufferBulkOperations{FFlag::LuauBufferBulkOperations, true};
+    ScopedFastFlag luauBufferBulkFastcalls{FFlag::LuauBufferBulkFastcalls, true};
+    ScopedFastFlag luauBufferTableArrays{FFlag::LuauBufferTableArrays, true};
+
     runConformance(
         "buffers.luau",
         [](lua_State* L)
@@ -1253,6 +1277,7 @@ TEST_CASE("Integers")
 {
     ScopedFastFlag ncgBufferInteger{FFlag::LuauCodegenBufferInteger, true};
     ScopedFastFlag luauCodegenFixBufferLenCheck{FFlag::LuauCodegenFixBufferLenCheck, true};
+    ScopedFastFlag luauBufferTableArrays{FFlag::LuauBufferTableArrays, true};
 
     if (FFlag::LuauIntegerType2 && FFlag::LuauIntegerLibrary)
     {
@@ -1311,6 +1336,9 @@ TEST_CASE("Tables")
 TEST_CASE("PatternMatch")
 {
     runConformance("pm.luau");
+
+    ScopedFastFlag luauCompiledPatterns{FFlag::LuauCompiledPatterns, true};
+    runConformance("pm.luau");
 }
 
 TEST_CASE("Sort")
@@ -1318,8 +1346,17 @@ TEST_CASE("Sort")
     runConformance("sort.luau");
 }
 
+TEST_CASE("TypedSort")
+{
+    ScopedFastFlag luauTypedSort{FFlag::LuauTypedSort, true};
+
+    runConformance("sort.luau");
+}
+
 TEST_CASE("Move")
 {
+    ScopedFastFlag luauTableBulkCopy{FFlag::LuauTableBulkCopy, true};
+
     runConformance("move.luau");
 }
 
@@ -1331,6 +1368,53 @@ TEST_CASE("Clear")
 TEST_CASE("Strings")
 {
     runConformance("strings.luau");
+
+    ScopedFastFlag luauVectorizedStrings{FFlag::LuauVectorizedStrings, true};
+    runConformance("strings.luau");
+}
+
+TEST_CASE("StringCaseMappingLocale")
+{
+    ScopedFastFlag luauVectorizedStrings{FFlag::LuauVectorizedStrings, true};
+
+    std::string oldlocale = setlocale(LC_CTYPE, NULL);
+
+    // outside of the "C" locale, every byte has to be mapped by the C library regardless of its position in the string
+    for (const char* locale : {"C", "C.UTF-8", "tr_TR.ISO-8859-9", "de_DE.ISO-8859-1"})
+    {
+        if (!setlocale(LC_CTYPE, locale))
+            continue;
+
+        StateRef globalState(luaL_newstate(), lua_close);
+        lua_State* L = globalState.get();
+        luaL_openlibs(L);
+
+        std::string source;
+        for (int i = 0; i < 256 * 3; ++i)
+            source += char(i * 7 + i / 256);
+
+        for (const char* name : {"upper", "lower"})
+        {
+            lua_getglobal(L, "string");
+            lua_getfield(L, -1, name);
+            lua_pushlstring(L, source.data(), source.size());
+            REQUIRE(lua_pcall(L, 1, 1, 0) == LUA_OK);
+
+            size_t len = 0;
+            const char* result = lua_tolstring(L, -1, &len);
+            REQUIRE(len == source.size());
+
+            for (size_t i = 0; i < len; ++i)
+            {
+                unsigned char c = (unsigned char)source[i];
+                CHECK((unsigned char)result[i] == (unsigned char)(strcmp(name, "upper") == 0 ? toupper(c) : tolower(c)));
+            }
+
+            lua_pop(L, 2);
+        }
+    }
+
+    setlocale(LC_CTYPE, oldlocale.c_str());
 }
 
 TEST_CASE("StringInterp")
@@ -1338,6 +1422,22 @@ TEST_CASE("StringInterp")
     runConformance("stringinterp.luau");
 }
 
+TEST_CASE("FormatPrograms")
+{
+    ScopedFastFlag luauFormatPrograms{FFlag::LuauFormatPrograms, true};
+
+    runConformance("strings.luau");
+    runConformance("stringinterp.luau");
+}
+
+TEST_CASE("Json")
+{
+    ScopedFastFlag luauJsonLibrary{FFlag::LuauJsonLibrary, true};
+    ScopedFastFlag luauBufferTableArrays{FFlag::LuauBufferTableArrays, true};
+
+    runConformance("json.luau");
+}
+
 TEST_CASE("VarArg")
 {
     runConformance("vararg.luau");
@@ -1378,6 +1478,546 @@ TEST_CASE("Calls")
     runConformance("calls.luau");
 }
 
+TEST_CASE("LazyLoad")
+{
+    // lazy loading requires function sizes, which are only present in newer bytecode
+    ScopedFastFlag luauBytecodeCostModel{FFlag::LuauBytecodeCostModel, true};
+
+    std::string source = "local unused = {}\n";
+
+    for (int i = 0; i < 200; i++)
+    {
+        std::string n = std::to_string(i);
+        source += "unused[" + n + "] = function(x) local t = {a = " + n + ", b = 's" + n + "'} return t.a + x + math.abs(-" + n + ") end\n";
+    }
+
+    source += R"(
+local function f1(x) return x + 1 end
+local function f7(x) return x + 7 end
+
+local counter = 0
+local function bump() counter += 1 return counter end
+
+local function outer(a)
+    return function(b) return a + b end
+end
+
+collectgarbage()
+
+local late = function() return ("late"):upper() end
+
+return f1(1) + f7(2) + bump() + bump() + outer(10)(5) + #late() + unused[42](1)
+)";
+
+    // mapped bytecode has to outlive the states that reference it
+    size_t bytecodeSize = 0;
+    char* bytecodeData = luau_compile(source.data(), source.size(), nullptr, &bytecodeSize);
+    std::string bytecode(bytecodeData, bytecodeSize);
+    free(bytecodeData);
+
+    enum class Mode
+    {
+        Eager,
+        Lazy,
+        Mapped,
+    };
+
+    auto load = [&](lua_State* L, Mode mode)
+    {
+        luaL_openlibs(L);
+
+        lua_pushcfunction(L, lua_collectgarbage, "collectgarbage");
+        lua_setglobal(L, "collectgarbage");
+
+        luaL_sandbox(L);
+        luaL_sandboxthread(L);
+
+        int result = 0;
+
+        if (mode == Mode::Eager)
+            result = luau_load(L, "=LazyLoad", bytecode.data(), bytecode.size(), 0);
+        else if (mode == Mode::Lazy)
+            result = luau_loadlazy(L, "=LazyLoad", bytecode.data(), bytecode.size(), 0);
+        else
+            result = luau_loadmapped(L, "=LazyLoad", bytecode.data(), bytecode.size(), 0);
+
+        REQUIRE(result == 0);
+
+        lua_gc(L, LUA_GCCOLLECT, 0);
+        return lua_gc(L, LUA_GCCOUNT, 0) * 1024 + lua_gc(L, LUA_GCCOUNTB, 0);
+    };
+
+    StateRef eagerState(luaL_newstate(), lua_close);
+    StateRef lazyState(luaL_newstate(), lua_close);
+    StateRef mappedState(luaL_newstate(), lua_close);
+
+    int eagerBytes = load(eagerState.get(), Mode::Eager);
+    int lazyBytes = load(lazyState.get(), Mode::Lazy);
+    int mappedBytes = load(mappedState.get(), Mode::Mapped);
+
+    // functions that were not instantiated only keep their bytecode around
+    CHECK(lazyBytes < eagerBytes);
+
+    // mapped bytecode is not copied
+    CHECK(mappedBytes + int(bytecode.size()) <= lazyBytes);
+
+    for (lua_State* L : {eagerState.get(), lazyState.get(), mappedState.get()})
+    {
+        REQUIRE(lua_pcall(L, 0, 1, 0) == LUA_OK);
+        CHECK(lua_tonumber(L, -1) == 2 + 9 + 1 + 2 + 15 + 4 + 85);
+        lua_pop(L, 1);
+
+        lua_gc(L, LUA_GCCOLLECT, 0);
+        luaC_validate(L);
+    }
+}
+
+TEST_CASE("LazyLoadImports")
+{
+    // lazy loading requires function sizes, which are only present in newer bytecode
+    ScopedFastFlag luauBytecodeCostModel{FFlag::LuauBytecodeCostModel, true};
+
+    const char* source = R"(
+return function()
+    return function() return config.value, dynamic.value end
+end
+)";
+
+    size_t bytecodeSize = 0;
+    char* bytecode = luau_compile(source, strlen(source), nullptr, &bytecodeSize);
+
+    static int indexCalls = 0;
+    indexCalls = 0;
+
+    StateRef globalState(luaL_newstate(), lua_close);
+    lua_State* L = globalState.get();
+    luaL_openlibs(L);
+
+    lua_newtable(L);
+    lua_pushnumber(L, 1);
+    lua_setfield(L, -2, "value");
+    lua_setglobal(L, "config");
+
+    // globals that are provided by a function can't be resolved without running code
+    lua_newtable(L);
+    lua_pushcfunction(
+        L,
+        [](lua_State* L)
+        {
+            indexCalls++;
+            lua_newtable(L);
+            lua_pushnumber(L, 3);
+            lua_setfield(L, -2, "value");
+            return 1;
+        },
+        "__index"
+    );
+    lua_setfield(L, -2, "__index");
+    lua_setmetatable(L, LUA_GLOBALSINDEX);
+
+    luaL_sandbox(L);
+
+    REQUIRE(luau_loadlazy(L, "=LazyLoadImports", bytecode, bytecodeSize, 0) == 0);
+    free(bytecode);
+
+    REQUIRE(lua_pcall(L, 0, 1, 0) == LUA_OK);
+
+    // a sandboxed thread has its own globals, but imports of the chunk still come from the globals it was loaded with
+    lua_State* T = lua_newthread(L);
+    luaL_sandboxthread(T);
+
+    lua_newtable(T);
+    lua_pushnumber(T, 2);
+    lua_setfield(T, -2, "value");
+    lua_setglobal(T, "config");
+
+    lua_pushvalue(L, -2);
+    lua_xmove(L, T, 1);
+
+    // nested function is decoded when the closure is created, which must not call into the environment
+    REQUIRE(lua_pcall(T, 0, 1, 0) == LUA_OK);
+    CHECK(indexCalls == 0);
+
+    REQUIRE(lua_pcall(T, 0, 2, 0) == LUA_OK);
+    CHECK(lua_tonumber(T, -2) == 1);
+    CHECK(lua_tonumber(T, -1) == 3);
+    CHECK(indexCalls == 1);
+
+    lua_gc(L, LUA_GCCOLLECT, 0);
+    luaC_validate(L);
+}
+
+TEST_CASE("LazyLoadOutOfMemory")
+{
+    // lazy loading requires function sizes, which are only present in newer bytecode
+    ScopedFastFlag luauBytecodeCostModel{FFlag::LuauBytecodeCostModel, true};
+
+    // debug info with local and upvalue names is read when the nested function is first instantiated
+    // names are longer than the largest size class, so each of them is allocated directly and can fail
+    std::string source;
+    std::string sum = "0";
+
+    for (int i = 0; i < 8; ++i)
+    {
+        std::string name = "upvalue_" + std::string(1100, 'u') + std::to_string(i);
+        source += "local " + name + " = " + std::to_string(i) + "\n";
+        sum += " + " + name;
+    }
+
+    // assigning an upvalue makes the closure capture by reference, so it can't be created at load time
+    source += "local function nested(x)\n";
+    source += "    upvalue_" + std::string(1100, 'u') + "0 += 0\n";
+
+    for (int i = 0; i < 16; ++i)
+    {
+        std::string name = "local_" + std::string(1100, 'l') + std::to_string(i);
+        source += "    local " + name + " = x\n";
+        sum += " + " + name;
+    }
+
+    source += "    return " + sum + "\nend\nreturn nested(1)\n";
+
+    lua_CompileOptions options = {};
+    options.optimizationLevel = 1;
+    options.debugLevel = 2;
+
+    size_t bytecodeSize = 0;
+    char* bytecodeData = luau_compile(source.data(), source.size(), &options, &bytecodeSize);
+    std::string bytecode(bytecodeData, bytecodeSize);
+    free(bytecodeData);
+
+    struct Limit
+    {
+        bool enabled = false;
+        int remaining = 0;
+    };
+
+    auto limitedAlloc = [](void* ud, void* ptr, size_t osize, size_t nsize) -> void*
+    {
+        Limit* limit = (Limit*)ud;
+
+        if (nsize == 0)
+        {
+            free(ptr);
+            return nullptr;
+        }
+
+        if (limit->enabled && limit->remaining-- <= 0)
+            return nullptr;
+
+        // new blocks are filled with garbage so that fields left uninitialized by a failed decode are caught by the GC
+        if (!ptr)
+            return memset(malloc(nsize), 0xcd, nsize);
+
+        return realloc(ptr, nsize);
+    };
+
+    // fail every allocation made while running the chunk in turn, until it succeeds
+    for (int failAt = 0;; ++failAt)
+    {
+        Limit limit;
+        StateRef globalState(lua_newstate(limitedAlloc, &limit), lua_close);
+        lua_State* L = globalState.get();
+
+        REQUIRE(luau_loadlazy(L, "=LazyLoadOutOfMemory", bytecode.data(), bytecode.size(), 0) == 0);
+
+        // main function is kept on the stack, so the partially decoded nested function is still reachable after an error
+        lua_pushvalue(L, -1);
+
+        limit.enabled = true;
+        limit.remaining = failAt;
+
+        int status = lua_pcall(L, 0, 1, 0);
+
+        limit.enabled = false;
+
+        lua_gc(L, LUA_GCCOLLECT, 0);
+        luaC_validate(L);
+
+        if (status == LUA_OK)
+        {
+            CHECK(lua_tonumber(L, -1) == 28 + 16);
+            break;
+        }
+
+        CHECK(status == LUA_ERRMEM);
+        REQUIRE(failAt < 1000);
+    }
+}
+
+TEST_CASE("SharedBytecode")
+{
+    ScopedFastFlag luauBytecodeCostModel{FFlag::LuauBytecodeCostModel, true};
+
+    std::string source = "local sum = 0\n";
+
+    for (int i = 0; i < 100; i++)
+    {
+        std::string n = std::to_string(i);
+        source += "local function f" + n + "(x)\n    local y = x * 2\n    return y + " + n + "\nend\nsum += f" + n + "(1)\n";
+    }
+
+    source += "assert(debug.info(f7, 'l') == 5 * 7 + 2)\n";
+    source += "return sum\n";
+
+    size_t bytecodeSize = 0;
+    char* bytecode = luau_compile(source.data(), source.size(), nullptr, &bytecodeSize);
+    lua_SharedBytecode* shared = luau_newsharedbytecode(bytecode, bytecodeSize, limitedRealloc, nullptr);
+    REQUIRE(shared);
+
+    auto run = [&](lua_State* L, bool useShared)
+    {
+        luaL_openlibs(L);
+        luaL_sandbox(L);
+        luaL_sandboxthread(L);
+
+        int result = useShared ? luau_loadshared(L, "=SharedBytecode", shared, 0) : luau_loadlazy(L, "=SharedBytecode", bytecode, bytecodeSize, 0);
+        REQUIRE(result == 0);
+
+        // keep the functions alive
+        lua_pushvalue(L, -1);
+
+        REQUIRE(lua_pcall(L, 0, 1, 0) == LUA_OK);
+        CHECK(lua_tonumber(L, -1) == 100 * 2 + 99 * 100 / 2);
+        lua_pop(L, 1);
+
+        lua_gc(L, LUA_GCCOLLECT, 0);
+        luaC_validate(L);
+
+        return lua_gc(L, LUA_GCCOUNT, 0) * 1024 + lua_gc(L, LUA_GCCOUNTB, 0);
+    };
+
+    {
+        StateRef lazyState(luaL_newstate(), lua_close);
+        StateRef sharedState1(luaL_newstate(), lua_close);
+        StateRef sharedState2(luaL_newstate(), lua_close);
+
+        int lazyBytes = run(lazyState.get(), false);
+        int sharedBytes1 = run(sharedState1.get(), true);
+        int sharedBytes2 = run(sharedState2.get(), true);
+
+        // all functions were decoded, so the lazily loaded state no longer holds the bytecode, but it still owns line info
+        CHECK(sharedBytes1 < lazyBytes);
+        CHECK(sharedBytes1 == sharedBytes2);
+    }
+
+    luau_freesharedbytecode(shared);
+    free(bytecode);
+}
+
+TEST_CASE("SharedBytecodeOutOfMemory")
+{
+    std::string source = "local function f(x)\n    return x + 1\nend\nlocal function g(x)\n    return f(x) * 2\nend\nreturn g(1)\n";
+
+    size_t bytecodeSize = 0;
+    char* bytecode = luau_compile(source.data(), source.size(), nullptr, &bytecodeSize);
+
+    struct Limit
+    {
+        int remaining = 0;
+        size_t allocated = 0;
+    };
+
+    auto limitedAlloc = [](void* ud, void* ptr, size_t osize, size_t nsize) -> void*
+    {
+        Limit* limit = (Limit*)ud;
+
+        if (nsize == 0)
+        {
+            limit->allocated -= osize;
+            free(ptr);
+            return nullptr;
+        }
+
+        if (limit->remaining-- <= 0)
+            return nullptr;
+
+        limit->allocated += nsize - osize;
+        return realloc(ptr, nsize);
+    };
+
+    // fail every allocation in turn, nothing is leaked and blocks are freed with the size they were allocated with
+    for (int failAt = 0;; ++failAt)
+    {
+        Limit limit;
+        limit.remaining = failAt;
+
+        lua_SharedBytecode* shared = luau_newsharedbytecode(bytecode, bytecodeSize, limitedAlloc, &limit);
+
+        if (shared)
+        {
+            StateRef globalState(luaL_newstate(), lua_close);
+            lua_State* L = globalState.get();
+
+            REQUIRE(luau_loadshared(L, "=SharedBytecodeOutOfMemory", shared, 0) == 0);
+            REQUIRE(lua_pcall(L, 0, 1, 0) == LUA_OK);
+            CHECK(lua_tonumber(L, -1) == 4);
+
+            globalState.reset();
+            luau_freesharedbytecode(shared);
+            CHECK(limit.allocated == 0);
+            break;
+        }
+
+        CHECK(limit.allocated == 0);
+        REQUIRE(failAt < 100);
+    }
+
+    free(bytecode);
+}
+
+TEST_CASE("CompactBytecode")
+{
+    // regular bytecode needs function sizes to be loaded lazily
+    ScopedFastFlag luauBytecodeCostModel{FFlag::LuauBytecodeCostModel, true};
+
+    std::string source = R"(
+local log = {}
+local function where() return debug.info(2, 'l') end
+local function f(a)
+    local b = a * 0.25
+    table.insert(log, where())
+)";
+
+    // line gap that doesn't fit into a single line info interval
+    source += std::string(600, '\n');
+
+    source += R"(
+    for i = 1, 2 do
+        local c = b + 1e10
+        table.insert(log, where())
+        table.insert(log, locals())
+    end
+    return b
+end
+local function g(x)
+    local y = x * 0.25 + 1e10
+    table.insert(log, locals())
+    local ok, err = pcall(function() error("boom") end)
+    table.insert(log, err)
+    return y
+end
+table.insert(log, f(3))
+table.insert(log, g(2))
+table.insert(log, debug.info(f, 'l'))
+table.insert(log, debug.info(g, 'l'))
+table.insert(log, debug.traceback())
+return table.concat(log, '\n')
+)";
+
+    auto compile = [&](bool compact)
+    {
+        Luau::CompileOptions options;
+        options.debugLevel = 2;
+
+        Luau::BytecodeBuilder bcb;
+        bcb.setCompactEncoding(compact);
+        Luau::compileOrThrow(bcb, source, options);
+        return bcb.getBytecode();
+    };
+
+    std::string regular = compile(false);
+    std::string compact = compile(true);
+
+    // versions from 14 are always compact, so flags that need a later version select the compact encoding on their own
+    if (FFlag::LuauCompileConcatBuffer)
+    {
+        CHECK((compact[0] == 15 && regular == compact));
+    }
+    else
+    {
+        CHECK(compact[0] == 14);
+        CHECK(compact.size() < regular.size());
+    }
+
+    lua_CFunction locals = [](lua_State* L) -> int
+    {
+        std::string result;
+
+        for (int n = 1; const char* name = lua_getlocal(L, 1, n); ++n)
+        {
+            result += std::string(name) + "=" + (lua_isnumber(L, -1) ? lua_tostring(L, -1) : "?") + " ";
+            lua_pop(L, 1);
+        }
+
+        lua_pushstring(L, result.c_str());
+        return 1;
+    };
+
+    enum class Mode
+    {
+        Eager,
+        Lazy,
+        Shared,
+    };
+
+    auto run = [&](const std::string& bytecode, Mode mode)
+    {
+        StateRef globalState(luaL_newstate(), lua_close);
+        lua_State* L = globalState.get();
+
+        luaL_openlibs(L);
+
+        lua_pushcfunction(L, locals, "locals");
+        lua_setglobal(L, "locals");
+
+        luaL_sandbox(L);
+        luaL_sandboxthread(L);
+
+        lua_SharedBytecode* shared = mode == Mode::Shared ? luau_newsharedbytecode(bytecode.data(), bytecode.size(), limitedRealloc, nullptr) : nullptr;
+
+        int result = 0;
+
+        if (mode == Mode::Eager)
+            result = luau_load(L, "=CompactBytecode", bytecode.data(), bytecode.size(), 0);
+        else if (mode == Mode::Lazy)
+            result = luau_loadlazy(L, "=CompactBytecode", bytecode.data(), bytecode.size(), 0);
+        else
+            result = luau_loadshared(L, "=CompactBytecode", shared, 0);
+
+        REQUIRE(result == 0);
+        REQUIRE(lua_pcall(L, 0, 1, 0) == LUA_OK);
+
+        std::string output = lua_tostring(L, -1);
+
+        lua_gc(L, LUA_GCCOLLECT, 0);
+        luaC_validate(L);
+
+        globalState.reset();
+
+        if (shared)
+            luau_freesharedbytecode(shared);
+
+        return output;
+    };
+
+    std::string expected = run(regular, Mode::Eager);
+
+    CHECK(expected.find("b=0.75") != std::string::npos);
+    CHECK(expected.find("c=10000000000.75") != std::string::npos);
+    CHECK(expected.find("CompactBytecode:618: boom") != std::string::npos);
+
+    for (Mode mode : {Mode::Eager, Mode::Lazy, Mode::Shared})
+    {
+        CHECK(run(regular, mode) == expected);
+        CHECK(run(compact, mode) == expected);
+    }
+}
+
+TEST_CASE("LazyLoadConformance")
+{
+    ScopedFastFlag luauBytecodeCostModel{FFlag::LuauBytecodeCostModel, true};
+
+    lazyLoad = true;
+
+    runConformance("basic.luau");
+    runConformance("closure.luau");
+    runConformance("calls.luau");
+    runConformance("events.luau");
+
+    lazyLoad = false;
+}
+
 TEST_CASE("Attrib")
 {
     runConformance("attrib.luau");
@@ -2178,6 +2818,51 @@ TEST_CASE("Debugger")
         CHECK(stephits > 100); // note; this will depend on number of instructions which can vary, so we just make sure the callback gets hit often
 }
 
+TEST_CASE("SingleStepOpcodes")
+{
+    const char* source = R"(
+local function add(a, b)
+    return a + b
+end
+
+return add(1, 2)
+)";
+
+    size_t bytecodeSize = 0;
+    char* bytecode = luau_compile(source, strlen(source), nullptr, &bytecodeSize);
+
+    // opcode that is about to run and the opcode its caller is executing
+    static std::vector<std::pair<int, int>> steps;
+    steps.clear();
+
+    StateRef globalState(luaL_newstate(), lua_close);
+    lua_State* L = globalState.get();
+
+    lua_callbacks(L)->debugstep = [](lua_State* L, lua_Debug* ar)
+    {
+        steps.push_back({lua_getopcode(L, 0), lua_getopcode(L, 1)});
+    };
+
+    lua_singlestep(L, true);
+
+    REQUIRE(luau_load(L, "=SingleStepOpcodes", bytecode, bytecodeSize, 0) == 0);
+    free(bytecode);
+
+    REQUIRE(lua_pcall(L, 0, 1, 0) == LUA_OK);
+    CHECK(lua_tonumber(L, -1) == 3);
+
+    auto it = std::find(steps.begin(), steps.end(), std::make_pair(int(LOP_ADD), int(LOP_CALL)));
+    REQUIRE(it != steps.end());
+    REQUIRE(it + 1 != steps.end());
+    CHECK(it[1] == std::make_pair(int(LOP_RETURN), int(LOP_CALL)));
+
+    // the caller continues with its own return after the call, and there is nothing above the main function
+    CHECK(steps.back() == std::make_pair(int(LOP_RETURN), -1));
+
+    // only Luau functions have opcodes
+    CHECK(lua_getopcode(L, 0) == -1);
+}
+
 TEST_CASE("InterruptInspection")
 {
     static bool skipbreak = false;
@@ -2342,6 +3027,65 @@ TEST_CASE("SameHash")
     CHECK(luaS_hash(buf + 1, 120) == luaS_hash(buf + 2, 120));
 }
 
+TEST_CASE("SameWideHash")
+{
+    ScopedFastFlag luauCompileWideStringHash{FFlag::LuauCompileWideStringHash, true};
+
+    extern unsigned int luaS_hash(const char* str, size_t len);     // internal function, declared in lstring.h - not exposed via lua.h
+    extern unsigned int luaS_hashwide(const char* str, size_t len); // internal function, declared in lstring.h - not exposed via lua.h
+
+    // Short strings keep the original hash
+    CHECK(luaS_hashwide("luau", 4) == luaS_hash("luau", 4));
+    CHECK(luaS_hashwide("luaubytecodehash", 16) == Luau::BytecodeBuilder::getStringHash({"luaubytecodehash", 16}));
+
+    const char* name = "luaubytecodehash_luaubytecodehash_luaubytecodehash";
+    CHECK(luaS_hashwide(name, 32) == Luau::BytecodeBuilder::getStringHash({name, 32}));
+    CHECK(luaS_hashwide(name, 33) == Luau::BytecodeBuilder::getStringHash({name, 33}));
+    CHECK(luaS_hashwide(name, 50) == Luau::BytecodeBuilder::getStringHash({name, 50}));
+    CHECK(luaS_hashwide(name, 49) != luaS_hashwide(name + 1, 49));
+
+    char buf[128] = {};
+    CHECK(luaS_hashwide(buf + 1, 120) == luaS_hashwide(buf + 2, 120));
+}
+
+TEST_CASE("WideStringHash")
+{
+    ScopedFastFlag luauWideStringHash{FFlag::LuauWideStringHash, true};
+
+    runConformance("strings.luau");
+    runConformance("pm.luau");
+}
+
+TEST_CASE("DirectConcat")
+{
+    ScopedFastFlag luauDirectConcat{FFlag::LuauDirectConcat, true};
+
+    runConformance("basic.luau");
+    runConformance("strings.luau");
+}
+
+TEST_CASE("ConcatBuffer")
+{
+    ScopedFastFlag luauCompileConcatBuffer{FFlag::LuauCompileConcatBuffer, true};
+
+    lua_CompileOptions copts = defaultOptions();
+    copts.optimizationLevel = 2;
+
+    runConformance("basic.luau", nullptr, nullptr, nullptr, &copts);
+    runConformance("strings.luau", nullptr, nullptr, nullptr, &copts);
+}
+
+TEST_CASE("FoldMoves")
+{
+    ScopedFastFlag luauCompileFoldMoves{FFlag::LuauCompileFoldMoves, true};
+
+    lua_CompileOptions copts = defaultOptions();
+    copts.optimizationLevel = 2;
+
+    runConformance("basic.luau", nullptr, nullptr, nullptr, &copts);
+    runConformance("strings.luau", nullptr, nullptr, nullptr, &copts);
+}
+
 TEST_CASE("Reference")
 {
     static int dtorhits = 0;
@@ -4584,6 +5328,8 @@ end
     CHECK_EQ(summaries[2].getCount(0, LOP_GETTABLEN), 1);
     CHECK_EQ(summaries[2].getCount(0, LOP_RETURN), 1);
     CHECK_EQ(totalCount(summaries[2]), 2u);
+    CHECK_EQ(summaries[2].getPairCount(LOP_GETTABLEN, LOP_RETURN), 1);
+    CHECK_EQ(summaries[2].getPairCounts().size(), 1u);
 
     CHECK_EQ(summaries[3].getName(), "");
     CHECK_EQ(summaries[3].getLine(), 1);
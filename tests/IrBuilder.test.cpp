@@ -18,6 +18,7 @@ LUAU_FASTFLAG(LuauIntegerType2)
 LUAU_FASTFLAG(LuauIntegerLibrary)
 LUAU_FASTFLAG(LuauCodegenLoadPropagateOrigin)
 LUAU_FASTFLAG(LuauCodegenSubstituteReplacements)
+LUAU_FASTFLAG(LuauCodegenLoopInvariantTags)
 
 using namespace Luau::CodeGen;
 
@@ -4034,6 +4035,75 @@ bb_3:
 )");
 }
 
+TEST_CASE_FIXTURE(IrBuilderFixture, "TagsOfLoopInvariantRegistersFlowIntoLoopHeader")
+{
+    ScopedFastFlag luauCodegenLoopInvariantTags{FFlag::LuauCodegenLoopInvariantTags, true};
+
+    IrOp entry = build.block(IrBlockKind::Internal);
+    IrOp header = build.block(IrBlockKind::Internal);
+    IrOp latch = build.block(IrBlockKind::Internal);
+    IrOp exit = build.block(IrBlockKind::Internal);
+
+    build.beginBlock(entry);
+    build.inst(IrCmd::CHECK_TAG, build.inst(IrCmd::LOAD_TAG, build.vmReg(0)), build.constTag(ttable), build.vmExit(0));
+    build.inst(IrCmd::CHECK_TAG, build.inst(IrCmd::LOAD_TAG, build.vmReg(1)), build.constTag(tnumber), build.vmExit(0));
+    build.inst(IrCmd::JUMP, header);
+
+    // R0 is not modified inside the loop, so the check can rely on the state at loop entry, but R1 can change on each iteration
+    build.beginBlock(header);
+    build.inst(IrCmd::CHECK_TAG, build.inst(IrCmd::LOAD_TAG, build.vmReg(0)), build.constTag(ttable), build.vmExit(1));
+    build.inst(IrCmd::CHECK_TAG, build.inst(IrCmd::LOAD_TAG, build.vmReg(1)), build.constTag(tnumber), build.vmExit(1));
+    build.inst(IrCmd::JUMP_EQ_TAG, build.inst(IrCmd::LOAD_TAG, build.vmReg(2)), build.constTag(tnil), exit, latch);
+
+    build.beginBlock(latch);
+    build.inst(IrCmd::STORE_TAG, build.vmReg(1), build.inst(IrCmd::LOAD_TAG, build.vmReg(3)));
+    build.inst(IrCmd::JUMP, header);
+
+    build.beginBlock(exit);
+    build.inst(IrCmd::RETURN, build.vmReg(0), build.constInt(2));
+
+    updateUseCounts(build.function);
+    computeCfgInfo(build.function);
+    constPropInBlockChains(build);
+
+    CHECK("\n" + toString(build.function, IncludeUseInfo::No) == R"(
+bb_0:
+; successors: bb_1
+; in regs: R0, R1, R2, R3
+; out regs: R0, R1, R2, R3
+   %0 = LOAD_TAG R0
+   CHECK_TAG %0, ttable, exit(0)
+   %2 = LOAD_TAG R1
+   CHECK_TAG %2, tnumber, exit(0)
+   JUMP bb_1
+
+bb_1:
+; predecessors: bb_0, bb_2
+; successors: bb_3, bb_2
+; in regs: R0, R1, R2, R3
+; out regs: R0, R1, R2, R3
+   %7 = LOAD_TAG R1
+   CHECK_TAG %7, tnumber, exit(1)
+   %9 = LOAD_TAG R2
+   JUMP_EQ_TAG %9, tnil, bb_3, bb_2
+
+bb_2:
+; predecessors: bb_1
+; successors: bb_1
+; in regs: R0, R2, R3
+; out regs: R0, R1, R2, R3
+   %11 = LOAD_TAG R3
+   STORE_TAG R1, %11
+   JUMP bb_1
+
+bb_3:
+; predecessors: bb_1
+; in regs: R0, R1
+   RETURN R0, 2i
+
+)");
+}
+
 TEST_SUITE_END();
 
 TEST_SUITE_BEGIN("LinearExecutionFlowExtraction");
@@ -5610,6 +5680,71 @@ TEST_CASE_FIXTURE(IrBuilderFixture, "DominanceVerification4")
     CHECK(ctx.idf == std::vector<uint32_t>{6, 8});
 }
 
+TEST_CASE_FIXTURE(IrBuilderFixture, "NaturalLoops")
+{
+    IrOp entry = build.block(IrBlockKind::Internal);
+    IrOp outerHeader = build.block(IrBlockKind::Internal);
+    IrOp innerHeader = build.block(IrBlockKind::Internal);
+    IrOp innerBody = build.block(IrBlockKind::Internal);
+    IrOp outerLatch = build.block(IrBlockKind::Internal);
+    IrOp exit = build.block(IrBlockKind::Internal);
+
+    build.beginBlock(entry);
+    build.inst(IrCmd::STORE_TAG, build.vmReg(0), build.constTag(tnumber));
+    build.inst(IrCmd::JUMP, outerHeader);
+
+    build.beginBlock(outerHeader);
+    build.inst(IrCmd::JUMP_EQ_TAG, build.inst(IrCmd::LOAD_TAG, build.vmReg(1)), build.constTag(tnil), exit, innerHeader);
+
+    build.beginBlock(innerHeader);
+    build.inst(IrCmd::JUMP_EQ_TAG, build.inst(IrCmd::LOAD_TAG, build.vmReg(2)), build.constTag(tnil), outerLatch, innerBody);
+
+    build.beginBlock(innerBody);
+    build.inst(IrCmd::STORE_TAG, build.vmReg(2), build.inst(IrCmd::LOAD_TAG, build.vmReg(3)));
+    build.inst(IrCmd::JUMP, innerHeader);
+
+    build.beginBlock(outerLatch);
+    build.inst(IrCmd::CALL, build.vmReg(5), build.constInt(0), build.constInt(-1));
+    build.inst(IrCmd::CALL, build.vmReg(4), build.constInt(-1), build.constInt(1));
+    build.inst(IrCmd::STORE_TAG, build.vmReg(1), build.inst(IrCmd::LOAD_TAG, build.vmReg(4)));
+    build.inst(IrCmd::JUMP, outerHeader);
+
+    build.beginBlock(exit);
+    build.inst(IrCmd::RETURN, build.vmReg(0), build.constInt(1));
+
+    updateUseCounts(build.function);
+    computeCfgInfo(build.function);
+
+    const std::vector<CfgLoop>& loops = build.function.cfg.loops;
+
+    REQUIRE(loops.size() == 2);
+
+    CHECK(loops[0].header == 1);
+    CHECK(loops[0].latches == std::vector<uint32_t>{4});
+    CHECK(loops[0].blocks == std::vector<uint32_t>{1, 2, 3, 4});
+
+    // Variadic sequence consumed by the second call is still recorded as written
+    CHECK(!loops[0].written.regs.test(0));
+    CHECK(loops[0].written.regs.test(1));
+    CHECK(loops[0].written.regs.test(2));
+    CHECK(loops[0].written.varargSeq);
+    CHECK(loops[0].written.varargStart == 5);
+
+    CHECK(loops[1].header == 2);
+    CHECK(loops[1].latches == std::vector<uint32_t>{3});
+    CHECK(loops[1].blocks == std::vector<uint32_t>{2, 3});
+
+    CHECK(!loops[1].written.regs.test(1));
+    CHECK(loops[1].written.regs.test(2));
+    CHECK(!loops[1].written.varargSeq);
+
+    CHECK(findLoopByHeader(build.function.cfg, 2) == &loops[1]);
+    CHECK(findLoopByHeader(build.function.cfg, 3) == nullptr);
+
+    CHECK(dominates(build.function.cfg, 1, 3));
+    CHECK(!dominates(build.function.cfg, 3, 4));
+}
+
 TEST_SUITE_END();
 
 TEST_SUITE_BEGIN("ValueNumbering");
@@ -24,6 +24,11 @@ LUAU_FASTFLAG(LuauEmitCallFeedback)
 LUAU_FASTFLAG(LuauCallFeedback)
 LUAU_FASTFLAG(LuauCodegenDsePtrStoreTagCheck)
 LUAU_FASTFLAG(LuauCodegenRecordAllBlockExitInfo)
+LUAU_FASTFLAG(LuauCodegenColdBlockLayout)
+LUAU_FASTFLAG(LuauCompilePartialLoopUnroll)
+LUAU_FASTFLAG(LuauCompileMove2)
+LUAU_FASTFLAG(LuauBufferTableArrays)
+LUAU_FASTFLAG(LuauCodegenVectorizeBufferOps)
 
 #define ensureVectorSize3() if (LUA_VECTOR_SIZE != 3) return
 
@@ -506,6 +511,9 @@ bb_bytecode_1:
 
 TEST_CASE_FIXTURE(LoweringFixture, "VectorLerp")
 {
+    // instruction offsets in this test assume individual moves
+    ScopedFastFlag luauCompileMove2{FFlag::LuauCompileMove2, false};
+
     CHECK_EQ(
         "\n" + getCodegenAssembly(R"(
 local function vec3lerp(a: vector, b: vector, t: number)
@@ -542,6 +550,9 @@ bb_bytecode_1:
 
 TEST_CASE_FIXTURE(LoweringFixture, "VectorMinMax")
 {
+    // instruction offsets in this test assume individual moves
+    ScopedFastFlag luauCompileMove2{FFlag::LuauCompileMove2, false};
+
     CHECK_EQ(
         "\n" + getCodegenAssembly(R"(
 local function vecops(a: vector, b: vector)
@@ -1590,6 +1601,9 @@ bb_bytecode_1:
 
 TEST_CASE_FIXTURE(LoweringFixture, "VectorLibraryChain")
 {
+    // instruction offsets in this test assume individual moves
+    ScopedFastFlag luauCompileMove2{FFlag::LuauCompileMove2, false};
+
     CHECK_EQ(
         "\n" + getCodegenAssembly(R"(
 local function foo(a: vector, b: vector)
@@ -3367,6 +3381,8 @@ bb_bytecode_1:
 
 TEST_CASE_FIXTURE(LoweringFixture, "LoadAndMoveTypePropagation")
 {
+    // this test checks lowering of a regular numeric loop
+    ScopedFastFlag luauCompilePartialLoopUnroll{FFlag::LuauCompilePartialLoopUnroll, false};
     ScopedFastFlag luauCodegenLoadPropagateOrigin{FFlag::LuauCodegenLoadPropagateOrigin, true};
 
     CHECK_EQ(
@@ -3910,6 +3926,93 @@ bb_9:
     );
 }
 
+TEST_CASE_FIXTURE(LoweringFixture, "TypedArrayPartChecks")
+{
+    ScopedFastFlag luauBufferTableArrays{FFlag::LuauBufferTableArrays, true};
+
+    // inline ipairs loop and table.insert only handle the regular array part
+    CHECK_EQ(
+        "\n" + getCodegenAssembly(R"(
+local function foo(a: {number}, b: {number})
+    local sum = 0
+    for _, v in ipairs(a) do
+        sum += v
+    end
+    table.insert(b, sum)
+end
+)"),
+        R"(
+; function foo($arg0, $arg1) line 2
+bb_0:
+  CHECK_TAG R0, ttable, exit(entry)
+  CHECK_TAG R1, ttable, exit(entry)
+  JUMP bb_4
+bb_4:
+  JUMP bb_bytecode_1
+bb_bytecode_1:
+  implicit CHECK_SAFE_ENV exit(0)
+  STORE_DOUBLE R2, 0
+  STORE_TAG R2, tnumber
+  GET_CACHED_IMPORT R3, K1 (nil), 1073741824u ('ipairs'), 2u
+  %10 = LOAD_TVALUE R0, 0i, ttable
+  STORE_TVALUE R4, %10
+  INTERRUPT 4u
+  SET_SAVEDPC 5u
+  CALL R3, 1i, 3i
+  CHECK_SAFE_ENV exit(5)
+  CHECK_TAG R4, ttable, bb_fallback_5
+  CHECK_TAG R5, tnumber, bb_fallback_5
+  JUMP_CMP_NUM R5, 0, not_eq, bb_fallback_5, bb_6
+bb_6:
+  %22 = LOAD_POINTER R4
+  CHECK_NO_TYPED_ARRAY %22, bb_fallback_5
+  STORE_TAG R3, tnil
+  STORE_POINTER R5, 0i
+  STORE_EXTRA R5, 128i
+  STORE_TAG R5, tlightuserdata
+  JUMP bb_bytecode_3
+bb_bytecode_2:
+  CHECK_TAG R2, tnumber, exit(6)
+  CHECK_TAG R7, tnumber, exit(6)
+  %34 = LOAD_DOUBLE R2
+  %36 = ADD_NUM %34, R7
+  STORE_DOUBLE R2, %36
+  JUMP bb_bytecode_3
+bb_bytecode_3:
+  INTERRUPT 7u
+  CHECK_TAG R3, tnil, bb_fallback_8
+  %42 = LOAD_POINTER R4
+  %43 = LOAD_INT R5
+  %44 = GET_ARR_ADDR %42, %43
+  CHECK_ARRAY_SIZE %42, %43, bb_7
+  %46 = LOAD_TAG %44
+  JUMP_EQ_TAG %46, tnil, bb_7, bb_9
+bb_9:
+  %48 = ADD_INT %43, 1i
+  STORE_INT R5, %48
+  %50 = INT_TO_NUM %48
+  STORE_DOUBLE R6, %50
+  STORE_TAG R6, tnumber
+  %53 = LOAD_TVALUE %44
+  STORE_TVALUE R7, %53
+  JUMP bb_bytecode_2
+bb_7:
+  implicit CHECK_SAFE_ENV exit(9)
+  %61 = LOAD_POINTER R1
+  CHECK_READONLY %61, exit(11)
+  CHECK_NO_TYPED_ARRAY %61, exit(11)
+  %64 = TABLE_LEN %61
+  %65 = ADD_INT %64, 1i
+  %66 = TABLE_SETNUM %61, %65
+  %67 = LOAD_TVALUE R2
+  STORE_TVALUE %66, %67
+  BARRIER_TABLE_FORWARD %61, R2, undef
+  INTERRUPT 16u
+  RETURN R0, 0i
+)"
+    );
+}
+
 TEST_CASE_FIXTURE(LoweringFixture, "ForInAutoAnnotationIpairs")
 {
     ScopedFastFlag callFb{FFlag::LuauCallFeedback, true};
@@ -4576,6 +4679,9 @@ bb_bytecode_1:
 
 TEST_CASE_FIXTURE(LoweringFixture, "Bit32ReplaceDirect")
 {
+    // instruction offsets in this test assume individual moves
+    ScopedFastFlag luauCompileMove2{FFlag::LuauCompileMove2, false};
+
     ensureVectorSize3();
 
     CHECK_EQ(
@@ -4629,6 +4735,9 @@ bb_bytecode_1:
 
 TEST_CASE_FIXTURE(LoweringFixture, "Bit32ExtractDirect")
 {
+    // instruction offsets in this test assume individual moves
+    ScopedFastFlag luauCompileMove2{FFlag::LuauCompileMove2, false};
+
     CHECK_EQ(
         "\n" + getCodegenAssembly(R"(
 local function foo(a: number, b: number)
@@ -5033,6 +5142,9 @@ bb_bytecode_2:
 
 TEST_CASE_FIXTURE(LoweringFixture, "VectorLoadStoreOnlySamePrecision")
 {
+    // instruction offsets in this test assume individual moves
+    ScopedFastFlag luauCompileMove2{FFlag::LuauCompileMove2, false};
+
     ensureVectorSize3();
 
     CHECK_EQ(
@@ -5150,6 +5262,9 @@ bb_bytecode_3:
 
 TEST_CASE_FIXTURE(LoweringFixture, "BufferRelatedIndicesPositiveBase")
 {
+    // instruction offsets in this test assume individual moves
+    ScopedFastFlag luauCompileMove2{FFlag::LuauCompileMove2, false};
+
     CHECK_EQ(
         "\n" + getCodegenAssembly(R"(
 local function foo(buf: buffer, a: number)
@@ -5231,6 +5346,9 @@ bb_bytecode_1:
 }
 TEST_CASE_FIXTURE(LoweringFixture, "BufferRelatedIndicesPositiveDynamicBase")
 {
+    // instruction offsets in this test assume individual moves
+    ScopedFastFlag luauCompileMove2{FFlag::LuauCompileMove2, false};
+
     CHECK_EQ(
         "\n" + getCodegenAssembly(R"(
 local function foo(index: buffer, data: buffer, a: number)
@@ -5279,6 +5397,9 @@ bb_bytecode_1:
 
 TEST_CASE_FIXTURE(LoweringFixture, "BufferRelatedIndicesPositiveLoopRangeBase")
 {
+    // instruction offsets in this test assume individual moves
+    ScopedFastFlag luauCompileMove2{FFlag::LuauCompileMove2, false};
+
     ScopedFastFlag callFb{FFlag::LuauCallFeedback, true};
     ScopedFastFlag emitCallFb{FFlag::LuauEmitCallFeedback, true};
 
@@ -5363,6 +5484,9 @@ bb_bytecode_3:
 
 TEST_CASE_FIXTURE(LoweringFixture, "BufferRelatedIndicesPositiveAdvancingBase")
 {
+    // instruction offsets in this test assume individual moves
+    ScopedFastFlag luauCompileMove2{FFlag::LuauCompileMove2, false};
+
     CHECK_EQ(
         "\n" + getCodegenAssembly(R"(
 local function foo(buf: buffer, pos: number, a: number, b: number, c: number)
@@ -5458,6 +5582,9 @@ bb_bytecode_1:
 
 TEST_CASE_FIXTURE(LoweringFixture, "BufferRelatedIndicesMixedBase")
 {
+    // instruction offsets in this test assume individual moves
+    ScopedFastFlag luauCompileMove2{FFlag::LuauCompileMove2, false};
+
     CHECK_EQ(
         "\n" + getCodegenAssembly(R"(
 local function foo(buf: buffer, a: number)
@@ -5613,6 +5740,9 @@ bb_bytecode_1:
 
 TEST_CASE_FIXTURE(LoweringFixture, "NumericConversionReplacementCheck")
 {
+    // instruction offsets in this test assume individual moves
+    ScopedFastFlag luauCompileMove2{FFlag::LuauCompileMove2, false};
+
     CHECK_EQ(
         "\n" + getCodegenAssembly(R"(
 local function foo(buf: buffer, a: number)
@@ -5737,6 +5867,9 @@ bb_bytecode_1:
 
 TEST_CASE_FIXTURE(LoweringFixture, "BufferRelatedIndicesPositiveMultBaseInt")
 {
+    // instruction offsets in this test assume individual moves
+    ScopedFastFlag luauCompileMove2{FFlag::LuauCompileMove2, false};
+
     CHECK_EQ(
         "\n" + getCodegenAssembly(R"(
 local function foo(buf: buffer, a: number)
@@ -5779,6 +5912,9 @@ bb_bytecode_1:
 
 TEST_CASE_FIXTURE(LoweringFixture, "BufferRelatedIndicesMixedSizes")
 {
+    // instruction offsets in this test assume individual moves
+    ScopedFastFlag luauCompileMove2{FFlag::LuauCompileMove2, false};
+
     CHECK_EQ(
         "\n" + getCodegenAssembly(R"(
 local function foo(buf: buffer, a: number)
@@ -5864,6 +6000,9 @@ bb_bytecode_1:
 
 TEST_CASE_FIXTURE(LoweringFixture, "BufferEffects")
 {
+    // instruction offsets in this test assume individual moves
+    ScopedFastFlag luauCompileMove2{FFlag::LuauCompileMove2, false};
+
     CHECK_EQ(
         "\n" + getCodegenAssembly(
                    R"(
@@ -6997,6 +7136,8 @@ bb_bytecode_0:
 
 TEST_CASE_FIXTURE(LoweringFixture, "UpvalueAccessLoadStore4")
 {
+    // this test checks lowering of a regular numeric loop
+    ScopedFastFlag luauCompilePartialLoopUnroll{FFlag::LuauCompilePartialLoopUnroll, false};
     CHECK_EQ(
         "\n" + getCodegenAssembly(R"(
 local arr: {number}
@@ -7418,8 +7559,116 @@ bb_bytecode_1:
     );
 }
 
+TEST_CASE_FIXTURE(LoweringFixture, "BufferVectorizeF64Pair")
+{
+    ScopedFastFlag luauCodegenVectorizeBufferOps{FFlag::LuauCodegenVectorizeBufferOps, true};
+
+    // instruction offsets in this test assume individual moves
+    ScopedFastFlag luauCompileMove2{FFlag::LuauCompileMove2, false};
+
+    CHECK_EQ(
+        "\n" + getCodegenAssembly(R"(
+local function foo(out: buffer, a: buffer, b: buffer, o: number)
+    buffer.writef64(out, o, buffer.readf64(a, o) * buffer.readf64(b, o))
+    buffer.writef64(out, o + 8, buffer.readf64(a, o + 8) * buffer.readf64(b, o + 8))
+end
+)"),
+        R"(
+; function foo($arg0, $arg1, $arg2, $arg3) line 2
+bb_0:
+  CHECK_TAG R0, tbuffer, exit(entry)
+  CHECK_TAG R1, tbuffer, exit(entry)
+  CHECK_TAG R2, tbuffer, exit(entry)
+  CHECK_TAG R3, tnumber, exit(entry)
+  JUMP bb_2
+bb_2:
+  JUMP bb_bytecode_1
+bb_bytecode_1:
+  implicit CHECK_SAFE_ENV exit(0)
+  %15 = LOAD_POINTER R1
+  %16 = LOAD_DOUBLE R3
+  %17 = NUM_TO_INT %16
+  CHECK_BUFFER_LEN %15, %17, 0i, 16i, %16, exit(2)
+  %19 = BUFFER_READF64 %15, %17, tbuffer
+  %28 = LOAD_POINTER R2
+  CHECK_BUFFER_LEN %28, %17, 0i, 16i, undef, bb_exit_9
+   ; exit sync: R8, {%19}
+  %32 = BUFFER_READF64 %28, %17, tbuffer
+  %42 = MUL_NUM %19, %32
+  %52 = LOAD_POINTER R0
+  CHECK_BUFFER_LEN %52, %17, 0i, 16i, undef, bb_exit_10
+   ; exit sync: R9, R8, R7, {%32, %19, %42}
+  %57 = BUFFER_READF64X2 %15, %17, tbuffer
+  %80 = BUFFER_READF64X2 %28, %17, tbuffer
+  %99 = MUL_NUMX2 %57, %80
+  BUFFER_WRITEF64X2 %52, %17, %99, tbuffer
+  INTERRUPT 44u
+  RETURN R0, 0i
+)"
+    );
+}
+
+TEST_CASE_FIXTURE(LoweringFixture, "BufferVectorizeF64PairCallBetween")
+{
+    ScopedFastFlag luauCodegenVectorizeBufferOps{FFlag::LuauCodegenVectorizeBufferOps, true};
+
+    // instruction offsets in this test assume individual moves
+    ScopedFastFlag luauCompileMove2{FFlag::LuauCompileMove2, false};
+
+    // the first element write can't be delayed past a call
+    CHECK_EQ(
+        "\n" + getCodegenAssembly(R"(
+local function foo(out: buffer, a: buffer, b: buffer, o: number)
+    buffer.writef64(out, o, buffer.readf64(a, o) * buffer.readf64(b, o))
+    local s = math.sin(o)
+    buffer.writef64(out, o + 8, buffer.readf64(a, o + 8) * buffer.readf64(b, o + 8))
+    return s
+end
+)"),
+        R"(
+; function foo($arg0, $arg1, $arg2, $arg3) line 2
+bb_0:
+  CHECK_TAG R0, tbuffer, exit(entry)
+  CHECK_TAG R1, tbuffer, exit(entry)
+  CHECK_TAG R2, tbuffer, exit(entry)
+  CHECK_TAG R3, tnumber, exit(entry)
+  JUMP bb_2
+bb_2:
+  JUMP bb_bytecode_1
+bb_bytecode_1:
+  implicit CHECK_SAFE_ENV exit(0)
+  %15 = LOAD_POINTER R1
+  %16 = LOAD_DOUBLE R3
+  %17 = NUM_TO_INT %16
+  CHECK_BUFFER_LEN %15, %17, 0i, 16i, %16, exit(2)
+  %19 = BUFFER_READF64 %15, %17, tbuffer
+  %28 = LOAD_POINTER R2
+  CHECK_BUFFER_LEN %28, %17, 0i, 16i, undef, bb_exit_10
+   ; exit sync: R8, {%19}
+  %32 = BUFFER_READF64 %28, %17, tbuffer
+  %42 = MUL_NUM %19, %32
+  %52 = LOAD_POINTER R0
+  CHECK_BUFFER_LEN %52, %17, 0i, 16i, undef, bb_exit_11
+   ; exit sync: R9, R8, R7, {%32, %19, %42}
+  BUFFER_WRITEF64 %52, %17, %42, tbuffer
+  %63 = INVOKE_LIBM 24u, %16
+  STORE_DOUBLE R4, %63
+  STORE_TAG R4, tnumber
+  %86 = ADD_INT %17, 8i
+  %88 = BUFFER_READF64 %15, %86, tbuffer
+  %107 = BUFFER_READF64 %28, %86, tbuffer
+  %117 = MUL_NUM %88, %107
+  BUFFER_WRITEF64 %52, %86, %117, tbuffer
+  INTERRUPT 49u
+  RETURN R4, 1i
+)"
+    );
+}
+
 TEST_CASE_FIXTURE(LoweringFixture, "LoopStepDetection1")
 {
+    // this test checks lowering of a regular numeric loop
+    ScopedFastFlag luauCompilePartialLoopUnroll{FFlag::LuauCompilePartialLoopUnroll, false};
     ScopedFastFlag luauCodegenLoadPropagateOrigin{FFlag::LuauCodegenLoadPropagateOrigin, true};
 
     assemblyOptions.includeRegFlowInfo = Luau::CodeGen::IncludeRegFlowInfo::Yes;
@@ -7484,6 +7733,8 @@ bb_bytecode_3:
 
 TEST_CASE_FIXTURE(LoweringFixture, "LoopStepDetection2")
 {
+    // this test checks lowering of a regular numeric loop
+    ScopedFastFlag luauCompilePartialLoopUnroll{FFlag::LuauCompilePartialLoopUnroll, false};
     CHECK_EQ(
         "\n" + getCodegenAssembly(
                    R"(
@@ -7558,6 +7809,9 @@ bb_bytecode_3:
 
 TEST_CASE_FIXTURE(LoweringFixture, "UintSourceSanity")
 {
+    // instruction offsets in this test assume individual moves
+    ScopedFastFlag luauCompileMove2{FFlag::LuauCompileMove2, false};
+
     // TODO: opportunity - many conversions and stores remain because of VM exits
     CHECK_EQ(
         "\n" + getCodegenAssembly(
@@ -8005,6 +8259,9 @@ bb_2:
 
 TEST_CASE_FIXTURE(LoweringFixture, "IntegerMultiargValidate")
 {
+    // instruction offsets in this test assume individual moves
+    ScopedFastFlag luauCompileMove2{FFlag::LuauCompileMove2, false};
+
     ScopedFastFlag luauIntegerFastcalls{FFlag::LuauIntegerFastcalls, true};
     ScopedFastFlag LuauCodegenInteger3{FFlag::LuauCodegenInteger3, true};
     ScopedFastFlag luauIntegerType{FFlag::LuauIntegerType2, true};
@@ -8037,6 +8294,9 @@ bb_bytecode_0:
 
 TEST_CASE_FIXTURE(LoweringFixture, "IntegerMultiargValidate2")
 {
+    // instruction offsets in this test assume individual moves
+    ScopedFastFlag luauCompileMove2{FFlag::LuauCompileMove2, false};
+
     ScopedFastFlag luauIntegerFastcalls{FFlag::LuauIntegerFastcalls, true};
     ScopedFastFlag LuauCodegenInteger3{FFlag::LuauCodegenInteger3, true};
     ScopedFastFlag luauIntegerType{FFlag::LuauIntegerType2, true};
@@ -8070,6 +8330,9 @@ bb_bytecode_0:
 
 TEST_CASE_FIXTURE(LoweringFixture, "IntegerMultiargValidate3")
 {
+    // instruction offsets in this test assume individual moves
+    ScopedFastFlag luauCompileMove2{FFlag::LuauCompileMove2, false};
+
     ScopedFastFlag luauIntegerFastcalls{FFlag::LuauIntegerFastcalls, true};
     ScopedFastFlag LuauCodegenInteger3{FFlag::LuauCodegenInteger3, true};
     ScopedFastFlag luauIntegerType{FFlag::LuauIntegerType2, true};
@@ -8239,4 +8502,50 @@ bb_bytecode_1:
 )"
     );
 }
+
+TEST_CASE_FIXTURE(LoweringFixture, "ErrorPathIsPlacedAfterRegularBlocks")
+{
+    ScopedFastFlag luauCodegenColdBlockLayout{FFlag::LuauCodegenColdBlockLayout, true};
+    ScopedFastFlag callFb{FFlag::LuauCallFeedback, true};
+    ScopedFastFlag emitCallFb{FFlag::LuauEmitCallFeedback, true};
+
+    CHECK_EQ(
+        "\n" + getCodegenAssembly(
+                   R"(
+local function foo(a: number)
+    if a < 0 then
+        error("negative")
+    end
+    return a * 2
+end
+)"
+               ),
+        R"(
+; function foo($arg0) line 2
+bb_0:
+  CHECK_TAG R0, tnumber, exit(entry)
+  JUMP bb_3
+bb_3:
+  JUMP bb_bytecode_1
+bb_bytecode_1:
+  JUMP_CMP_NUM R0, 0, not_lt, bb_bytecode_2, bb_4
+bb_bytecode_2:
+  %26 = LOAD_DOUBLE R0
+  %27 = ADD_NUM %26, %26
+  STORE_DOUBLE R1, %27
+  STORE_TAG R1, tnumber
+  INTERRUPT 9u
+  RETURN R1, 1i
+bb_4:
+  implicit CHECK_SAFE_ENV exit(3)
+  GET_CACHED_IMPORT R1, K1 (nil), 1073741824u ('error'), 4u
+  %18 = LOAD_TVALUE K2 ('negative'), 0i, tstring
+  STORE_TVALUE R2, %18
+  INTERRUPT 6u
+  SET_SAVEDPC 8u
+  CALL R1, 1i, 0i
+  JUMP bb_bytecode_2
+)"
+    );
+}
 TEST_SUITE_END();